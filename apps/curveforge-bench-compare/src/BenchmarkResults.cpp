@@ -0,0 +1,129 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#include "BenchmarkResults.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+#include "Json.h"
+
+namespace curve::bench {
+    namespace {
+        double to_nanoseconds(double value, const std::string &unit) {
+            if (unit == "ns") return value;
+            if (unit == "us") return value * 1e3;
+            if (unit == "ms") return value * 1e6;
+            if (unit == "s") return value * 1e9;
+            throw std::runtime_error("unknown time_unit '" + unit + "'");
+        }
+
+        const char *metric_name(Metric metric) { return metric == Metric::CPU_TIME ? "cpu_time" : "real_time"; }
+    }
+
+    void read_benchmark_json(const std::string &path, Metric metric, RunSamples &samples) {
+        const auto document = read_json_file(path);
+        const auto *benchmarks = document.find("benchmarks");
+        if (benchmarks == nullptr || benchmarks->kind != JsonValue::Kind::ARRAY) {
+            throw std::runtime_error(path + ": no \"benchmarks\" array, not Google Benchmark JSON output");
+        }
+        for (const auto &run: benchmarks->items) {
+            if (const auto *type = run.find("run_type"); type != nullptr && type->string != "iteration") continue;
+            if (const auto *error = run.find("error_occurred"); error != nullptr && error->boolean) continue;
+            const auto *name = run.find("run_name");
+            if (name == nullptr) name = run.find("name");
+            const auto *time = run.find(metric_name(metric));
+            const auto *unit = run.find("time_unit");
+            if (name == nullptr || time == nullptr) {
+                throw std::runtime_error(path + ": benchmark entry without name or " + metric_name(metric));
+            }
+            const auto &key = name->as_string("name");
+            samples[key].push_back(to_nanoseconds(time->as_number(key), unit ? unit->as_string("time_unit") : "ns"));
+        }
+    }
+
+    double median(std::vector<double> values) {
+        if (values.empty()) throw std::invalid_argument("median of no values");
+        const auto mid = values.begin() + static_cast<std::ptrdiff_t>(values.size() / 2);
+        std::nth_element(values.begin(), mid, values.end());
+        if (values.size() % 2 == 1) return *mid;
+        return (*mid + *std::max_element(values.begin(), mid)) / 2.0;
+    }
+
+    double median_absolute_deviation(const std::vector<double> &values) {
+        const double m = median(values);
+        std::vector<double> deviations;
+        deviations.reserve(values.size());
+        for (const double v: values) deviations.push_back(std::abs(v - m));
+        return median(std::move(deviations));
+    }
+
+    Baseline read_baseline(const std::string &path) {
+        const auto document = read_json_file(path);
+        Baseline baseline;
+        if (const auto *metric = document.find("metric")) {
+            const auto &name = metric->as_string("metric");
+            if (name != "cpu_time" && name != "real_time") throw std::runtime_error(path + ": unknown metric " + name);
+            baseline.metric = name == "cpu_time" ? Metric::CPU_TIME : Metric::REAL_TIME;
+        }
+        if (const auto *tolerance = document.find("tolerance")) baseline.tolerance = tolerance->as_number("tolerance");
+        const auto *benchmarks = document.find("benchmarks");
+        if (benchmarks == nullptr || benchmarks->kind != JsonValue::Kind::ARRAY) {
+            throw std::runtime_error(path + ": no \"benchmarks\" array");
+        }
+        for (const auto &item: benchmarks->items) {
+            const auto *name = item.find("name");
+            const auto *median_ns = item.find("median_ns");
+            if (name == nullptr || median_ns == nullptr) throw std::runtime_error(path + ": entry without name/median_ns");
+            const auto &key = name->as_string("name");
+            BaselineEntry entry;
+            entry.median_ns = median_ns->as_number(key);
+            if (const auto *mad = item.find("mad_ns")) entry.mad_ns = mad->as_number(key);
+            if (const auto *reps = item.find("repetitions")) entry.repetitions = static_cast<std::size_t>(reps->number);
+            if (const auto *tolerance = item.find("tolerance")) entry.tolerance = tolerance->as_number(key);
+            baseline.entries[key] = entry;
+        }
+        return baseline;
+    }
+
+    void write_baseline(const std::string &path, const Baseline &baseline) {
+        std::ofstream out(path);
+        if (!out) throw std::runtime_error("cannot write " + path);
+        out << std::setprecision(6);
+        out << "{\n  \"metric\": \"" << metric_name(baseline.metric) << "\",\n  \"tolerance\": " << baseline.tolerance
+                << ",\n  \"benchmarks\": [";
+        bool first = true;
+        for (const auto &[name, entry]: baseline.entries) {
+            out << (first ? "\n" : ",\n") << "    {\"name\": " << json_quote(name) << ", \"median_ns\": "
+                    << entry.median_ns << ", \"mad_ns\": " << entry.mad_ns << ", \"repetitions\": " << entry.repetitions;
+            if (entry.tolerance) out << ", \"tolerance\": " << *entry.tolerance;
+            out << '}';
+            first = false;
+        }
+        out << "\n  ]\n}\n";
+        if (!out) throw std::runtime_error("cannot write " + path);
+    }
+
+    Baseline make_baseline(const RunSamples &samples, Metric metric, double tolerance, const Baseline *previous) {
+        Baseline baseline;
+        baseline.metric = metric;
+        baseline.tolerance = tolerance;
+        for (const auto &[name, times]: samples) {
+            BaselineEntry entry;
+            entry.median_ns = median(times);
+            entry.mad_ns = median_absolute_deviation(times);
+            entry.repetitions = times.size();
+            if (previous != nullptr) {
+                if (const auto it = previous->entries.find(name); it != previous->entries.end()) {
+                    entry.tolerance = it->second.tolerance;
+                }
+            }
+            baseline.entries[name] = entry;
+        }
+        return baseline;
+    }
+}
@@ -0,0 +1,58 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#ifndef CURVEFORGE_BENCH_BENCHMARKRESULTS_H
+#define CURVEFORGE_BENCH_BENCHMARKRESULTS_H
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace curve::bench {
+    enum class Metric {
+        CPU_TIME,
+        REAL_TIME
+    };
+
+    // Per-repetition times of each benchmark in nanoseconds, keyed by run name
+    using RunSamples = std::map<std::string, std::vector<double> >;
+
+    /**
+     * Adds the iteration entries of a Google Benchmark JSON file to `samples`. Aggregates
+     * (mean/median/stddev) and errored runs are skipped, so files written with any
+     * --benchmark_repetitions can be mixed; repeated files simply add repetitions.
+     */
+    void read_benchmark_json(const std::string &path, Metric metric, RunSamples &samples);
+
+    double median(std::vector<double> values);
+
+    // Median absolute deviation around the median
+    double median_absolute_deviation(const std::vector<double> &values);
+
+    struct BaselineEntry {
+        double median_ns = 0.0;
+        double mad_ns = 0.0;
+        std::size_t repetitions = 0;
+        std::optional<double> tolerance; // overrides Baseline::tolerance for this benchmark
+    };
+
+    // Checked-in reference timings, one entry per benchmark
+    struct Baseline {
+        Metric metric = Metric::CPU_TIME;
+        double tolerance = 0.10; // relative slowdown accepted for every benchmark
+        std::map<std::string, BaselineEntry> entries;
+    };
+
+    Baseline read_baseline(const std::string &path);
+
+    void write_baseline(const std::string &path, const Baseline &baseline);
+
+    // Baseline of `samples`; per-benchmark tolerances of `previous` are carried over.
+    Baseline make_baseline(const RunSamples &samples, Metric metric, double tolerance,
+                           const Baseline *previous = nullptr);
+}
+
+#endif //CURVEFORGE_BENCH_BENCHMARKRESULTS_H
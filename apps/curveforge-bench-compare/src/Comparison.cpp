@@ -0,0 +1,129 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#include "Comparison.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace curve::bench {
+    namespace {
+        constexpr double kMadToSigma = 1.4826; // MAD of a normal sample times this estimates sigma
+
+        const char *label(Verdict verdict) {
+            switch (verdict) {
+                case Verdict::REGRESSION: return "REGRESSION";
+                case Verdict::IMPROVEMENT: return "improvement";
+                case Verdict::UNCHANGED: return "unchanged";
+                case Verdict::NEW: return "new";
+                case Verdict::MISSING: return "missing";
+            }
+            return "";
+        }
+
+        std::string format_time(double ns) {
+            char buffer[32];
+            if (ns < 1e3) std::snprintf(buffer, sizeof(buffer), "%.1f ns", ns);
+            else if (ns < 1e6) std::snprintf(buffer, sizeof(buffer), "%.2f us", ns / 1e3);
+            else if (ns < 1e9) std::snprintf(buffer, sizeof(buffer), "%.2f ms", ns / 1e6);
+            else std::snprintf(buffer, sizeof(buffer), "%.2f s", ns / 1e9);
+            return buffer;
+        }
+
+        std::string format_percent(double fraction, bool sign = true) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), sign ? "%+.1f%%" : "%.1f%%", fraction * 100.0);
+            return buffer;
+        }
+    }
+
+    std::size_t ComparisonReport::count(Verdict verdict) const {
+        return static_cast<std::size_t>(std::count_if(rows.begin(), rows.end(), [verdict](const auto &row) {
+            return row.verdict == verdict;
+        }));
+    }
+
+    bool ComparisonReport::failed(const CompareOptions &options) const {
+        return count(Verdict::REGRESSION) > 0 || (options.fail_on_missing && count(Verdict::MISSING) > 0);
+    }
+
+    ComparisonReport compare(const Baseline &baseline, const RunSamples &run, const CompareOptions &options) {
+        ComparisonReport report;
+        for (const auto &[name, times]: run) {
+            ComparisonRow row;
+            row.name = name;
+            row.current_ns = median(times);
+            row.repetitions = times.size();
+            const auto it = baseline.entries.find(name);
+            if (it == baseline.entries.end()) {
+                row.verdict = Verdict::NEW;
+                report.rows.push_back(row);
+                continue;
+            }
+            const auto &entry = it->second;
+            row.baseline_ns = entry.median_ns;
+            row.change = row.current_ns / entry.median_ns - 1.0;
+            const double mad = median_absolute_deviation(times);
+            const double noise = options.noise_sigmas * kMadToSigma * std::hypot(entry.mad_ns, mad) / entry.median_ns;
+            row.allowed = std::max(entry.tolerance.value_or(baseline.tolerance), noise);
+            if (row.change > row.allowed) row.verdict = Verdict::REGRESSION;
+            else if (row.change < -row.allowed) row.verdict = Verdict::IMPROVEMENT;
+            report.rows.push_back(row);
+        }
+        for (const auto &[name, entry]: baseline.entries) {
+            if (run.contains(name)) continue;
+            ComparisonRow row;
+            row.name = name;
+            row.verdict = Verdict::MISSING;
+            row.baseline_ns = entry.median_ns;
+            report.rows.push_back(row);
+        }
+        std::stable_sort(report.rows.begin(), report.rows.end(), [](const auto &a, const auto &b) {
+            if (a.verdict != b.verdict) return a.verdict < b.verdict;
+            return std::abs(a.change) > std::abs(b.change);
+        });
+        return report;
+    }
+
+    void print_report(std::ostream &out, const ComparisonReport &report, const CompareOptions &options,
+                      bool verbose) {
+        std::size_t width = 9;
+        for (const auto &row: report.rows) width = std::max(width, row.name.size());
+
+        char line[512];
+        const auto print_row = [&](const std::string &name, const std::string &base, const std::string &current,
+                                   const std::string &change, const std::string &allowed, const std::string &verdict) {
+            std::snprintf(line, sizeof(line), "%-*s  %12s  %12s  %9s  %9s  %s\n", static_cast<int>(width),
+                          name.c_str(), base.c_str(), current.c_str(), change.c_str(), allowed.c_str(),
+                          verdict.c_str());
+            out << line;
+        };
+
+        bool header = false;
+        for (const auto &row: report.rows) {
+            const bool interesting = row.verdict == Verdict::REGRESSION || row.verdict == Verdict::IMPROVEMENT ||
+                                     (row.verdict == Verdict::MISSING && options.fail_on_missing);
+            if (!interesting && !verbose) continue;
+            if (!header) {
+                print_row("Benchmark", "Baseline", "Current", "Change", "Allowed", "Verdict");
+                out << std::string(width + 61, '-') << '\n';
+                header = true;
+            }
+            const bool has_baseline = row.verdict != Verdict::NEW;
+            const bool has_run = row.verdict != Verdict::MISSING;
+            print_row(row.name, has_baseline ? format_time(row.baseline_ns) : "-",
+                      has_run ? format_time(row.current_ns) : "-",
+                      has_baseline && has_run ? format_percent(row.change) : "-",
+                      has_baseline && has_run ? format_percent(row.allowed, false) : "-", label(row.verdict));
+        }
+        if (header) out << '\n';
+
+        out << "bench-compare: " << report.count(Verdict::REGRESSION) << " regressions, "
+                << report.count(Verdict::IMPROVEMENT) << " improvements, " << report.count(Verdict::UNCHANGED)
+                << " unchanged, " << report.count(Verdict::NEW) << " new, " << report.count(Verdict::MISSING)
+                << " missing\n";
+        out << (report.failed(options) ? "BENCH_COMPARE_FAILED" : "BENCH_COMPARE_OK") << std::endl;
+    }
+}
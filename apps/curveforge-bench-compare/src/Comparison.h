@@ -0,0 +1,59 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#ifndef CURVEFORGE_BENCH_COMPARISON_H
+#define CURVEFORGE_BENCH_COMPARISON_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "BenchmarkResults.h"
+
+namespace curve::bench {
+    enum class Verdict {
+        REGRESSION,
+        IMPROVEMENT,
+        UNCHANGED,
+        NEW, // in the run, not in the baseline
+        MISSING // in the baseline, not in the run
+    };
+
+    struct CompareOptions {
+        // Changes within this many robust standard deviations (1.4826 * MAD of both sides) are noise
+        double noise_sigmas = 3.0;
+        bool fail_on_missing = false;
+    };
+
+    struct ComparisonRow {
+        std::string name;
+        Verdict verdict = Verdict::UNCHANGED;
+        double baseline_ns = 0.0;
+        double current_ns = 0.0;
+        double change = 0.0; // current / baseline - 1
+        double allowed = 0.0; // relative change treated as noise
+        std::size_t repetitions = 0;
+    };
+
+    struct ComparisonReport {
+        std::vector<ComparisonRow> rows; // regressions first, then improvements, by size of the change
+
+        [[nodiscard]] std::size_t count(Verdict verdict) const;
+
+        [[nodiscard]] bool failed(const CompareOptions &options) const;
+    };
+
+    /**
+     * Compares the median of every benchmark of `run` with the baseline. A benchmark regresses
+     * when it slowed down by more than the larger of its tolerance and the noise band.
+     */
+    ComparisonReport compare(const Baseline &baseline, const RunSamples &run, const CompareOptions &options);
+
+    // Table of regressions and improvements (every row with `verbose`) followed by a summary line
+    void print_report(std::ostream &out, const ComparisonReport &report, const CompareOptions &options,
+                      bool verbose);
+}
+
+#endif //CURVEFORGE_BENCH_COMPARISON_H
@@ -0,0 +1,242 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#include "Json.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace curve::bench {
+    namespace {
+        class Parser {
+        public:
+            explicit Parser(std::string_view text) : text_(text) {
+            }
+
+            JsonValue document() {
+                auto value = parse_value();
+                skip_space();
+                if (pos_ != text_.size()) error("trailing characters");
+                return value;
+            }
+
+        private:
+            [[noreturn]] void error(const std::string &what) const {
+                throw std::runtime_error("JSON: " + what + " at offset " + std::to_string(pos_));
+            }
+
+            void skip_space() {
+                while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\n' || text_[pos_] == '\r' ||
+                                               text_[pos_] == '\t')) {
+                    ++pos_;
+                }
+            }
+
+            char peek() {
+                skip_space();
+                if (pos_ == text_.size()) error("unexpected end of input");
+                return text_[pos_];
+            }
+
+            void expect(char c) {
+                if (peek() != c) error(std::string("expected '") + c + "'");
+                ++pos_;
+            }
+
+            bool literal(std::string_view word) {
+                if (text_.substr(pos_, word.size()) != word) return false;
+                pos_ += word.size();
+                return true;
+            }
+
+            JsonValue parse_value() {
+                JsonValue value;
+                const char c = peek();
+                if (c == '{') {
+                    value.kind = JsonValue::Kind::OBJECT;
+                    ++pos_;
+                    if (peek() == '}') {
+                        ++pos_;
+                        return value;
+                    }
+                    while (true) {
+                        if (peek() != '"') error("expected an object key");
+                        value.keys.push_back(parse_string());
+                        expect(':');
+                        value.items.push_back(parse_value());
+                        if (peek() == ',') {
+                            ++pos_;
+                            continue;
+                        }
+                        expect('}');
+                        return value;
+                    }
+                }
+                if (c == '[') {
+                    value.kind = JsonValue::Kind::ARRAY;
+                    ++pos_;
+                    if (peek() == ']') {
+                        ++pos_;
+                        return value;
+                    }
+                    while (true) {
+                        value.items.push_back(parse_value());
+                        if (peek() == ',') {
+                            ++pos_;
+                            continue;
+                        }
+                        expect(']');
+                        return value;
+                    }
+                }
+                if (c == '"') {
+                    value.kind = JsonValue::Kind::STRING;
+                    value.string = parse_string();
+                    return value;
+                }
+                if (literal("true")) {
+                    value.kind = JsonValue::Kind::BOOLEAN;
+                    value.boolean = true;
+                    return value;
+                }
+                if (literal("false")) {
+                    value.kind = JsonValue::Kind::BOOLEAN;
+                    return value;
+                }
+                if (literal("null")) return value;
+                // Google Benchmark writes non-finite counters as NaN / Infinity
+                if (literal("NaN") || literal("-nan") || literal("nan")) {
+                    value.kind = JsonValue::Kind::NUMBER;
+                    value.number = std::numeric_limits<double>::quiet_NaN();
+                    return value;
+                }
+                value.kind = JsonValue::Kind::NUMBER;
+                value.number = parse_number();
+                return value;
+            }
+
+            double parse_number() {
+                const auto start = pos_;
+                while (pos_ < text_.size() && (std::isdigit(static_cast<unsigned char>(text_[pos_])) ||
+                                               text_[pos_] == '-' || text_[pos_] == '+' || text_[pos_] == '.' ||
+                                               text_[pos_] == 'e' || text_[pos_] == 'E')) {
+                    ++pos_;
+                }
+                if (start == pos_) error("unexpected character");
+                const std::string digits(text_.substr(start, pos_ - start));
+                char *end = nullptr;
+                const double number = std::strtod(digits.c_str(), &end);
+                if (end != digits.c_str() + digits.size()) error("malformed number");
+                return number;
+            }
+
+            std::string parse_string() {
+                expect('"');
+                std::string out;
+                while (true) {
+                    if (pos_ >= text_.size()) error("unterminated string");
+                    const char c = text_[pos_++];
+                    if (c == '"') return out;
+                    if (c != '\\') {
+                        out.push_back(c);
+                        continue;
+                    }
+                    if (pos_ >= text_.size()) error("unterminated escape");
+                    switch (const char e = text_[pos_++]) {
+                        case '"':
+                        case '\\':
+                        case '/': out.push_back(e);
+                            break;
+                        case 'b': out.push_back('\b');
+                            break;
+                        case 'f': out.push_back('\f');
+                            break;
+                        case 'n': out.push_back('\n');
+                            break;
+                        case 'r': out.push_back('\r');
+                            break;
+                        case 't': out.push_back('\t');
+                            break;
+                        case 'u': {
+                            if (pos_ + 4 > text_.size()) error("short \\u escape");
+                            const auto code = std::stoul(std::string(text_.substr(pos_, 4)), nullptr, 16);
+                            pos_ += 4;
+                            // Benchmark names are ASCII; anything else is kept as UTF-8 of the BMP code point
+                            if (code < 0x80) {
+                                out.push_back(static_cast<char>(code));
+                            } else if (code < 0x800) {
+                                out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                            } else {
+                                out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                                out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                                out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                            }
+                            break;
+                        }
+                        default: error("unknown escape");
+                    }
+                }
+            }
+
+            std::string_view text_;
+            std::size_t pos_ = 0;
+        };
+    }
+
+    const JsonValue *JsonValue::find(std::string_view key) const {
+        if (kind != Kind::OBJECT) return nullptr;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            if (keys[i] == key) return &items[i];
+        }
+        return nullptr;
+    }
+
+    double JsonValue::as_number(std::string_view what) const {
+        if (kind != Kind::NUMBER) throw std::runtime_error("JSON: " + std::string(what) + " is not a number");
+        return number;
+    }
+
+    const std::string &JsonValue::as_string(std::string_view what) const {
+        if (kind != Kind::STRING) throw std::runtime_error("JSON: " + std::string(what) + " is not a string");
+        return string;
+    }
+
+    JsonValue parse_json(std::string_view text) { return Parser(text).document(); }
+
+    JsonValue read_json_file(const std::string &path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("cannot open " + path);
+        std::ostringstream buffer;
+        buffer << in.rdbuf();
+        try {
+            return parse_json(buffer.str());
+        } catch (const std::runtime_error &e) {
+            throw std::runtime_error(path + ": " + e.what());
+        }
+    }
+
+    std::string json_quote(std::string_view s) {
+        std::string out = "\"";
+        for (const char c: s) {
+            if (c == '"' || c == '\\') {
+                out.push_back('\\');
+                out.push_back(c);
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                out += escaped;
+            } else {
+                out.push_back(c);
+            }
+        }
+        out.push_back('"');
+        return out;
+    }
+}
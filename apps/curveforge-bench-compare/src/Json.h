@@ -0,0 +1,47 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#ifndef CURVEFORGE_BENCH_JSON_H
+#define CURVEFORGE_BENCH_JSON_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace curve::bench {
+    /**
+     * @brief Minimal JSON document model, enough for Google Benchmark output and baseline files.
+     *
+     * Objects keep their keys in `keys`, parallel to `items`, so the type stays complete
+     * without pointer indirection.
+     */
+    struct JsonValue {
+        enum class Kind { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+        Kind kind = Kind::NUL;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<JsonValue> items; // array elements or object values
+        std::vector<std::string> keys; // object keys
+
+        // Member of an object, nullptr when absent or not an object
+        [[nodiscard]] const JsonValue *find(std::string_view key) const;
+
+        // Throw std::runtime_error naming `what` on a kind mismatch
+        [[nodiscard]] double as_number(std::string_view what) const;
+
+        [[nodiscard]] const std::string &as_string(std::string_view what) const;
+    };
+
+    // Throws std::runtime_error with the byte offset of the first syntax error.
+    JsonValue parse_json(std::string_view text);
+
+    JsonValue read_json_file(const std::string &path);
+
+    // Quotes and escapes `s` as a JSON string literal
+    std::string json_quote(std::string_view s);
+}
+
+#endif //CURVEFORGE_BENCH_JSON_H
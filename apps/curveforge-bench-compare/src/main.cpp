@@ -0,0 +1,112 @@
+//
+// Created by Francisco Nunez on 12.02.2026.
+//
+
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BenchmarkResults.h"
+#include "Comparison.h"
+
+namespace {
+    using namespace curve::bench;
+
+    const char *kUsage =
+            "usage: curveforge-bench-compare --baseline <baseline.json> [options] <run.json>...\n"
+            "\n"
+            "Compares Google Benchmark JSON output (run with --benchmark_repetitions, or several\n"
+            "runs) against a checked-in baseline using medians and median absolute deviations.\n"
+            "Exits 1 when a benchmark regressed.\n"
+            "\n"
+            "  --baseline <file>      baseline to compare against (or to write)\n"
+            "  --write-baseline       write the baseline from the runs instead of comparing;\n"
+            "                         per-benchmark tolerances of an existing baseline are kept\n"
+            "  --tolerance <frac>     default relative slowdown accepted, e.g. 0.10 (baseline value\n"
+            "                         when comparing, 0.10 when writing)\n"
+            "  --noise-sigmas <k>     width of the noise band in robust sigmas (default 3)\n"
+            "  --metric cpu|real      time to compare (default: the baseline's, cpu when writing)\n"
+            "  --fail-on-missing      fail when a baseline benchmark did not run\n"
+            "  --verbose              print every benchmark, not only the changed ones\n";
+
+    struct Options {
+        std::string baseline_path;
+        std::vector<std::string> runs;
+        bool write_baseline = false;
+        std::optional<double> tolerance;
+        std::optional<Metric> metric;
+        CompareOptions compare;
+        bool verbose = false;
+    };
+
+    Options parse(int argc, char *argv[]) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            const auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("missing value for " + std::string(arg));
+                return argv[++i];
+            };
+            if (arg == "--baseline") options.baseline_path = value();
+            else if (arg == "--write-baseline") options.write_baseline = true;
+            else if (arg == "--tolerance") options.tolerance = std::stod(value());
+            else if (arg == "--noise-sigmas") options.compare.noise_sigmas = std::stod(value());
+            else if (arg == "--fail-on-missing") options.compare.fail_on_missing = true;
+            else if (arg == "--verbose") options.verbose = true;
+            else if (arg == "--metric") {
+                const auto metric = value();
+                if (metric != "cpu" && metric != "real") throw std::invalid_argument("--metric is cpu or real");
+                options.metric = metric == "cpu" ? Metric::CPU_TIME : Metric::REAL_TIME;
+            } else if (arg.starts_with("--")) throw std::invalid_argument("unknown option " + std::string(arg));
+            else options.runs.emplace_back(arg);
+        }
+        if (options.baseline_path.empty()) throw std::invalid_argument("--baseline is required");
+        if (options.runs.empty()) throw std::invalid_argument("no benchmark JSON given");
+        if (options.tolerance && *options.tolerance < 0.0) throw std::invalid_argument("--tolerance must be >= 0");
+        return options;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parse(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-bench-compare: " << e.what() << "\n\n" << kUsage;
+        return 2;
+    }
+
+    try {
+        if (options.write_baseline) {
+            std::optional<Baseline> previous;
+            try {
+                previous = read_baseline(options.baseline_path);
+            } catch (const std::exception &) {
+                // first baseline
+            }
+            const auto metric = options.metric.value_or(previous ? previous->metric : Metric::CPU_TIME);
+            RunSamples samples;
+            for (const auto &run: options.runs) read_benchmark_json(run, metric, samples);
+            const auto tolerance = options.tolerance.value_or(previous ? previous->tolerance : 0.10);
+            write_baseline(options.baseline_path,
+                           make_baseline(samples, metric, tolerance, previous ? &*previous : nullptr));
+            std::cout << "bench-compare: wrote " << samples.size() << " benchmarks to " << options.baseline_path
+                    << '\n';
+            return 0;
+        }
+
+        auto baseline = read_baseline(options.baseline_path);
+        if (options.tolerance) baseline.tolerance = *options.tolerance;
+        RunSamples samples;
+        for (const auto &run: options.runs) read_benchmark_json(run, options.metric.value_or(baseline.metric), samples);
+        const auto report = compare(baseline, samples, options.compare);
+        print_report(std::cout, report, options.compare, options.verbose);
+        return report.failed(options.compare) ? 1 : 0;
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-bench-compare: " << e.what() << '\n';
+        return 2;
+    }
+}
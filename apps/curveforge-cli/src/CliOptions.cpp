@@ -0,0 +1,98 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#include "CliOptions.h"
+
+#include <charconv>
+#include <stdexcept>
+#include <string_view>
+
+namespace curve::cli {
+    namespace {
+        std::size_t positive_count(std::string_view flag, std::string_view value) {
+            std::size_t n = 0;
+            const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), n);
+            if (ec != std::errc{} || end != value.data() + value.size() || n == 0) {
+                throw std::invalid_argument(std::string(flag) + " expects a positive integer, got '" +
+                                            std::string(value) + "'");
+            }
+            return n;
+        }
+
+        // "EUR=EUR-ESTR" -> map["EUR"] = "EUR-ESTR"
+        void add_curve_mapping(std::string_view flag, std::string_view value,
+                               std::map<std::string, std::string> &mapping) {
+            const auto eq = value.find('=');
+            if (eq == std::string_view::npos || eq == 0 || eq + 1 == value.size()) {
+                throw std::invalid_argument(std::string(flag) + " expects CCY=CURVE_ID, got '" + std::string(value) +
+                                            "'");
+            }
+            mapping[std::string(value.substr(0, eq))] = std::string(value.substr(eq + 1));
+        }
+    }
+
+    CliOptions parse_options(int argc, const char *const argv[]) {
+        CliOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view flag = argv[i];
+            if (flag == "-h" || flag == "--help") {
+                options.help = true;
+                return options;
+            }
+            if (flag == "--numa") {
+                options.numa = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + std::string(flag));
+            }
+            const std::string_view value = argv[++i];
+            if (flag == "--portfolio") {
+                options.portfolio_path = value;
+            } else if (flag == "--market") {
+                options.market_path = value;
+            } else if (flag == "--output" || flag == "-o") {
+                options.output_path = value;
+            } else if (flag == "--format") {
+                if (value == "csv") options.format = OutputFormat::CSV;
+                else if (value == "columnar") options.format = OutputFormat::COLUMNAR;
+                else throw std::invalid_argument("unknown --format '" + std::string(value) + "'");
+            } else if (flag == "--threads") {
+                options.threads = positive_count(flag, value);
+            } else if (flag == "--chunk-size") {
+                options.chunk_size = positive_count(flag, value);
+            } else if (flag == "--discount") {
+                add_curve_mapping(flag, value, options.discount_curves);
+            } else if (flag == "--forward") {
+                add_curve_mapping(flag, value, options.forward_curves);
+            } else {
+                throw std::invalid_argument("unknown option " + std::string(flag));
+            }
+        }
+        if (options.portfolio_path.empty() || options.market_path.empty()) {
+            throw std::invalid_argument("--portfolio and --market are required");
+        }
+        if (options.format == OutputFormat::COLUMNAR && options.output_path == "-") {
+            throw std::invalid_argument("--format columnar needs an --output file");
+        }
+        if (options.threads == 0) options.threads = 1;
+        return options;
+    }
+
+    std::string usage() {
+        return "usage: curveforge-cli --portfolio <portfolio.xml> --market <snapshot> [options]\n"
+                "\n"
+                "  --market <file>        binary snapshot (CFSNAP) or marketdata.xsd document\n"
+                "  --output, -o <file>    result file, '-' for stdout (default, CSV only)\n"
+                "  --format csv|columnar  output format (default csv)\n"
+                "  --threads <n>          worker threads (default: hardware concurrency)\n"
+                "  --chunk-size <n>       trades per pricing task (default 256)\n"
+                "  --numa                 shard pricing by NUMA node, with node-local trade and curve copies\n"
+                "  --discount CCY=ID      discount curve for a currency (repeatable)\n"
+                "  --forward CCY=ID       forward curve for a currency (repeatable)\n"
+                "\n"
+                "Without --discount, a currency discounts on its OIS_ZERO curve (else its first curve);\n"
+                "without --forward, it projects on its first non-OIS curve (else the discount curve).\n";
+    }
+}
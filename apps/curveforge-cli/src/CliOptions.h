@@ -0,0 +1,38 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#ifndef CURVEFORGE_CLI_CLIOPTIONS_H
+#define CURVEFORGE_CLI_CLIOPTIONS_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <thread>
+
+namespace curve::cli {
+    enum class OutputFormat {
+        CSV, // one row per trade
+        COLUMNAR // binary, one contiguous block per column (see ResultWriter.h)
+    };
+
+    struct CliOptions {
+        std::string portfolio_path;
+        std::string market_path; // binary snapshot or marketdata.xsd document
+        std::string output_path = "-"; // "-": stdout (CSV only)
+        OutputFormat format = OutputFormat::CSV;
+        std::size_t threads = std::thread::hardware_concurrency();
+        std::size_t chunk_size = 256; // trades per pricing task
+        bool numa = false; // price on per-node pools and data copies (revalue_numa)
+        std::map<std::string, std::string> discount_curves; // currency -> curve id
+        std::map<std::string, std::string> forward_curves; // currency -> curve id
+        bool help = false;
+    };
+
+    // Throws std::invalid_argument with a user-facing message on bad usage.
+    CliOptions parse_options(int argc, const char *const argv[]);
+
+    std::string usage();
+}
+
+#endif //CURVEFORGE_CLI_CLIOPTIONS_H
@@ -0,0 +1,143 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#include "Market.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#include "io/BinarySnapshotFormat.h"
+#include "io/CurveBuilder.h"
+#include "io/StreamingSnapshotLoader.h"
+#include "io/SurfaceBuilder.h"
+#include "tasks/Parallel.h"
+
+namespace curve::cli {
+    namespace {
+        struct CurveInfo {
+            std::string id;
+            std::string currency;
+            std::string type;
+        };
+
+        bool is_binary_snapshot(const std::string &path) {
+            std::ifstream in(path, std::ios::binary);
+            if (!in) throw std::runtime_error("cannot open market file " + path);
+            char magic[sizeof(io::binary::kMagic)] = {};
+            in.read(magic, sizeof(magic));
+            return in.gcount() == sizeof(magic) && std::memcmp(magic, io::binary::kMagic, sizeof(magic)) == 0;
+        }
+
+        std::vector<CurveInfo> curve_infos(const MarketInput &input) {
+            std::vector<CurveInfo> infos;
+            if (input.mapped) {
+                for (std::size_t i = 0; i < input.mapped->yield_curve_count(); ++i) {
+                    const auto view = input.mapped->yield_curve(i);
+                    infos.push_back({
+                        std::string(view.curve_id()), std::string(view.currency()), std::string(view.curve_type())
+                    });
+                }
+            } else {
+                for (const auto &c: input.curves) infos.push_back({c.curve_id, c.currency, c.curve_type});
+            }
+            std::sort(infos.begin(), infos.end(), [](const CurveInfo &a, const CurveInfo &b) { return a.id < b.id; });
+            return infos;
+        }
+
+        // currency -> (discount curve id, forward curve id)
+        std::map<std::string, std::pair<std::string, std::string> > assign_curves(
+            const std::vector<CurveInfo> &infos, const CliOptions &options) {
+            std::map<std::string, std::string> first_ois, first_other; // by currency, infos are sorted by id
+            for (const auto &info: infos) {
+                (info.type == "OIS_ZERO" ? first_ois : first_other).try_emplace(info.currency, info.id);
+            }
+            std::map<std::string, std::pair<std::string, std::string> > roles;
+            for (const auto &info: infos) {
+                const auto ois = first_ois.find(info.currency);
+                const auto other = first_other.find(info.currency);
+                const auto &discount = ois != first_ois.end() ? ois->second : other->second;
+                roles[info.currency] = {discount, other != first_other.end() ? other->second : discount};
+            }
+
+            const auto known = [&](const std::string &id) {
+                return std::any_of(infos.begin(), infos.end(), [&](const CurveInfo &c) { return c.id == id; });
+            };
+            for (const auto &[currency, id]: options.discount_curves) {
+                if (!known(id)) throw std::invalid_argument("--discount: no curve " + id + " in the snapshot");
+                roles[currency].first = id;
+                if (roles[currency].second.empty()) roles[currency].second = id;
+            }
+            for (const auto &[currency, id]: options.forward_curves) {
+                if (!known(id)) throw std::invalid_argument("--forward: no curve " + id + " in the snapshot");
+                roles[currency].second = id;
+                if (roles[currency].first.empty()) roles[currency].first = id;
+            }
+            return roles;
+        }
+
+        std::shared_ptr<market::MarketData> market_data(
+            const io::SnapshotHeaderRecord &header, const io::YieldCurveMap &curves,
+            const std::map<std::string, std::pair<std::string, std::string> > &roles) {
+            auto md = std::make_shared<market::MarketData>();
+            md->snap_time = header.snapshot_time
+                                ? *header.snapshot_time
+                                : time::Instant{std::chrono::sys_days{header.as_of}};
+            for (const auto &[currency, role]: roles) {
+                md->curves_ois[currency] = curves.at(role.first);
+                md->curves_funding[currency] = curves.at(role.second);
+            }
+            return md;
+        }
+    }
+
+    MarketInput load_market(const std::string &path) {
+        MarketInput input;
+        if (is_binary_snapshot(path)) {
+            input.mapped = io::MappedSnapshot::open(path);
+            input.header = input.mapped->header();
+        } else {
+            auto loaded = io::StreamingSnapshotLoader::load_file(path);
+            input.header = std::move(loaded.header);
+            input.curves = std::move(loaded.yield_curves);
+            input.surfaces = std::move(loaded.vol_surfaces);
+        }
+        return input;
+    }
+
+    CalibratedMarket calibrate(MarketInput &input, const CliOptions &options) {
+        const auto build = [&](double shift) {
+            return input.mapped
+                       ? io::build_yield_curves(*input.mapped, options.threads, shift)
+                       : io::build_yield_curves(input.curves, options.threads, shift);
+        };
+        const auto base = build(0.0);
+        const auto up = build(kBumpSize);
+        const auto down = build(-kBumpSize);
+        const auto roles = assign_curves(curve_infos(input), options);
+
+        CalibratedMarket market;
+        market.header = input.header;
+        market.base = market_data(input.header, base, roles);
+        market.up = market_data(input.header, up, roles);
+        market.down = market_data(input.header, down, roles);
+        market.curve_count = base.size();
+
+        if (input.mapped) {
+            const auto &snapshot = *input.mapped;
+            std::vector<std::shared_ptr<volatility::ImpliedVolSurface> > built(snapshot.vol_surface_count());
+            tasks::parallel_for_bounded(built.size(), options.threads, [&](std::size_t i) {
+                built[i] = io::build_vol_surface(snapshot.vol_surface(i));
+            });
+            for (std::size_t i = 0; i < built.size(); ++i) {
+                market.surfaces.emplace(std::string(snapshot.vol_surface(i).underlying_id()), std::move(built[i]));
+            }
+        } else {
+            market.surfaces = std::move(input.surfaces);
+        }
+        return market;
+    }
+}
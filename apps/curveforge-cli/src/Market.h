@@ -0,0 +1,53 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#ifndef CURVEFORGE_CLI_MARKET_H
+#define CURVEFORGE_CLI_MARKET_H
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CliOptions.h"
+#include "io/BinarySnapshot.h"
+#include "io/SnapshotRecords.h"
+#include "market/marketdata.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::cli {
+    using VolSurfaceMap = std::map<std::string, std::shared_ptr<volatility::ImpliedVolSurface> >;
+
+    // Raw market snapshot as read from disk
+    struct MarketInput {
+        io::SnapshotHeaderRecord header;
+        std::optional<io::MappedSnapshot> mapped; // binary snapshots, curves / surfaces read in place
+        std::vector<io::YieldCurveRecord> curves; // XML snapshots
+        VolSurfaceMap surfaces; // XML snapshots: built while parsing
+    };
+
+    // Base market plus the zero curves shifted in parallel by +/- 1bp, for DV01 / gamma
+    struct CalibratedMarket {
+        io::SnapshotHeaderRecord header;
+        std::shared_ptr<market::MarketData> base;
+        std::shared_ptr<market::MarketData> up;
+        std::shared_ptr<market::MarketData> down;
+        VolSurfaceMap surfaces; // by underlying id (MarketData holds IVolatility, not these surfaces)
+        std::size_t curve_count = 0;
+    };
+
+    inline constexpr double kBumpSize = 1e-4;
+
+    // Binary snapshots are recognised by their magic, anything else is parsed as XML.
+    MarketInput load_market(const std::string &path);
+
+    /**
+     * @brief Builds the curves (three times: base, +1bp, -1bp) and the vol surfaces, and assigns
+     * discount / forward curves per currency (see usage()).
+     */
+    CalibratedMarket calibrate(MarketInput &input, const CliOptions &options);
+}
+
+#endif //CURVEFORGE_CLI_MARKET_H
@@ -0,0 +1,111 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#include "ResultWriter.h"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace curve::cli {
+    namespace {
+        template<typename T>
+        void put(std::ostream &out, const T &value) {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        void put_name(std::ostream &out, std::string_view name) {
+            put(out, static_cast<std::uint32_t>(name.size()));
+            out.write(name.data(), static_cast<std::streamsize>(name.size()));
+        }
+
+        void put_column(std::ostream &out, std::string_view name, const std::vector<double> &values) {
+            put_name(out, name);
+            put(out, std::uint8_t{0});
+            out.write(reinterpret_cast<const char *>(values.data()),
+                      static_cast<std::streamsize>(values.size() * sizeof(double)));
+        }
+
+        void put_column(std::ostream &out, std::string_view name, const std::vector<std::string> &values) {
+            put_name(out, name);
+            put(out, std::uint8_t{1});
+            std::vector<std::uint64_t> offsets;
+            offsets.reserve(values.size() + 1);
+            std::uint64_t offset = 0;
+            offsets.push_back(offset);
+            for (const auto &v: values) offsets.push_back(offset += v.size());
+            out.write(reinterpret_cast<const char *>(offsets.data()),
+                      static_cast<std::streamsize>(offsets.size() * sizeof(std::uint64_t)));
+            for (const auto &v: values) out.write(v.data(), static_cast<std::streamsize>(v.size()));
+        }
+
+        // CSV field, quoted when it contains a separator, quote or line break
+        void put_field(std::ostream &out, std::string_view field) {
+            if (field.find_first_of(",\"\n\r") == std::string_view::npos) {
+                out << field;
+                return;
+            }
+            out << '"';
+            for (const char c: field) {
+                if (c == '"') out << '"';
+                out << c;
+            }
+            out << '"';
+        }
+
+        void put_number(std::ostream &out, double value) {
+            if (!std::isnan(value)) out << value;
+        }
+    }
+
+    void write_csv(const RevaluationResults &results, std::ostream &out) {
+        out << "trade_id,pv,par_rate,annuity,dv01,gamma,error\n" << std::setprecision(17);
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            put_field(out, results.trade_ids[i]);
+            for (const auto *column: {
+                     &results.pv, &results.par_rate, &results.annuity, &results.dv01, &results.gamma
+                 }) {
+                out << ',';
+                put_number(out, (*column)[i]);
+            }
+            out << ',';
+            put_field(out, results.errors[i]);
+            out << '\n';
+        }
+    }
+
+    void write_columnar(const RevaluationResults &results, std::ostream &out) {
+        out.write(kColumnarMagic, sizeof(kColumnarMagic));
+        put(out, kColumnarVersion);
+        put(out, std::uint32_t{7});
+        put(out, static_cast<std::uint64_t>(results.size()));
+        put_column(out, "trade_id", results.trade_ids);
+        put_column(out, "pv", results.pv);
+        put_column(out, "par_rate", results.par_rate);
+        put_column(out, "annuity", results.annuity);
+        put_column(out, "dv01", results.dv01);
+        put_column(out, "gamma", results.gamma);
+        put_column(out, "error", results.errors);
+    }
+
+    void write_results(const RevaluationResults &results, const CliOptions &options) {
+        const auto write = [&](std::ostream &out) {
+            if (options.format == OutputFormat::COLUMNAR) write_columnar(results, out);
+            else write_csv(results, out);
+            out.flush();
+            if (!out) throw std::runtime_error("failed writing results to " + options.output_path);
+        };
+        if (options.output_path == "-") {
+            write(std::cout);
+            return;
+        }
+        std::ofstream out(options.output_path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("cannot open " + options.output_path);
+        write(out);
+    }
+}
@@ -0,0 +1,37 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#ifndef CURVEFORGE_CLI_RESULTWRITER_H
+#define CURVEFORGE_CLI_RESULTWRITER_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "CliOptions.h"
+#include "Revaluation.h"
+
+namespace curve::cli {
+    /**
+     * COLUMNAR layout (little endian):
+     *
+     *   char[8] "CFPVCOL\0" | u32 version | u32 column count | u64 row count
+     *   per column: u32 name length | name | u8 type (0: f64, 1: string) | data
+     *     f64:    row count doubles
+     *     string: (row count + 1) u64 offsets into the chars that follow | chars
+     *
+     * Columns: trade_id, pv, par_rate, annuity, dv01, gamma, error.
+     */
+    inline constexpr char kColumnarMagic[8] = {'C', 'F', 'P', 'V', 'C', 'O', 'L', '\0'};
+    inline constexpr std::uint32_t kColumnarVersion = 1;
+
+    void write_csv(const RevaluationResults &results, std::ostream &out);
+
+    void write_columnar(const RevaluationResults &results, std::ostream &out);
+
+    // Writes to options.output_path ("-": stdout) in options.format.
+    void write_results(const RevaluationResults &results, const CliOptions &options);
+}
+
+#endif //CURVEFORGE_CLI_RESULTWRITER_H
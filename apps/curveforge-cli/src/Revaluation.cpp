@@ -0,0 +1,185 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#include "Revaluation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <map>
+#include <thread>
+
+#include "pricing/FixFloatSwapPricer.h"
+#include "tasks/Parallel.h"
+#include "tasks/Topology.h"
+
+namespace curve::cli {
+    namespace {
+        struct SwapValue {
+            double pv;
+            double par_rate;
+            double annuity;
+        };
+
+        SwapValue value_swap(const pricing::FixFloatSwapPricer &pricer, const instruments::FixFloatSwap &swap,
+                             const instruments::SwapTradeInfo &info,
+                             const std::shared_ptr<market::MarketData> &md) {
+            const auto &fixed_leg = swap.leg1();
+            const auto &discount = *md->curves_ois.at(fixed_leg.currency());
+            double annuity = 0.0;
+            for (const auto &period: swap.get_leg1_payment_dates().accruals) {
+                annuity += period.accrual * discount.D(period.end_date);
+            }
+            const double par_rate = pricer.price(swap, md);
+            const double sign = info.pay_fixed ? 1.0 : -1.0;
+            return {sign * fixed_leg.notional() * annuity * (par_rate - info.fixed_rate), par_rate, annuity};
+        }
+
+        struct Scenarios {
+            std::shared_ptr<market::MarketData> base;
+            std::shared_ptr<market::MarketData> up;
+            std::shared_ptr<market::MarketData> down;
+        };
+
+        RevaluationResults empty_results(std::size_t n) {
+            constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+            RevaluationResults results;
+            results.trade_ids.resize(n);
+            results.pv.assign(n, nan);
+            results.par_rate.assign(n, nan);
+            results.annuity.assign(n, nan);
+            results.dv01.assign(n, nan);
+            results.gamma.assign(n, nan);
+            results.errors.resize(n);
+            return results;
+        }
+
+        void price_row(const pricing::FixFloatSwapPricer &pricer, const instruments::InstrumentStore &store,
+                       std::size_t slot, const Scenarios &scenarios, RevaluationResults &results, std::size_t row) {
+            const auto &info = store.trade_info(slot);
+            const auto &swap = *store.fix_float_swap(slot);
+            results.trade_ids[row] = info.trade_id;
+            try {
+                const auto base = value_swap(pricer, swap, info, scenarios.base);
+                const auto up = value_swap(pricer, swap, info, scenarios.up).pv;
+                const auto down = value_swap(pricer, swap, info, scenarios.down).pv;
+                results.pv[row] = base.pv;
+                results.par_rate[row] = base.par_rate;
+                results.annuity[row] = base.annuity;
+                results.dv01[row] = 0.5 * (up - down);
+                results.gamma[row] = up - 2.0 * base.pv + down;
+            } catch (const std::exception &e) {
+                results.errors[row] = e.what();
+            }
+        }
+
+        void count_failures(RevaluationResults &results) {
+            results.failed = static_cast<std::size_t>(std::count_if(results.errors.begin(), results.errors.end(),
+                                                                    [](const std::string &e) { return !e.empty(); }));
+        }
+
+        // Copy of md whose curves are clones made by the calling thread; a curve used twice is cloned once
+        std::shared_ptr<market::MarketData> replicate(const market::MarketData &md) {
+            auto copy = std::make_shared<market::MarketData>(md);
+            std::map<const ICurve *, std::shared_ptr<ICurve> > clones;
+            for (auto *curves: {&copy->curves_ois, &copy->curves_funding}) {
+                for (auto &[currency, curve]: *curves) {
+                    auto &clone = clones[curve.get()];
+                    if (!clone) clone = curve->clone();
+                    curve = clone;
+                }
+            }
+            return copy;
+        }
+    }
+
+    PricingPlan schedule(const instruments::InstrumentStore &store, std::size_t chunk_size) {
+        PricingPlan plan;
+        plan.chunk_size = std::max<std::size_t>(1, chunk_size);
+        plan.slots.reserve(store.size());
+        std::vector<std::string> currencies(store.slot_count());
+        for (std::size_t slot = 0; slot < store.slot_count(); ++slot) {
+            if (const auto *swap = store.fix_float_swap(slot)) {
+                plan.slots.push_back(slot);
+                currencies[slot] = swap->currency();
+            }
+        }
+        std::stable_sort(plan.slots.begin(), plan.slots.end(), [&](std::size_t a, std::size_t b) {
+            return currencies[a] < currencies[b];
+        });
+        return plan;
+    }
+
+    RevaluationResults revalue(const instruments::InstrumentStore &store, const PricingPlan &plan,
+                               const CalibratedMarket &market, std::size_t threads) {
+        const auto n = plan.slots.size();
+        auto results = empty_results(n);
+        const pricing::FixFloatSwapPricer pricer;
+        const Scenarios scenarios{market.base, market.up, market.down};
+        tasks::parallel_for_bounded(plan.chunk_count(), threads, [&](std::size_t chunk) {
+            const auto begin = chunk * plan.chunk_size;
+            const auto end = std::min(n, begin + plan.chunk_size);
+            for (std::size_t row = begin; row < end; ++row) {
+                price_row(pricer, store, plan.slots[row], scenarios, results, row);
+            }
+        });
+        count_failures(results);
+        return results;
+    }
+
+    RevaluationResults revalue_numa(const instruments::InstrumentStore &store, const PricingPlan &plan,
+                                    const CalibratedMarket &market, std::size_t threads) {
+        const auto n = plan.slots.size();
+        auto results = empty_results(n);
+        auto nodes = tasks::numa_nodes();
+        threads = std::max<std::size_t>(1, threads);
+        if (nodes.size() > threads) nodes.resize(threads);
+
+        // Node k gets threads_of(k) threads and the rows [first_row[k], first_row[k + 1])
+        const auto node_count = nodes.size();
+        const auto threads_of = [&](std::size_t k) { return threads / node_count + (k < threads % node_count); };
+        std::vector<std::size_t> first_row(node_count + 1, 0);
+        for (std::size_t k = 0, assigned = 0; k < node_count; ++k) {
+            assigned += threads_of(k);
+            first_row[k + 1] = n * assigned / threads;
+        }
+
+        std::vector<std::exception_ptr> errors(node_count);
+        std::vector<std::thread> drivers;
+        drivers.reserve(node_count);
+        for (std::size_t k = 0; k < node_count; ++k) {
+            drivers.emplace_back([&, k] {
+                try {
+                    const auto &cpus = nodes[k].cpus;
+                    tasks::pin_current_thread(cpus);
+                    // From here on, allocations land on node k
+                    const std::vector<std::size_t> slots(plan.slots.begin() + static_cast<std::ptrdiff_t>(first_row[k]),
+                                                         plan.slots.begin() + static_cast<std::ptrdiff_t>(first_row[k + 1]));
+                    const auto shard = store.shard(slots);
+                    const Scenarios scenarios{replicate(*market.base), replicate(*market.up), replicate(*market.down)};
+                    const pricing::FixFloatSwapPricer pricer;
+                    // This thread waits, and so prices, alongside the node's workers
+                    tasks::Scheduler scheduler({threads_of(k), cpus});
+                    const auto chunks = (slots.size() + plan.chunk_size - 1) / plan.chunk_size;
+                    tasks::parallel_for_bounded(scheduler, chunks, threads_of(k), [&](std::size_t chunk) {
+                        const auto begin = chunk * plan.chunk_size;
+                        const auto end = std::min(slots.size(), begin + plan.chunk_size);
+                        for (std::size_t i = begin; i < end; ++i) {
+                            price_row(pricer, shard, i, scenarios, results, first_row[k] + i);
+                        }
+                    });
+                } catch (...) {
+                    errors[k] = std::current_exception();
+                }
+            });
+        }
+        for (auto &driver: drivers) driver.join();
+        for (const auto &error: errors) {
+            if (error) std::rethrow_exception(error);
+        }
+        count_failures(results);
+        return results;
+    }
+}
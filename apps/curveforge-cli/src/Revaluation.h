@@ -0,0 +1,64 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#ifndef CURVEFORGE_CLI_REVALUATION_H
+#define CURVEFORGE_CLI_REVALUATION_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Market.h"
+#include "instruments/InstrumentStore.h"
+
+namespace curve::cli {
+    // Order in which the store's trades are priced, cut into chunks of chunk_size trades.
+    struct PricingPlan {
+        std::vector<std::size_t> slots;
+        std::size_t chunk_size = 1;
+
+        [[nodiscard]] std::size_t chunk_count() const { return (slots.size() + chunk_size - 1) / chunk_size; }
+    };
+
+    // Results as columns, row i belongs to plan.slots[i]. Failed trades carry NaN values and a message.
+    struct RevaluationResults {
+        std::vector<std::string> trade_ids;
+        std::vector<double> pv;
+        std::vector<double> par_rate;
+        std::vector<double> annuity;
+        std::vector<double> dv01; // pv change for a +1bp parallel zero shift (central difference)
+        std::vector<double> gamma; // second difference for +/- 1bp
+        std::vector<std::string> errors; // empty when priced
+        std::size_t failed = 0;
+
+        [[nodiscard]] std::size_t size() const { return trade_ids.size(); }
+    };
+
+    // Groups trades by currency so consecutive trades of a chunk read the same curves.
+    PricingPlan schedule(const instruments::InstrumentStore &store, std::size_t chunk_size);
+
+    /**
+     * @brief Prices every trade of the plan, one chunk per task on up to `threads` threads.
+     *
+     * A fix/float swap is worth sign * N * annuity * (par - K), with the par rate from
+     * FixFloatSwapPricer, the annuity on the fixed leg's discount curve and sign +1 when paying
+     * fixed. Pricing errors are recorded per trade and do not stop the batch.
+     */
+    RevaluationResults revalue(const instruments::InstrumentStore &store, const PricingPlan &plan,
+                               const CalibratedMarket &market, std::size_t threads);
+
+    /**
+     * @brief revalue() for multi-socket hosts: one shard of the plan per NUMA node.
+     *
+     * The threads are split evenly over the nodes (at most one node per thread) and the plan's
+     * rows in proportion. Per node, a driver thread pinned to the node's cpus copies the shard's
+     * trades with their schedules and the base / bumped curves, then prices the shard on a
+     * scheduler whose workers are pinned to the same cpus. First-touch placement thus keeps
+     * every trade and curve a worker reads in its local memory. Same results as revalue().
+     */
+    RevaluationResults revalue_numa(const instruments::InstrumentStore &store, const PricingPlan &plan,
+                                    const CalibratedMarket &market, std::size_t threads);
+}
+
+#endif //CURVEFORGE_CLI_REVALUATION_H
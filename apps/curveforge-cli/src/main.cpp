@@ -0,0 +1,110 @@
+//
+// Created by Francisco Nunez on 07.02.2026.
+//
+
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "CliOptions.h"
+#include "Market.h"
+#include "ResultWriter.h"
+#include "Revaluation.h"
+#include "instruments/StaticDataCache.h"
+#include "io/PortfolioLoader.h"
+#include "tasks/Scheduler.h"
+#include "tasks/ScratchArena.h"
+
+namespace {
+    using namespace curve;
+
+    // Wall time per batch stage, reported on stderr so stdout can carry the CSV.
+    class StageTimer {
+    public:
+        template<typename F>
+        decltype(auto) run(const char *stage, F &&f) {
+            const auto start = std::chrono::steady_clock::now();
+            struct Record {
+                StageTimer &timer;
+                const char *stage;
+                std::chrono::steady_clock::time_point start;
+
+                ~Record() {
+                    timer.stages_.emplace_back(stage, std::chrono::duration<double, std::milli>(
+                                                          std::chrono::steady_clock::now() - start).count());
+                }
+            } record{*this, stage, start};
+            return f();
+        }
+
+        void report(std::ostream &out) const {
+            double total = 0.0;
+            char line[64];
+            for (const auto &[stage, ms]: stages_) {
+                std::snprintf(line, sizeof(line), "  %-10s %12.1f ms\n", stage.c_str(), ms);
+                out << line;
+                total += ms;
+            }
+            std::snprintf(line, sizeof(line), "  %-10s %12.1f ms\n", "total", total);
+            out << line;
+        }
+
+    private:
+        std::vector<std::pair<std::string, double> > stages_;
+    };
+}
+
+int main(int argc, char *argv[]) {
+    cli::CliOptions options;
+    try {
+        options = cli::parse_options(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-cli: " << e.what() << "\n\n" << cli::usage();
+        return 2;
+    }
+    if (options.help) {
+        std::cout << cli::usage();
+        return 0;
+    }
+
+    try {
+        // Loading, calibration and pricing all share one pool of --threads threads (--numa: per-node pools price)
+        tasks::Scheduler::configure({options.threads, {}});
+        StageTimer timer;
+        instruments::StaticDataCache cache;
+        io::PortfolioLoadOptions load_options;
+        load_options.threads = options.threads;
+
+        auto [portfolio, market_input] = timer.run("load", [&] {
+            return std::make_pair(io::PortfolioLoader::load_file(options.portfolio_path, cache, load_options),
+                                  cli::load_market(options.market_path));
+        });
+        const auto market = timer.run("calibrate", [&] { return cli::calibrate(market_input, options); });
+        const auto plan = timer.run("schedule", [&] { return cli::schedule(portfolio.store, options.chunk_size); });
+        const auto results = timer.run("price", [&] {
+            return options.numa
+                       ? cli::revalue_numa(portfolio.store, plan, market, options.threads)
+                       : cli::revalue(portfolio.store, plan, market, options.threads);
+        });
+        timer.run("write", [&] { cli::write_results(results, options); });
+
+        std::cerr << "curveforge-cli: " << portfolio.trades_read << " trades read, " << results.size() << " priced ("
+                << results.failed << " failed), " << portfolio.errors.size() << " not built";
+        for (const auto &[type, count]: portfolio.unsupported) std::cerr << ", " << count << " " << type << " skipped";
+        std::cerr << "\n  " << market.curve_count << " curves, " << market.surfaces.size() << " surfaces, "
+                << plan.chunk_count() << " chunks of " << plan.chunk_size << " on " << options.threads
+                << " threads" << (options.numa ? " (NUMA sharded)" : "") << '\n';
+        const auto arenas = tasks::ScratchArena::totals();
+        std::cerr << "  scratch arenas: " << arenas.allocations << " allocations (" << arenas.bytes
+                << " bytes), " << arenas.upstream_allocations << " heap spills, high water " << arenas.high_water
+                << " bytes\n";
+        timer.report(std::cerr);
+        return results.failed == 0 ? 0 : 1;
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-cli: " << e.what() << '\n';
+        return 1;
+    }
+}
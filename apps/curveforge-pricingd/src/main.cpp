@@ -0,0 +1,129 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#include <algorithm>
+#include <csignal>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <optional>
+#include <pthread.h>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "io/BinarySnapshot.h"
+#include "ipc/PricingServer.h"
+#include "ipc/SharedCurves.h"
+#include "tasks/Scheduler.h"
+
+namespace {
+    using namespace curve;
+
+    struct Options {
+        std::string socket_path = "/tmp/curveforge-pricing.sock";
+        std::string market_path;
+        std::string shm_name; // also publish the curves to this shared-memory segment
+        std::size_t threads = std::thread::hardware_concurrency();
+    };
+
+    const char *kUsage =
+            "usage: curveforge-pricingd --market <snapshot.cfsnap> [--socket <path>] [--shm <name>]\n"
+            "                           [--threads <n>]\n"
+            "\n"
+            "Serves discount factors, forwards, swap par rates, option prices and implied vols\n"
+            "from the calibrated snapshot. SIGHUP reloads the snapshot, SIGINT/SIGTERM stop.\n"
+            "With --shm the calibrated curves are also published to that POSIX shared-memory\n"
+            "segment for SharedCurveReader.\n";
+
+    Options parse(int argc, char *argv[]) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view flag = argv[i];
+            if (i + 1 >= argc) throw std::invalid_argument("missing value for " + std::string(flag));
+            const std::string value = argv[++i];
+            if (flag == "--socket") options.socket_path = value;
+            else if (flag == "--market") options.market_path = value;
+            else if (flag == "--shm") options.shm_name = value;
+            else if (flag == "--threads") options.threads = std::max(1, std::stoi(value));
+            else throw std::invalid_argument("unknown option " + std::string(flag));
+        }
+        if (options.market_path.empty()) throw std::invalid_argument("--market is required");
+        return options;
+    }
+
+    std::uint64_t load(const Options &options, ipc::MarketPublisher &publisher,
+                       std::optional<ipc::SharedCurvePublisher> &shared) {
+        const auto snapshot = io::MappedSnapshot::open(options.market_path);
+        auto market = ipc::PricingMarket::from_snapshot(snapshot, options.threads);
+        if (shared) {
+            for (const auto &[id, curve]: market->curves) shared->publish(id, *curve);
+        }
+        return publisher.publish(std::move(market));
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parse(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-pricingd: " << e.what() << "\n\n" << kUsage;
+        return 2;
+    }
+
+    // Signals are taken synchronously by the control thread
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGHUP);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+    std::signal(SIGPIPE, SIG_IGN);
+
+    try {
+        // Started after the mask so no calibration worker can take the signals
+        tasks::Scheduler::configure({options.threads, {}});
+        ipc::MarketPublisher publisher;
+        std::optional<ipc::SharedCurvePublisher> shared;
+        if (!options.shm_name.empty()) shared.emplace(ipc::SharedCurvePublisher::create(options.shm_name));
+        const auto version = load(options, publisher, shared);
+        ipc::PricingServer server(options.socket_path, publisher);
+        std::cerr << "curveforge-pricingd: market v" << version << " from " << options.market_path
+                << ", listening on " << options.socket_path << '\n';
+
+        std::thread control([&] {
+            while (true) {
+                int signal = 0;
+                if (sigwait(&signals, &signal) != 0) continue;
+                if (signal != SIGHUP) break;
+                try {
+                    std::cerr << "curveforge-pricingd: reloaded market v" << load(options, publisher, shared) << '\n';
+                } catch (const std::exception &e) {
+                    std::cerr << "curveforge-pricingd: reload failed, keeping the current market: " << e.what()
+                            << '\n';
+                }
+            }
+            server.stop();
+        });
+        std::exception_ptr error;
+        try {
+            server.run();
+        } catch (...) {
+            error = std::current_exception();
+            pthread_kill(control.native_handle(), SIGTERM);
+        }
+        control.join();
+        if (error) std::rethrow_exception(error);
+
+        const auto stats = server.stats();
+        std::cerr << "curveforge-pricingd: served " << stats.requests << " requests in " << stats.batches
+                << " batches over " << stats.connections << " connections\n";
+        return 0;
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-pricingd: " << e.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,169 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <sys/resource.h>
+
+#include "io/BinarySnapshot.h"
+#include "io/ParseUtils.h"
+#include "io/QuoteHistory.h"
+#include "io/XmlWriters.h"
+#include "synthetic/Generators.h"
+
+namespace {
+    using namespace curve;
+    namespace fs = std::filesystem;
+
+    struct Options {
+        fs::path out;
+        std::size_t trades = 10000;
+        synthetic::MarketOptions market;
+        synthetic::QuoteHistoryOptions history;
+        double forward_start_share = 0.2;
+    };
+
+    const char *kUsage =
+            "usage: curveforge-synth --out <dir> [--trades <n>] [--seed <n>] [--as-of YYYY-MM-DD]\n"
+            "                        [--currencies EUR,USD,...] [--underlyings <n>]\n"
+            "                        [--history-days <n>] [--ticks <n>] [--forward-share <x>]\n"
+            "\n"
+            "Writes a reproducible synthetic dataset into <dir>:\n"
+            "  portfolio.xml   <n> IRSwap trades (portfolio.xsd), default 10000\n"
+            "  market.xml      curves, vol surfaces and quote sets (marketdata.xsd)\n"
+            "  market.cfsnap   the same market as a binary snapshot\n"
+            "  quotes.cfqh     intraday swap quote history (skipped with --history-days 0)\n"
+            "The same options and seed always produce the same files.\n";
+
+    std::vector<std::string> split_list(std::string_view s) {
+        std::vector<std::string> items;
+        std::size_t start = 0;
+        while (start <= s.size()) {
+            const auto comma = s.find(',', start);
+            const auto item = s.substr(start, comma == std::string_view::npos ? std::string_view::npos : comma - start);
+            if (!item.empty()) items.emplace_back(item);
+            if (comma == std::string_view::npos) break;
+            start = comma + 1;
+        }
+        return items;
+    }
+
+    Options parse(int argc, char *argv[]) {
+        Options options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view flag = argv[i];
+            if (flag == "-h" || flag == "--help") {
+                std::cout << kUsage;
+                std::exit(0);
+            }
+            if (i + 1 >= argc) throw std::invalid_argument("missing value for " + std::string(flag));
+            const std::string value = argv[++i];
+            if (flag == "--out") options.out = value;
+            else if (flag == "--trades") options.trades = std::stoull(value);
+            else if (flag == "--seed") options.market.seed = std::stoull(value);
+            else if (flag == "--as-of") options.market.as_of = io::parse_date(value);
+            else if (flag == "--currencies") options.market.currencies = split_list(value);
+            else if (flag == "--underlyings") options.market.underlyings = std::stoull(value);
+            else if (flag == "--history-days") options.history.days = std::stoull(value);
+            else if (flag == "--ticks") options.history.ticks_per_day = std::stoull(value);
+            else if (flag == "--forward-share") options.forward_start_share = std::stod(value);
+            else throw std::invalid_argument("unknown option " + std::string(flag));
+        }
+        if (options.out.empty()) throw std::invalid_argument("--out is required");
+        for (const auto &c: options.market.currencies) (void) synthetic::currency_profile(c);
+        return options;
+    }
+
+    // Peak resident set size in MiB
+    double peak_rss_mib() {
+        rusage usage{};
+        getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+        return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+        return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#endif
+    }
+
+    template<typename F>
+    void step(const fs::path &file, const std::string &what, F &&write) {
+        const auto start = std::chrono::steady_clock::now();
+        write();
+        const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << std::left << std::setw(16) << file.filename().string() << std::right << std::fixed
+                << std::setprecision(1) << std::setw(10)
+                << static_cast<double>(fs::file_size(file)) / (1024.0 * 1024.0) << " MiB " << std::setprecision(3)
+                << std::setw(9) << seconds << " s  " << what << '\n';
+    }
+}
+
+int main(int argc, char *argv[]) {
+    Options options;
+    try {
+        options = parse(argc, argv);
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-synth: " << e.what() << "\n\n" << kUsage;
+        return 2;
+    }
+
+    try {
+        fs::create_directories(options.out);
+        const auto &market = options.market;
+
+        // Trades are streamed: memory stays flat whatever the book size
+        const auto portfolio = options.out / "portfolio.xml";
+        step(portfolio, std::to_string(options.trades) + " swaps", [&] {
+            synthetic::PortfolioOptions book;
+            book.seed = market.seed;
+            book.as_of = market.as_of;
+            book.currencies = market.currencies;
+            book.forward_start_share = options.forward_start_share;
+            const synthetic::SwapGenerator generator(book);
+
+            std::ofstream out(portfolio, std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("cannot open " + portfolio.string());
+            io::PortfolioXmlWriter writer(out, "Synthetic book", "SYNTH-" + std::to_string(market.seed));
+            for (std::size_t i = 0; i < options.trades; ++i) writer.add(generator.trade(i));
+            writer.finish();
+            if (!out.flush()) throw std::runtime_error("failed writing " + portfolio.string());
+        });
+
+        const auto snapshot = synthetic::generate_snapshot(market);
+        std::ostringstream summary;
+        summary << snapshot.yield_curves.size() << " curves, " << snapshot.vol_surfaces.size() << " surfaces, "
+                << snapshot.quote_sets.back().instruments.size() << " option quotes";
+        step(options.out / "market.xml", summary.str(), [&] {
+            io::MarketDataXmlWriter::write_file(snapshot, (options.out / "market.xml").string());
+        });
+        step(options.out / "market.cfsnap", "binary snapshot", [&] {
+            io::BinarySnapshotWriter::write_file(snapshot, (options.out / "market.cfsnap").string());
+        });
+
+        if (options.history.days > 0) {
+            const auto history = options.out / "quotes.cfqh";
+            fs::remove(history); // the writer appends to an existing file
+            std::size_t quotes = 0;
+            step(history, std::to_string(options.history.days) + " days", [&] {
+                auto writer = io::QuoteHistoryWriter::open(history.string());
+                quotes = synthetic::generate_quote_history(market, options.history, [&](const io::QuoteSetRecord &set) {
+                    writer.append(set);
+                });
+            });
+            std::cout << "                " << quotes << " quotes\n";
+        }
+        std::cout << "peak RSS " << std::setprecision(1) << peak_rss_mib() << " MiB\n";
+    } catch (const std::exception &e) {
+        std::cerr << "curveforge-synth: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
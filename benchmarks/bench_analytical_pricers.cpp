@@ -0,0 +1,80 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "analytical_pricers/BlackScholes.h"
+
+namespace {
+    using curve::analytical_pricers::BlackScholes;
+
+    constexpr double kSpot = 100.0;
+    constexpr double kRate = 0.03;
+    constexpr double kVol = 0.22;
+
+    // Strikes from 70 to 130 so both the wings and the money are exercised
+    std::vector<double> strikes() {
+        std::vector<double> out;
+        for (double k = 70.0; k <= 130.0; k += 2.5) out.push_back(k);
+        return out;
+    }
+
+    void BM_BlackScholes_call_price(benchmark::State &state) {
+        const auto ks = strikes();
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(BlackScholes::call_price(kSpot, ks[i], kRate, kVol, 1.0));
+            if (++i == ks.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_BlackScholes_call_price);
+
+    void BM_BlackScholes_put_price(benchmark::State &state) {
+        const auto ks = strikes();
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(BlackScholes::put_price(kSpot, ks[i], kRate, kVol, 1.0));
+            if (++i == ks.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_BlackScholes_put_price);
+
+    std::vector<double> call_prices(const std::vector<double> &ks) {
+        std::vector<double> prices;
+        for (const double k: ks) prices.push_back(BlackScholes::call_price(kSpot, k, kRate, kVol, 1.0));
+        return prices;
+    }
+
+    void BM_BlackScholes_implied_volatility(benchmark::State &state) {
+        const auto ks = strikes();
+        const auto prices = call_prices(ks);
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(BlackScholes::implied_volatility(prices[i], kSpot, ks[i], kRate, 1.0));
+            if (++i == ks.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_BlackScholes_implied_volatility);
+
+    void BM_BlackScholes_implied_volatility_brent(benchmark::State &state) {
+        const auto ks = strikes();
+        const auto prices = call_prices(ks);
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(BlackScholes::implied_volatility_brent(prices[i], kSpot, ks[i], kRate, 1.0));
+            if (++i == ks.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_BlackScholes_implied_volatility_brent);
+}
@@ -0,0 +1,115 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "curve/FlatRateCurve.h"
+#include "curve/InterpolatedZeroCurve.h"
+#include "curve/NelsonSiegelSvenssonCurve.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve;
+
+    const time::Date kCob{year{2026}, February, day{11}};
+
+    time::Date plus_days(const time::Date &d, int n) { return time::Date{sys_days(d) + days{n}}; }
+
+    // 20 pillars from 1M to 30Y
+    InterpolatedZeroCurve make_curve(InterpolationMode mode) {
+        std::vector<Pillar> pillars;
+        const int months_out[] = {1, 3, 6, 9, 12, 18, 24, 36, 48, 60, 72, 84, 96, 108, 120, 144, 180, 240, 300, 360};
+        double zero = 0.02;
+        for (const int m: months_out) {
+            pillars.emplace_back(time::Date{sys_days(kCob + months{m})}, zero);
+            zero += 0.0004;
+        }
+        return {"BENCH", kCob, std::move(pillars),
+                time::create_daycount_convention(time::DayCountConvention::ACT_365F), mode};
+    }
+
+    // Query dates spread over the whole curve so the pillar search is not always the same
+    std::vector<time::Date> query_dates() {
+        std::vector<time::Date> dates;
+        for (int d = 0; d < 11000; d += 37) dates.push_back(plus_days(kCob, d));
+        return dates;
+    }
+
+    void BM_ICurve_D(benchmark::State &state) {
+        const auto curve = make_curve(static_cast<InterpolationMode>(state.range(0)));
+        const auto dates = query_dates();
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(curve.D(dates[i]));
+            if (++i == dates.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_ICurve_D)->ArgName("mode")->DenseRange(0, 2);
+
+    void BM_ICurve_F(benchmark::State &state) {
+        const auto curve = make_curve(static_cast<InterpolationMode>(state.range(0)));
+        const auto dates = query_dates();
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(curve.F(dates[i], plus_days(dates[i], 182)));
+            if (++i == dates.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_ICurve_F)->ArgName("mode")->DenseRange(0, 2);
+
+    void BM_FlatRateCurve_D(benchmark::State &state) {
+        const FlatRateCurve curve(kCob, 0.03);
+        const auto dates = query_dates();
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(curve.D(dates[i]));
+            if (++i == dates.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_FlatRateCurve_D);
+
+    void BM_NelsonSiegelSvenssonCurve_D(benchmark::State &state) {
+        const NelsonSiegelSvenssonCurve curve("BENCH", kCob, {
+                                                  .beta0 = 0.04, .beta1 = -0.015, .beta2 = 0.02, .beta3 = -0.01,
+                                                  .tau1 = 1.8, .tau2 = 7.5
+                                              });
+        const auto dates = query_dates();
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(curve.D(dates[i]));
+            if (++i == dates.size()) i = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_NelsonSiegelSvenssonCurve_D);
+
+    // Whole query set per call: kind dispatch once per batch instead of once per date
+    void BM_ICurve_D_batch(benchmark::State &state) {
+        const FlatRateCurve flat(kCob, 0.03);
+        const auto interpolated = make_curve(InterpolationMode::LINEAR_ZERO);
+        const auto kind = static_cast<CurveKind>(state.range(0));
+        const ICurve &curve = kind == CurveKind::FLAT ? static_cast<const ICurve &>(flat) : interpolated;
+        const auto dates = query_dates();
+        std::vector<double> out(dates.size());
+        for (auto _: state) {
+            curve.D(dates, out);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(dates.size()));
+    }
+
+    BENCHMARK(BM_ICurve_D_batch)->ArgName("kind")->DenseRange(0, 1);
+}
@@ -0,0 +1,67 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "curve_fitting/NssFitter.h"
+
+namespace {
+    using namespace curve;
+    using namespace curve::fitting;
+
+    // A drifting Nelson–Siegel–Svensson curve sampled at 14 maturities with 1bp noise, one entry per day
+    std::vector<std::vector<NssObservation> > yield_history(int days) {
+        const double maturities[] = {0.25, 0.5, 1, 2, 3, 4, 5, 7, 10, 12, 15, 20, 25, 30};
+        std::mt19937_64 rng(42);
+        std::normal_distribution<double> noise(0.0, 1e-4);
+        std::vector<std::vector<NssObservation> > panel(static_cast<std::size_t>(days));
+        for (int day = 0; day < days; ++day) {
+            const NssParameters p{
+                .beta0 = 0.035 + 0.01 * std::sin(day / 40.0), .beta1 = -0.02 + 0.015 * std::cos(day / 55.0),
+                .beta2 = 0.015, .beta3 = -0.01, .tau1 = 1.0 + 0.8 * (1.0 + std::sin(day / 30.0)), .tau2 = 9.0
+            };
+            for (const double t: maturities) panel[day].push_back({t, nss_zero_rate(p, t) + noise(rng)});
+        }
+        return panel;
+    }
+
+    void BM_fit_nss(benchmark::State &state) {
+        const auto panel = yield_history(64);
+        std::size_t day = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(fit_nss(panel[day]));
+            if (++day == panel.size()) day = 0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_fit_nss);
+
+    void BM_fit_nss_panel(benchmark::State &state) {
+        const auto panel = yield_history(static_cast<int>(state.range(0)));
+        for (auto _: state) benchmark::DoNotOptimize(fit_nss_panel(panel));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_fit_nss_panel)->ArgName("days")->Arg(250)->Arg(2500)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+    void BM_nss_discount_factors(benchmark::State &state) {
+        const NssParameters p{.beta0 = 0.04, .beta1 = -0.015, .beta2 = 0.02, .beta3 = -0.01, .tau1 = 1.8, .tau2 = 7.5};
+        std::vector<double> times;
+        for (int d = 0; d < 11000; d += 37) times.push_back(d / 365.0);
+        std::vector<double> out(times.size());
+        for (auto _: state) {
+            nss_discount_factors(p, times, out);
+            benchmark::DoNotOptimize(out.data());
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(times.size()));
+    }
+
+    BENCHMARK(BM_nss_discount_factors);
+}
@@ -0,0 +1,58 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <benchmark/benchmark.h>
+
+#include "interpolation/bspline.h"
+
+namespace {
+    // Points on a smooth 2-D curve; argument: number of points
+    std::vector<Eigen::VectorXd> sample_points(std::size_t count) {
+        std::vector<Eigen::VectorXd> points;
+        for (std::size_t i = 0; i < count; ++i) {
+            const double x = static_cast<double>(i) / static_cast<double>(count - 1);
+            Eigen::VectorXd p(2);
+            p << x, std::sin(6.0 * x) + 0.1 * x;
+            points.push_back(p);
+        }
+        return points;
+    }
+
+    void BM_bspline_evaluate(benchmark::State &state) {
+        const auto spline = interpolation::bspline::interpolate(sample_points(state.range(0)), 3);
+        double u = 0.0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(spline->evaluate(u));
+            u += 0.0137;
+            if (u > 1.0) u -= 1.0;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_bspline_evaluate)->ArgName("points")->Arg(8)->Arg(32)->Arg(128);
+
+    void BM_bspline_interpolate(benchmark::State &state) {
+        const auto points = sample_points(state.range(0));
+        for (auto _: state) {
+            benchmark::DoNotOptimize(interpolation::bspline::interpolate(points, 3));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_bspline_interpolate)->ArgName("points")->Arg(8)->Arg(32)->Arg(128);
+
+    void BM_bspline_smooth_interpolate(benchmark::State &state) {
+        const auto points = sample_points(state.range(0));
+        for (auto _: state) {
+            benchmark::DoNotOptimize(interpolation::bspline::smooth_interpolate(points, 3, 0.1));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_bspline_smooth_interpolate)->ArgName("points")->Arg(8)->Arg(32)->Arg(128);
+}
@@ -0,0 +1,94 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "curve/InterpolatedZeroCurve.h"
+#include "instruments/FixFloatSwap.h"
+#include "instruments/Leg.h"
+#include "instruments/XCSwap.h"
+#include "market/marketdata.h"
+#include "pricing/FixFloatSwapPricer.h"
+#include "pricing/XCSwapPricer.h"
+#include "time/calendar_factory.hpp"
+#include "time/daycount.hpp"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve;
+    using namespace curve::instruments;
+
+    const time::Date kCob{year{2026}, February, day{11}};
+
+    std::shared_ptr<ICurve> make_curve(double level) {
+        std::vector<Pillar> pillars;
+        for (const int m: {3, 6, 12, 24, 36, 60, 84, 120, 180, 240, 360}) {
+            pillars.emplace_back(time::Date{sys_days(kCob + months{m})}, level + 0.00005 * m);
+        }
+        return std::make_shared<InterpolatedZeroCurve>("BENCH", kCob, std::move(pillars),
+                                                       time::create_daycount_convention(
+                                                           time::DayCountConvention::ACT_365F));
+    }
+
+    std::shared_ptr<market::MarketData> make_market() {
+        auto md = std::make_shared<market::MarketData>();
+        md->snap_time = sys_days(kCob);
+        md->curves_ois = {{"EUR", make_curve(0.020)}, {"USD", make_curve(0.035)}};
+        md->curves_funding = {{"EUR", make_curve(0.022)}, {"USD", make_curve(0.037)}};
+        return md;
+    }
+
+    struct SwapFixture {
+        std::shared_ptr<time::CalendarBase> calendar = time::create_calendar(time::FinancialCalendar::Euronext);
+        std::shared_ptr<time::DayCountConventionBase> dc =
+                time::create_daycount_convention(time::DayCountConvention::ACT_360);
+        // Schedules keep references to the frequency and the business day convention
+        months annual{12}, semi_annual{6}, quarterly{3};
+        time::BusinessDayConvention bdc = time::BusinessDayConvention::MODIFIED_FOLLOWING;
+        time::Date start{sys_days(kCob) + days{2}};
+        time::Date end;
+
+        explicit SwapFixture(int tenor_years) : end(sys_days(start + years{tenor_years})) {
+        }
+
+        Leg leg(const std::string &currency, double notional, const months &freq, Leg::LegType type) const {
+            return {notional, currency, start, end, freq, *calendar, bdc, *dc, type};
+        }
+    };
+
+    // Argument: tenor in years
+    void BM_FixFloatSwapPricer_price(benchmark::State &state) {
+        const SwapFixture fixture(static_cast<int>(state.range(0)));
+        const auto fixed = fixture.leg("EUR", 1e7, fixture.annual, Leg::FIXED);
+        const auto floating = fixture.leg("EUR", 1e7, fixture.semi_annual, Leg::FLOATING);
+        const FixFloatSwap swap(fixed, floating); // holds references to the legs
+        const auto md = make_market();
+        pricing::FixFloatSwapPricer pricer;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(pricer.price(swap, md));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_FixFloatSwapPricer_price)->ArgName("years")->Arg(2)->Arg(10)->Arg(30);
+
+    void BM_XCSwapPricer_price(benchmark::State &state) {
+        const SwapFixture fixture(static_cast<int>(state.range(0)));
+        const auto eur = fixture.leg("EUR", 1e7, fixture.quarterly, Leg::FLOATING);
+        const auto usd = fixture.leg("USD", 1.08e7, fixture.quarterly, Leg::FLOATING);
+        const XCSwap swap(eur, usd);
+        const auto md = make_market();
+        pricing::XCSwapPricer pricer;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(pricer.price(swap, md));
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_XCSwapPricer_price)->ArgName("years")->Arg(2)->Arg(10)->Arg(30);
+}
@@ -0,0 +1,87 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "signal/SignalTransforms.h"
+
+namespace {
+    using forge::signal::SignalTransforms;
+
+    // Argument: series length
+    std::vector<double> series(std::size_t n) {
+        std::mt19937_64 rng(42);
+        std::normal_distribution<double> noise(0.0, 1.0);
+        std::vector<double> out(n);
+        for (auto &x: out) x = noise(rng);
+        return out;
+    }
+
+    void BM_SignalTransforms_tanh(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        for (auto _: state) benchmark::DoNotOptimize(SignalTransforms::tanh_transform(in));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_tanh)->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+
+    void BM_SignalTransforms_tanh_inplace(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        auto data = in;
+        for (auto _: state) {
+            state.PauseTiming();
+            data = in;
+            state.ResumeTiming();
+            SignalTransforms::tanh_transform_inplace(data);
+            benchmark::DoNotOptimize(data.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_tanh_inplace)->ArgName("n")->Arg(1 << 16);
+
+    void BM_SignalTransforms_sigmoid(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        for (auto _: state) benchmark::DoNotOptimize(SignalTransforms::sigmoid_transform(in));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_sigmoid)->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+
+    void BM_SignalTransforms_ranking(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        for (auto _: state) benchmark::DoNotOptimize(SignalTransforms::ranking_transform(in));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_ranking)->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+
+    // Rolling moments over a 64-sample window
+    void BM_SignalTransforms_std(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        for (auto _: state) benchmark::DoNotOptimize(SignalTransforms::std_transform(in, 64));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_std)->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+
+    void BM_SignalTransforms_skewness(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        for (auto _: state) benchmark::DoNotOptimize(SignalTransforms::skewness_transform(in, 64));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_skewness)->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+
+    void BM_SignalTransforms_kurtosis(benchmark::State &state) {
+        const auto in = series(state.range(0));
+        for (auto _: state) benchmark::DoNotOptimize(SignalTransforms::kurtosis_transform(in, 64));
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK(BM_SignalTransforms_kurtosis)->ArgName("n")->Arg(1 << 10)->Arg(1 << 16);
+}
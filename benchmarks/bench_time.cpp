@@ -0,0 +1,88 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <chrono>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "time/calendar_factory.hpp"
+#include "time/daycount.hpp"
+#include "time/scheduler.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve::time;
+
+    const Date kStart{year{2026}, February, day{13}};
+
+    std::vector<Date> calendar_days(int count) {
+        std::vector<Date> dates;
+        for (int d = 0; d < count; ++d) dates.emplace_back(sys_days(kStart) + days{d});
+        return dates;
+    }
+
+    // Argument: tenor in years; quarterly schedule
+    void BM_Scheduler_generate_schedule(benchmark::State &state) {
+        const auto calendar = create_calendar(FinancialCalendar::Euronext);
+        const auto dc = create_daycount_convention(DayCountConvention::ACT_360);
+        const Date end{sys_days(kStart + years{state.range(0)})};
+        const months freq{3};
+        for (auto _: state) {
+            auto schedule = Scheduler::generate_schedule(kStart, end, freq, BusinessDayConvention::MODIFIED_FOLLOWING,
+                                                         *dc, *calendar);
+            benchmark::DoNotOptimize(schedule.accruals.data());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_Scheduler_generate_schedule)->ArgName("years")->Arg(1)->Arg(5)->Arg(10)->Arg(30);
+
+    // Argument: FinancialCalendar; each iteration asks about one calendar day of a ten-year window
+    void BM_Calendar_is_holiday(benchmark::State &state) {
+        const auto calendar = create_calendar(static_cast<FinancialCalendar>(state.range(0)));
+        const auto dates = calendar_days(3653);
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(calendar->is_holiday(dates[i]));
+            if (++i == dates.size()) i = 0;
+        }
+        state.SetLabel(name(static_cast<FinancialCalendar>(state.range(0))));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_Calendar_is_holiday)->ArgName("calendar")->DenseRange(
+        static_cast<int>(FinancialCalendar::NYSE), static_cast<int>(FinancialCalendar::NSE));
+
+    void BM_Calendar_next_business_day(benchmark::State &state) {
+        const auto calendar = create_calendar(static_cast<FinancialCalendar>(state.range(0)));
+        const auto dates = calendar_days(3653);
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(calendar->next_business_day(dates[i]));
+            if (++i == dates.size()) i = 0;
+        }
+        state.SetLabel(name(static_cast<FinancialCalendar>(state.range(0))));
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_Calendar_next_business_day)->ArgName("calendar")->DenseRange(
+        static_cast<int>(FinancialCalendar::NYSE), static_cast<int>(FinancialCalendar::NSE));
+
+    // Argument: DayCountConvention; periods from one month to thirty years
+    void BM_DayCount_year_fraction(benchmark::State &state) {
+        const auto dc = create_daycount_convention(static_cast<DayCountConvention>(state.range(0)));
+        const auto dates = calendar_days(10957);
+        std::size_t i = 0;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(dc->year_fraction(kStart, dates[i]));
+            i += 31;
+            if (i >= dates.size()) i -= dates.size();
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_DayCount_year_fraction)->ArgName("convention")->DenseRange(
+        static_cast<int>(DayCountConvention::ACT_360), static_cast<int>(DayCountConvention::THIRTY_365F));
+}
@@ -0,0 +1,78 @@
+//
+// Created by Francisco Nunez on 11.02.2026.
+//
+
+#include <cmath>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "analytical_pricers/BlackScholes.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace {
+    using curve::analytical_pricers::BlackScholes;
+    using curve::volatility::ImpliedVolSurface;
+    using curve::volatility::OptionQuote;
+
+    constexpr double kSpot = 100.0;
+    constexpr double kRate = 0.03;
+
+    // Call quotes on a smiling surface; argument: strikes per expiry (six expiries)
+    std::vector<OptionQuote> smile_quotes(int strikes_per_expiry) {
+        std::vector<OptionQuote> quotes;
+        for (const double maturity: {0.25, 0.5, 1.0, 2.0, 5.0, 10.0}) {
+            for (int i = 0; i < strikes_per_expiry; ++i) {
+                const double strike = 60.0 + 80.0 * i / (strikes_per_expiry - 1);
+                const double forward = kSpot * std::exp(kRate * maturity);
+                const double vol = 0.2 + 0.1 * std::pow(std::log(strike / forward), 2) / std::sqrt(maturity);
+                OptionQuote quote;
+                quote.strike = strike;
+                quote.maturity = maturity;
+                quote.market_price = BlackScholes::call_price(kSpot, strike, kRate, vol, maturity);
+                quote.spot = kSpot;
+                quote.forward = forward;
+                quote.is_call = true;
+                quotes.push_back(quote);
+            }
+        }
+        return quotes;
+    }
+
+    ImpliedVolSurface make_surface(ImpliedVolSurface::InterpolationMethod method) {
+        return ImpliedVolSurface(ImpliedVolSurface::SurfaceType::LOG_MONEYNESS_SPACE, method, kRate);
+    }
+
+    void BM_ImpliedVolSurface_calibrate(benchmark::State &state) {
+        const auto quotes = smile_quotes(static_cast<int>(state.range(0)));
+        for (auto _: state) {
+            auto surface = make_surface(ImpliedVolSurface::InterpolationMethod::BICUBIC_SPLINE);
+            benchmark::DoNotOptimize(surface.calibrate(quotes));
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(quotes.size()));
+    }
+
+    BENCHMARK(BM_ImpliedVolSurface_calibrate)->ArgName("strikes")->Arg(5)->Arg(11)->Arg(21);
+
+    // Argument: ImpliedVolSurface::InterpolationMethod
+    void BM_ImpliedVolSurface_get_volatility(benchmark::State &state) {
+        auto surface = make_surface(static_cast<ImpliedVolSurface::InterpolationMethod>(state.range(0)));
+        if (!surface.calibrate(smile_quotes(11))) {
+            state.SkipWithError("calibration failed");
+            return;
+        }
+        double strike = 70.0, maturity = 0.3;
+        for (auto _: state) {
+            benchmark::DoNotOptimize(surface.get_volatility(strike, maturity, kSpot * std::exp(kRate * maturity)));
+            strike += 1.7;
+            if (strike > 130.0) strike -= 60.0;
+            maturity += 0.37;
+            if (maturity > 9.5) maturity -= 9.2;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK(BM_ImpliedVolSurface_get_volatility)->ArgName("method")->DenseRange(
+        static_cast<int>(ImpliedVolSurface::InterpolationMethod::BILINEAR),
+        static_cast<int>(ImpliedVolSurface::InterpolationMethod::LINEAR_IN_VARIANCE));
+}
@@ -6,6 +6,8 @@
 #include <algorithm>
 #include <stdexcept>
 
+#include "metrics/Metrics.h"
+
 namespace curve::analytical_pricers {
     double BlackScholes::norm_cdf(double x) {
         // Approximation using error function
@@ -65,6 +67,7 @@ namespace curve::analytical_pricers {
         double tolerance,
         int max_iterations
     ) {
+        CURVEFORGE_TIME_SCOPE("iv.newton");
         if (market_price <= 0.0) {
             throw std::invalid_argument("Market price must be positive");
         }
@@ -78,12 +81,14 @@ namespace curve::analytical_pricers {
             double diff = price - market_price;
 
             if (std::abs(diff) < tolerance) {
+                CURVEFORGE_RECORD_VALUE("iv.newton.iterations", i + 1);
                 return sigma;
             }
 
             double vega_val = vega(S, K, r, sigma, T);
             if (vega_val < 1e-10) {
                 // Vega too small, switch to Brent's method
+                CURVEFORGE_COUNT("iv.brent_fallbacks", 1);
                 return implied_volatility_brent(market_price, S, K, r, T, is_call);
             }
             sigma = sigma - diff / vega_val;
@@ -105,6 +110,7 @@ namespace curve::analytical_pricers {
         double tolerance,
         int max_iterations
     ) {
+        CURVEFORGE_TIME_SCOPE("iv.brent");
         auto price_func = [&](double sigma) {
             double price = is_call
                                ? call_price(S, K, r, sigma, T)
@@ -134,6 +140,7 @@ namespace curve::analytical_pricers {
 
         for (int i = 0; i < max_iterations; ++i) {
             if (std::abs(b - a) < tolerance) {
+                CURVEFORGE_RECORD_VALUE("iv.brent.iterations", i + 1);
                 return b;
             }
 
@@ -0,0 +1,58 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_CLOSEDFORM_H
+#define CURVEFORGE_CLOSEDFORM_H
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+
+namespace curve {
+    // How ICurve::D() evaluates a curve: by searching its pillars, or in closed form without them.
+    enum class CurveKind {
+        INTERPOLATED, // pillars searched and interpolated per InterpolationMode
+        FLAT, // one continuously compounded zero rate
+        NELSON_SIEGEL_SVENSSON // parametric zero rate, NssParameters
+    };
+
+    /**
+     * @brief Nelson–Siegel–Svensson zero-rate parameters.
+     *
+     * z(t) = beta0 + beta1 * L(t / tau1) + beta2 * (L(t / tau1) - e^(-t / tau1))
+     *      + beta3 * (L(t / tau2) - e^(-t / tau2)),  L(x) = (1 - e^(-x)) / x
+     *
+     * with t in ACT/365F years from the cob date and z continuously compounded. beta3 = 0 is
+     * plain Nelson–Siegel (tau2 then unused).
+     */
+    struct NssParameters {
+        double beta0 = 0.0; // long-run level
+        double beta1 = 0.0; // slope; z(0) = beta0 + beta1
+        double beta2 = 0.0; // first hump
+        double beta3 = 0.0; // second hump
+        double tau1 = 1.0;
+        double tau2 = 1.0;
+    };
+
+    // (1 - e^(-x)) / x, continued to 1 at x = 0
+    inline double nss_loading(double x) {
+        return x > 1e-8 ? -std::expm1(-x) / x : 1.0 - 0.5 * x;
+    }
+
+    // Zero rate at t >= 0 years
+    inline double nss_zero_rate(const NssParameters &p, double t) {
+        const double x1 = t / p.tau1;
+        const double x2 = t / p.tau2;
+        const double l1 = nss_loading(x1);
+        const double l2 = nss_loading(x2);
+        return p.beta0 + p.beta1 * l1 + p.beta2 * (l1 - std::exp(-x1)) + p.beta3 * (l2 - std::exp(-x2));
+    }
+
+    // e^(-z(t) t) for every t >= 0 in `times` into `out` (same size); a plain loop over contiguous years
+    inline void nss_discount_factors(const NssParameters &p, std::span<const double> times, std::span<double> out) {
+        for (std::size_t i = 0; i < times.size(); ++i) out[i] = std::exp(-nss_zero_rate(p, times[i]) * times[i]);
+    }
+}
+
+#endif //CURVEFORGE_CLOSEDFORM_H
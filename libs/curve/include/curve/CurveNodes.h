@@ -0,0 +1,88 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_CURVENODES_H
+#define CURVEFORGE_CURVENODES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "Pillar.h"
+#include "time/daycount.hpp"
+
+namespace curve {
+    /**
+     * @brief A curve's pillars as separate arrays, for search and evaluation on plain numbers.
+     *
+     * Holds the pillar dates as int32 day serials (time::to_serial), the pillar values, their
+     * year fractions from the cob date and the year fraction of every segment, each array
+     * 64-byte aligned in one allocation. Searching touches the 4-byte serials only, and the
+     * day count is evaluated once per pillar here instead of on every lookup.
+     */
+    class CurveNodes {
+    public:
+        static constexpr std::size_t kAlignment = 64;
+
+        CurveNodes() = default;
+
+        // `pillars` sorted by date
+        CurveNodes(const time::Date &cob_date, const std::vector<Pillar> &pillars,
+                   const time::DayCountConventionBase &dc);
+
+        CurveNodes(const CurveNodes &other);
+
+        CurveNodes &operator=(const CurveNodes &other);
+
+        CurveNodes(CurveNodes &&other) noexcept;
+
+        CurveNodes &operator=(CurveNodes &&other) noexcept;
+
+        [[nodiscard]] std::size_t size() const { return size_; }
+
+        [[nodiscard]] bool empty() const { return size_ == 0; }
+
+        [[nodiscard]] std::span<const std::int32_t> serials() const { return {serials_, size_}; }
+
+        [[nodiscard]] std::span<const double> values() const { return {values_, size_}; }
+
+        // Year fraction from the cob date to each pillar
+        [[nodiscard]] std::span<const double> times() const { return {times_, size_}; }
+
+        // Year fraction from pillar i to pillar i + 1; size() - 1 entries
+        [[nodiscard]] std::span<const double> spans() const { return {spans_, size_ > 0 ? size_ - 1 : 0}; }
+
+        // Last i <= size() - 2 with serials()[i] <= serial (0 below the first pillar or with one pillar)
+        [[nodiscard]] std::size_t segment(std::int32_t serial) const {
+            if (size_ < 2) return 0;
+            const std::int32_t *first = serials_;
+            std::size_t length = size_ - 1;
+            while (length > 1) {
+                const std::size_t half = length / 2;
+                first = first[half] <= serial ? first + half : first;
+                length -= half;
+            }
+            return static_cast<std::size_t>(first - serials_);
+        }
+
+    private:
+        struct AlignedDelete {
+            void operator()(std::byte *p) const { ::operator delete[](p, std::align_val_t{kAlignment}); }
+        };
+
+        void allocate(std::size_t size);
+
+        std::size_t size_ = 0;
+        std::unique_ptr<std::byte[], AlignedDelete> block_;
+        std::int32_t *serials_ = nullptr;
+        double *values_ = nullptr;
+        double *times_ = nullptr;
+        double *spans_ = nullptr;
+    };
+}
+
+#endif //CURVEFORGE_CURVENODES_H
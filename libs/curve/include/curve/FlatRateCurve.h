@@ -9,12 +9,15 @@
 
 namespace curve {
     //Aple mock curve for testing that returns a constant value.
+    // D() is closed form (CurveKind::FLAT); the two pillars, cob and cob + 100Y, are only a tabulation.
     class FlatRateCurve : public ICurve {
     public:
         explicit FlatRateCurve(time::Date cob_date, double constant_rate);
 
         [[nodiscard]] std::string name() const override;
 
+        [[nodiscard]] std::shared_ptr<ICurve> clone() const override;
+
     private:
         double constant_rate_;
     };
@@ -4,13 +4,27 @@
 
 #ifndef CURVEFORGE_ICURVE_H
 #define CURVEFORGE_ICURVE_H
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <span>
 
+#include "ClosedForm.h"
+#include "CurveNodes.h"
 #include "Pillar.h"
 #include "time/daycount.hpp"
 #include "time/instant.h"
 
 namespace curve {
+    // How D() interpolates between pillars; pillar values are always continuously compounded zero rates.
+    enum class InterpolationMode {
+        LINEAR_ZERO, // linear in zero rate
+        LINEAR_DISCOUNT, // linear in discount factor
+        LOG_LINEAR_DISCOUNT // linear in log discount factor (piecewise flat forwards)
+    };
+
     class ICurve {
     public:
         ICurve(const time::Date &cob_date, std::vector<Pillar> &&pillars,
@@ -27,16 +41,60 @@ namespace curve {
 
         [[nodiscard]] double D(const time::Date &d) const;
 
+        // D() of every date into `out` (same size), dispatching on kind() once for the batch
+        void D(std::span<const time::Date> dates, std::span<double> out) const;
+
         [[nodiscard]] double F(const time::Date &t1, const time::Date &t2) const;
 
         [[nodiscard]] virtual std::string name() const =0;
 
+        // Deep copy of the pillars, allocated by the calling thread (the day count stays shared)
+        [[nodiscard]] virtual std::shared_ptr<ICurve> clone() const =0;
+
+        [[nodiscard]] InterpolationMode interpolation() const { return interpolation_; }
+
+        [[nodiscard]] CurveKind kind() const { return kind_; }
+
+        // Closed-form parameters; FLAT holds its rate in beta0. Unused for INTERPOLATED curves
+        [[nodiscard]] const NssParameters &parameters() const { return parameters_; }
+
+        [[nodiscard]] const std::vector<Pillar> &pillars() const { return pillars_; }
+
+        // The pillars as int32 serials and value / year fraction arrays, which D() searches
+        [[nodiscard]] const CurveNodes &nodes() const { return nodes_; }
+
+        [[nodiscard]] const time::Date &cob() const { return cob_date; }
+
+        // Year fraction from the cob date under the curve's day count
+        [[nodiscard]] double year_fraction(const time::Date &d) const { return dc->year_fraction(cob_date, d); }
+
         friend class ICurveCalibration;
 
     protected:
+        // Rebuilds nodes_; derived classes call it after changing pillars_
+        void reindex();
+
+        // Evaluates D() in closed form on ACT/365F years from the cob date; the pillars are then only a tabulation
+        void set_closed_form(CurveKind kind, const NssParameters &parameters);
+
         std::vector<Pillar> pillars_;
         const time::Date cob_date;
         std::shared_ptr<time::DayCountConventionBase> dc;
+        InterpolationMode interpolation_ = InterpolationMode::LINEAR_ZERO;
+
+    private:
+        [[nodiscard]] double interpolated_D(const time::Date &t_in) const;
+
+        [[nodiscard]] double closed_form_D(std::int32_t serial) const {
+            const double t = std::max(serial - cob_serial_, 0) / 365.0;
+            const double rate = kind_ == CurveKind::FLAT ? parameters_.beta0 : nss_zero_rate(parameters_, t);
+            return std::exp(-rate * t);
+        }
+
+        CurveNodes nodes_;
+        CurveKind kind_ = CurveKind::INTERPOLATED;
+        NssParameters parameters_{};
+        std::int32_t cob_serial_ = 0;
     };
 } // curve
 #endif //CURVEFORGE_ICURVE_H
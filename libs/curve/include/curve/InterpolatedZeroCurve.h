@@ -0,0 +1,29 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#ifndef CURVEFORGE_INTERPOLATEDZEROCURVE_H
+#define CURVEFORGE_INTERPOLATEDZEROCURVE_H
+
+#include <string>
+
+#include "ICurve.h"
+
+namespace curve {
+    // Curve given by continuously compounded zero-rate pillars, e.g. loaded from a market data snapshot.
+    class InterpolatedZeroCurve : public ICurve {
+    public:
+        InterpolatedZeroCurve(std::string curve_id, const time::Date &cob_date, std::vector<Pillar> &&pillars,
+                              std::shared_ptr<time::DayCountConventionBase> convention,
+                              InterpolationMode interpolation = InterpolationMode::LINEAR_ZERO);
+
+        [[nodiscard]] std::string name() const override;
+
+        [[nodiscard]] std::shared_ptr<ICurve> clone() const override;
+
+    private:
+        std::string curve_id_;
+    };
+}
+
+#endif //CURVEFORGE_INTERPOLATEDZEROCURVE_H
@@ -0,0 +1,34 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_NELSONSIEGELSVENSSONCURVE_H
+#define CURVEFORGE_NELSONSIEGELSVENSSONCURVE_H
+
+#include <string>
+
+#include "ClosedForm.h"
+#include "ICurve.h"
+
+namespace curve {
+    /**
+     * @brief Parametric Nelson–Siegel–Svensson curve with closed-form discount factors.
+     *
+     * D() evaluates nss_zero_rate on ACT/365F years from the cob date (CurveKind::NELSON_SIEGEL_SVENSSON)
+     * and never searches pillars. The pillars tabulate the zero rate from the cob date out to 50Y for
+     * consumers that need nodes, such as the shared-memory publisher.
+     */
+    class NelsonSiegelSvenssonCurve : public ICurve {
+    public:
+        NelsonSiegelSvenssonCurve(std::string curve_id, const time::Date &cob_date, const NssParameters &parameters);
+
+        [[nodiscard]] std::string name() const override;
+
+        [[nodiscard]] std::shared_ptr<ICurve> clone() const override;
+
+    private:
+        std::string curve_id_;
+    };
+}
+
+#endif //CURVEFORGE_NELSONSIEGELSVENSSONCURVE_H
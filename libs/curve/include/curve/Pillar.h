@@ -4,6 +4,8 @@
 
 #ifndef CURVEFORGE_PILLAR_H
 #define CURVEFORGE_PILLAR_H
+#include <cmath>
+
 #include "time/instant.h"
 #include "constants.h"
 #include "time/date.hpp"
@@ -30,19 +32,19 @@ namespace curve {
 
         [[nodiscard]] const time::Date &get_time() const;
 
-        // Equality and comparison operators
+        // Equality and comparison operators. Dates closer than EPS_INSTANT (one day) are equal
+        // dates, so both compare the packed year / month / day fields, with no calendar arithmetic.
+        static_assert(EPS_INSTANT == std::chrono::days{1});
+
         inline bool operator==(const Pillar &other) const noexcept {
-            auto dt = this->date > other.date
-                          ? std::chrono::sys_days(this->date) - std::chrono::sys_days(other.date)
-                          : std::chrono::sys_days(other.date) - std::chrono::sys_days(this->date);
-            return dt < EPS_INSTANT && std::abs(value - other.value) < EPS_RATE;
+            return date == other.date && std::abs(value - other.value) < EPS_RATE;
         }
 
         inline bool operator!=(const Pillar &other) const noexcept {
             return !(*this == other);
         }
 
-        // Strict weak ordering: compare by time first, then by value
+        // Strict weak ordering by date
         inline bool operator<(const Pillar &other) const noexcept {
             return this->date < other.date;
         }
@@ -55,5 +57,8 @@ namespace curve {
         time::Date date;
         double value;
     };
+
+    // year_month_day packs into 4 bytes: a pillar is one 16-byte slot, see CurveNodes for the search layout
+    static_assert(sizeof(Pillar) == 16);
 }
 #endif //CURVEFORGE_PILLAR_H
@@ -0,0 +1,73 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "curve/CurveNodes.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace curve {
+    namespace {
+        std::size_t padded(std::size_t bytes) {
+            return (bytes + CurveNodes::kAlignment - 1) / CurveNodes::kAlignment * CurveNodes::kAlignment;
+        }
+    }
+
+    CurveNodes::CurveNodes(const time::Date &cob_date, const std::vector<Pillar> &pillars,
+                           const time::DayCountConventionBase &dc) {
+        allocate(pillars.size());
+        for (std::size_t i = 0; i < size_; ++i) {
+            const auto &date = pillars[i].get_time();
+            serials_[i] = time::to_serial(date);
+            values_[i] = pillars[i].get_value();
+            times_[i] = dc.year_fraction(cob_date, date);
+            if (i + 1 < size_) spans_[i] = dc.year_fraction(date, pillars[i + 1].get_time());
+        }
+    }
+
+    CurveNodes::CurveNodes(const CurveNodes &other) {
+        allocate(other.size_);
+        std::copy_n(other.serials_, size_, serials_);
+        std::copy_n(other.values_, size_, values_);
+        std::copy_n(other.times_, size_, times_);
+        if (size_ > 1) std::copy_n(other.spans_, size_ - 1, spans_);
+    }
+
+    CurveNodes &CurveNodes::operator=(const CurveNodes &other) {
+        if (this != &other) *this = CurveNodes(other);
+        return *this;
+    }
+
+    CurveNodes::CurveNodes(CurveNodes &&other) noexcept
+        : size_(std::exchange(other.size_, 0)), block_(std::move(other.block_)),
+          serials_(std::exchange(other.serials_, nullptr)), values_(std::exchange(other.values_, nullptr)),
+          times_(std::exchange(other.times_, nullptr)), spans_(std::exchange(other.spans_, nullptr)) {
+    }
+
+    CurveNodes &CurveNodes::operator=(CurveNodes &&other) noexcept {
+        if (this != &other) {
+            size_ = std::exchange(other.size_, 0);
+            block_ = std::move(other.block_);
+            serials_ = std::exchange(other.serials_, nullptr);
+            values_ = std::exchange(other.values_, nullptr);
+            times_ = std::exchange(other.times_, nullptr);
+            spans_ = std::exchange(other.spans_, nullptr);
+        }
+        return *this;
+    }
+
+    void CurveNodes::allocate(std::size_t size) {
+        size_ = size;
+        if (size == 0) return;
+        const auto serial_bytes = padded(size * sizeof(std::int32_t));
+        const auto double_bytes = padded(size * sizeof(double));
+        block_.reset(static_cast<std::byte *>(
+            ::operator new[](serial_bytes + 3 * double_bytes, std::align_val_t{kAlignment})));
+        auto *at = block_.get();
+        serials_ = reinterpret_cast<std::int32_t *>(at);
+        values_ = reinterpret_cast<double *>(at + serial_bytes);
+        times_ = reinterpret_cast<double *>(at + serial_bytes + double_bytes);
+        spans_ = reinterpret_cast<double *>(at + serial_bytes + 2 * double_bytes);
+    }
+}
@@ -17,6 +17,9 @@ curve::FlatRateCurve::FlatRateCurve(time::Date cob_date, double constant_rate)
       )
       ,
       constant_rate_(constant_rate) {
+    set_closed_form(CurveKind::FLAT, {.beta0 = constant_rate});
 }
 
 std::string curve::FlatRateCurve::name() const { return "FlatRateCurve"; }
+
+std::shared_ptr<curve::ICurve> curve::FlatRateCurve::clone() const { return std::make_shared<FlatRateCurve>(*this); }
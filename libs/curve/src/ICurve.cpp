@@ -2,10 +2,15 @@
 //
 // Created by Francisco Nunez on 14.11.2025.
 //
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include "curve/ICurve.h"
 #include "interpolation/linear.h"
+#include "metrics/Metrics.h"
 #include "time/daycount.hpp"
 using namespace curve;
 
@@ -13,48 +18,105 @@ ICurve::ICurve(const time::Date &cob_date,
                std::vector<Pillar> &&pillars,
                std::shared_ptr<time::DayCountConventionBase> convention) : pillars_(std::move(pillars)),
                                                                            cob_date(cob_date),
-                                                                           dc(std::move(convention)) {
+                                                                           dc(std::move(convention)),
+                                                                           cob_serial_(time::to_serial(cob_date)) {
+    reindex();
 }
 
 ICurve::ICurve(const time::Date &cob_date, const std::vector<Pillar> &pillars,
                std::shared_ptr<time::DayCountConventionBase> convention) : cob_date(cob_date), pillars_(pillars),
-                                                                           dc(std::move(convention)) {
+                                                                           dc(std::move(convention)),
+                                                                           cob_serial_(time::to_serial(cob_date)) {
+    reindex();
 }
 
-double ICurve::D(const time::Date &t_in) const {
-    if (pillars_.empty()) {
-        throw std::runtime_error("No pillars to interpolate.");
-    }
-    auto t = t_in;
-    if (t <= pillars_.front().get_time()) t = pillars_.front().get_time();
-    if (t >= pillars_.back().get_time()) t = pillars_.back().get_time();
-
-    auto i_upper = std::upper_bound(pillars_.begin(), pillars_.end(), t, [](const time::Date &x, const Pillar &p) {
-        return x < p.get_time();
-    });
+void ICurve::reindex() {
+    nodes_ = CurveNodes(cob_date, pillars_, *dc);
+}
 
-    auto i_lower = std::lower_bound(pillars_.begin(), pillars_.end(), t, [](const Pillar &p, const time::Date &x) {
-        return p.get_time() > x;
-    });
+void ICurve::set_closed_form(CurveKind kind, const NssParameters &parameters) {
+    kind_ = kind;
+    parameters_ = parameters;
+}
 
-    auto iu = i_upper - pillars_.begin();
-    auto id = i_lower - pillars_.begin();
+double ICurve::D(const time::Date &t_in) const {
+    CURVEFORGE_TIME_SCOPE("curve.D");
+    if (kind_ != CurveKind::INTERPOLATED) return closed_form_D(time::to_serial(t_in));
+    return interpolated_D(t_in);
+}
 
-    const auto t1 = pillars_[id].get_time();
-    const auto t2 = pillars_[iu].get_time();
+void ICurve::D(std::span<const time::Date> dates, std::span<double> out) const {
+    CURVEFORGE_TIME_SCOPE("curve.D");
+    if (dates.size() != out.size()) {
+        throw std::invalid_argument("ICurve::D: " + std::to_string(dates.size()) + " dates for " +
+                                    std::to_string(out.size()) + " outputs");
+    }
+    switch (kind_) {
+        case CurveKind::FLAT:
+        case CurveKind::NELSON_SIEGEL_SVENSSON:
+            for (std::size_t i = 0; i < dates.size(); ++i) out[i] = closed_form_D(time::to_serial(dates[i]));
+            return;
+        case CurveKind::INTERPOLATED:
+            for (std::size_t i = 0; i < dates.size(); ++i) out[i] = interpolated_D(dates[i]);
+            return;
+    }
+}
 
-    const double v1 = pillars_[id].get_value();
-    const double v2 = pillars_[iu].get_value();
+double ICurve::interpolated_D(const time::Date &t_in) const {
+    if (nodes_.empty()) {
+        throw std::runtime_error("No pillars to interpolate.");
+    }
+    const auto serials = nodes_.serials();
+    const auto times = nodes_.times();
+    const auto last = nodes_.size() - 1;
+    // Bracketing pillars [id, iu], found on the serials; t is clamped to the first / last pillar
+    const auto s = std::clamp(time::to_serial(t_in), serials.front(), serials[last]);
+    const auto id = nodes_.segment(s);
+    const auto iu = std::min(id + 1, last);
+    const double v1 = nodes_.values()[id];
+    const double v2 = nodes_.values()[iu];
+    const double dt = iu > id ? nodes_.spans()[id] : 0.0;
 
-    const double dt = dc->year_fraction(t1, t2);
-    const double dT = dc->year_fraction(t1, t);
+    double dT; // year fraction from pillar id to t
+    double t_cob; // year fraction from the cob date to t
+    if (s == serials.front()) {
+        dT = 0.0;
+        t_cob = times.front();
+    } else if (s == serials[last]) {
+        dT = dt;
+        t_cob = times[last];
+    } else {
+        dT = dc->year_fraction(pillars_[id].get_time(), t_in);
+        t_cob = dc->year_fraction(cob_date, t_in);
+    }
 
-    const auto rate = v1 + (v2 - v1) * dT / dt;
-    const auto t_cob = dc->year_fraction(cob_date, t);
+    const double w = dt > 0.0 ? dT / dt : 0.0;
+    switch (interpolation_) {
+        case InterpolationMode::LINEAR_DISCOUNT: {
+            const double D1 = std::exp(-v1 * times[id]);
+            const double D2 = std::exp(-v2 * times[iu]);
+            return D1 + (D2 - D1) * w;
+        }
+        case InterpolationMode::LOG_LINEAR_DISCOUNT: {
+            const double lnD1 = -v1 * times[id];
+            const double lnD2 = -v2 * times[iu];
+            return std::exp(lnD1 + (lnD2 - lnD1) * w);
+        }
+        case InterpolationMode::LINEAR_ZERO:
+            break;
+    }
+    const auto rate = v1 + (v2 - v1) * w;
     return std::exp(-rate * t_cob);
 }
 
 double ICurve::F(const time::Date &t1, const time::Date &t2) const {
+    CURVEFORGE_TIME_SCOPE("curve.F");
+    if (kind_ != CurveKind::INTERPOLATED) {
+        // Closed forms run on ACT/365F, so tau needs no day-count call either
+        const auto s1 = time::to_serial(t1);
+        const auto s2 = time::to_serial(t2);
+        return (closed_form_D(s1) / closed_form_D(s2) - 1.0) / ((s2 - s1) / 365.0);
+    }
     const auto D1 = D(t1);
     const auto D2 = D(t2);
     const auto tau = dc->year_fraction(t1, t2);
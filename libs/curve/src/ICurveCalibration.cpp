@@ -14,6 +14,7 @@ namespace curve {
         }
         pillars_.pop_back();
         pillars_.emplace_back(t, value);
+        reindex();
     }
 
     void ICurveCalibration::set_last_pillar(double value) {
@@ -24,6 +25,7 @@ namespace curve {
         // remove the old last element and append the new one to avoid deleted assignment
         pillars_.pop_back();
         pillars_.push_back(new_pillar);
+        reindex();
     }
 }
 
@@ -0,0 +1,22 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#include "curve/InterpolatedZeroCurve.h"
+
+#include <algorithm>
+#include <utility>
+
+curve::InterpolatedZeroCurve::InterpolatedZeroCurve(std::string curve_id, const time::Date &cob_date,
+                                                    std::vector<Pillar> &&pillars,
+                                                    std::shared_ptr<time::DayCountConventionBase> convention,
+                                                    InterpolationMode interpolation)
+    : ICurve(cob_date, std::move(pillars), std::move(convention)), curve_id_(std::move(curve_id)) {
+    interpolation_ = interpolation;
+    std::sort(pillars_.begin(), pillars_.end());
+    reindex();
+}
+
+std::string curve::InterpolatedZeroCurve::name() const { return curve_id_; }
+
+std::shared_ptr<curve::ICurve> curve::InterpolatedZeroCurve::clone() const { return std::make_shared<InterpolatedZeroCurve>(*this); }
@@ -0,0 +1,41 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "curve/NelsonSiegelSvenssonCurve.h"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace curve {
+    namespace {
+        std::vector<Pillar> tabulate(const time::Date &cob_date, const NssParameters &parameters) {
+            if (!(parameters.tau1 > 0.0) || !(parameters.tau2 > 0.0)) {
+                throw std::invalid_argument("NelsonSiegelSvenssonCurve: tau1 and tau2 must be positive");
+            }
+            const int months_out[] = {0, 1, 3, 6, 12, 24, 36, 60, 84, 120, 180, 240, 360, 600};
+            const auto cob = time::to_serial(cob_date);
+            std::vector<Pillar> pillars;
+            for (const int m: months_out) {
+                const time::Date date{std::chrono::sys_days(cob_date + std::chrono::months{m})};
+                pillars.emplace_back(date, nss_zero_rate(parameters, (time::to_serial(date) - cob) / 365.0));
+            }
+            return pillars;
+        }
+    }
+
+    NelsonSiegelSvenssonCurve::NelsonSiegelSvenssonCurve(std::string curve_id, const time::Date &cob_date,
+                                                         const NssParameters &parameters)
+        : ICurve(cob_date, tabulate(cob_date, parameters),
+                 time::create_daycount_convention(time::DayCountConvention::ACT_365F)),
+          curve_id_(std::move(curve_id)) {
+        set_closed_form(CurveKind::NELSON_SIEGEL_SVENSSON, parameters);
+    }
+
+    std::string NelsonSiegelSvenssonCurve::name() const { return curve_id_; }
+
+    std::shared_ptr<ICurve> NelsonSiegelSvenssonCurve::clone() const {
+        return std::make_shared<NelsonSiegelSvenssonCurve>(*this);
+    }
+}
@@ -0,0 +1,75 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_NSSFITTER_H
+#define CURVEFORGE_NSSFITTER_H
+
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "curve/ClosedForm.h"
+
+namespace curve::fitting {
+    // One observed yield: ACT/365F years to maturity and the continuously compounded zero yield
+    struct NssObservation {
+        double maturity;
+        double yield;
+        double weight = 1.0;
+    };
+
+    struct NssFitOptions {
+        // Disjoint ranges keep the two humps apart, so beta2 and beta3 stay identifiable
+        std::pair<double, double> tau1_bounds{0.05, 5.0};
+        std::pair<double, double> tau2_bounds{5.0, 30.0};
+        int grid_points = 8; // log-spaced seeds per tau; the best one starts the optimizer
+        double ftol = 1e-12;
+        double xtol = 1e-10;
+        int maxeval = 200;
+    };
+
+    struct NssFit {
+        NssParameters parameters;
+        double rmse = 0.0; // weighted root mean squared yield error
+        bool converged = false; // the optimizer stopped on a tolerance; otherwise the best grid seed is kept
+    };
+
+    // The fit objective with the betas solved out: for fixed taus they follow from weighted linear least squares
+    struct NssProfilePoint {
+        NssParameters parameters;
+        double sse = 0.0; // weighted sum of squared yield errors
+        double d_tau1 = 0.0;
+        double d_tau2 = 0.0;
+    };
+
+    /**
+     * @brief Nelson–Siegel–Svensson fit objective over (tau1, tau2) only.
+     *
+     * The zero rate is linear in the betas, so every evaluation solves a 4x4 system for them
+     * and the optimizer searches the two decay parameters alone. At the solved betas the
+     * gradient in the betas vanishes, which makes the tau gradient analytic as well.
+     */
+    class NssProfile {
+    public:
+        // At least four observations with positive maturities and non-negative weights
+        explicit NssProfile(std::span<const NssObservation> observations);
+
+        [[nodiscard]] NssProfilePoint at(double tau1, double tau2) const;
+
+        [[nodiscard]] double total_weight() const { return total_weight_; }
+
+    private:
+        std::span<const NssObservation> observations_;
+        double total_weight_ = 0.0;
+    };
+
+    // Fit to one day of yields: grid seed, then Convex_Boxed_Optimizer on the profile with its analytic gradient
+    NssFit fit_nss(std::span<const NssObservation> observations, const NssFitOptions &options = {});
+
+    // fit_nss() of every day, run in parallel on the shared task pool; results in input order
+    std::vector<NssFit> fit_nss_panel(std::span<const std::vector<NssObservation> > panel,
+                                      const NssFitOptions &options = {});
+}
+
+#endif //CURVEFORGE_NSSFITTER_H
@@ -0,0 +1,159 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "curve_fitting/NssFitter.h"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "metrics/Metrics.h"
+#include "optimization/Convex_Boxed_Optimizer.h"
+#include "tasks/Parallel.h"
+
+namespace curve::fitting {
+    namespace {
+        // d/dx of nss_loading(x) = (e^(-x) - L(x)) / x, continued to -1/2 at x = 0
+        double loading_slope(double x, double e, double l) {
+            return x > 1e-4 ? (e - l) / x : -0.5 + x / 3.0;
+        }
+
+        // Regressors of z(t) in (beta0, beta1, beta2, beta3) at one maturity
+        struct Row {
+            Eigen::Vector4d x;
+            double x1, e1, l1; // t / tau1, e^(-t / tau1), L(t / tau1)
+            double x2, e2, l2;
+        };
+
+        Row regressors(double t, double tau1, double tau2) {
+            Row r;
+            r.x1 = t / tau1;
+            r.x2 = t / tau2;
+            r.e1 = std::exp(-r.x1);
+            r.e2 = std::exp(-r.x2);
+            r.l1 = nss_loading(r.x1);
+            r.l2 = nss_loading(r.x2);
+            r.x << 1.0, r.l1, r.l1 - r.e1, r.l2 - r.e2;
+            return r;
+        }
+
+        std::vector<double> log_grid(std::pair<double, double> bounds, int points) {
+            const auto [lo, hi] = bounds;
+            if (!(lo > 0.0) || !(hi >= lo)) {
+                throw std::invalid_argument("fit_nss: tau bounds must satisfy 0 < lower <= upper");
+            }
+            if (points <= 1) return {std::sqrt(lo * hi)};
+            std::vector<double> grid(static_cast<std::size_t>(points));
+            for (int k = 0; k < points; ++k) grid[k] = lo * std::pow(hi / lo, static_cast<double>(k) / (points - 1));
+            return grid;
+        }
+    }
+
+    NssProfile::NssProfile(std::span<const NssObservation> observations) : observations_(observations) {
+        if (observations_.size() < 4) {
+            throw std::invalid_argument("NssProfile: need at least 4 observations, got " +
+                                        std::to_string(observations_.size()));
+        }
+        for (const auto &o: observations_) {
+            if (!(o.maturity > 0.0) || !(o.weight >= 0.0) || !std::isfinite(o.yield)) {
+                throw std::invalid_argument("NssProfile: maturities must be positive, weights non-negative "
+                                            "and yields finite");
+            }
+            total_weight_ += o.weight;
+        }
+        if (!(total_weight_ > 0.0)) throw std::invalid_argument("NssProfile: all weights are zero");
+    }
+
+    NssProfilePoint NssProfile::at(double tau1, double tau2) const {
+        // Weighted normal equations for the betas
+        Eigen::Matrix4d a = Eigen::Matrix4d::Zero();
+        Eigen::Vector4d b = Eigen::Vector4d::Zero();
+        for (const auto &o: observations_) {
+            const auto r = regressors(o.maturity, tau1, tau2);
+            a.noalias() += o.weight * r.x * r.x.transpose();
+            b.noalias() += o.weight * o.yield * r.x;
+        }
+        // Pivoted LDLT also copes with tau1 == tau2, where the two hump regressors coincide. No ridge:
+        // any shrinkage of the betas would break the analytic tau gradient below
+        const Eigen::Vector4d beta = a.ldlt().solve(b);
+
+        NssProfilePoint p;
+        p.parameters = {beta[0], beta[1], beta[2], beta[3], tau1, tau2};
+        for (const auto &o: observations_) {
+            const auto r = regressors(o.maturity, tau1, tau2);
+            const double residual = r.x.dot(beta) - o.yield;
+            // dz/dtau = dz/dx * dx/dtau with dx/dtau = -x / tau; the betas' own derivatives drop out
+            const double dz1 = (beta[1] * loading_slope(r.x1, r.e1, r.l1) +
+                                beta[2] * (loading_slope(r.x1, r.e1, r.l1) + r.e1)) * (-r.x1 / tau1);
+            const double dz2 = beta[3] * (loading_slope(r.x2, r.e2, r.l2) + r.e2) * (-r.x2 / tau2);
+            p.sse += o.weight * residual * residual;
+            p.d_tau1 += 2.0 * o.weight * residual * dz1;
+            p.d_tau2 += 2.0 * o.weight * residual * dz2;
+        }
+        return p;
+    }
+
+    NssFit fit_nss(std::span<const NssObservation> observations, const NssFitOptions &options) {
+        CURVEFORGE_TIME_SCOPE("fitting.nss");
+        const NssProfile profile(observations);
+
+        // The profile is not convex in the taus: seed from the best point of a coarse grid
+        NssProfilePoint best;
+        best.sse = std::numeric_limits<double>::infinity();
+        for (const double tau1: log_grid(options.tau1_bounds, options.grid_points)) {
+            for (const double tau2: log_grid(options.tau2_bounds, options.grid_points)) {
+                auto p = profile.at(tau1, tau2);
+                if (p.sse < best.sse) best = p;
+            }
+        }
+
+        // The optimizer sees the mean squared error in bp^2, O(1) instead of O(1e-8) in yield units.
+        // NLopt asks for the gradient and then the value at the same point: evaluate once for both
+        const double scale = 1e8 / profile.total_weight();
+        std::vector<double> last_x;
+        NssProfilePoint last;
+        auto evaluate = [&](const std::vector<double> &x) -> const NssProfilePoint & {
+            if (x != last_x) {
+                last = profile.at(x[0], x[1]);
+                last_x = x;
+            }
+            return last;
+        };
+        forge::optimization::Convex_Boxed_Optimizer optimizer(
+            forge::optimization::BoxedGradientBasedAlgos::LD_AUGLAG,
+            [&](const std::vector<double> &x) { return scale * evaluate(x).sse; },
+            [&](const std::vector<double> &x) {
+                const auto &p = evaluate(x);
+                return std::vector<double>{scale * p.d_tau1, scale * p.d_tau2};
+            });
+        const auto solution = optimizer.solve(2, std::vector<double>{best.parameters.tau1, best.parameters.tau2},
+                                              {options.tau1_bounds, options.tau2_bounds},
+                                              OptAlgoParams(options.ftol, options.xtol, options.maxeval));
+
+        NssFit fit{best.parameters, 0.0, false};
+        double sse = best.sse;
+        if (solution.feasible && solution.optimal_parameters.size() == 2) {
+            const auto refined = profile.at(solution.optimal_parameters[0].second,
+                                            solution.optimal_parameters[1].second);
+            if (refined.sse <= best.sse) {
+                fit.parameters = refined.parameters;
+                sse = refined.sse;
+                fit.converged = true;
+            }
+        }
+        fit.rmse = std::sqrt(sse / profile.total_weight());
+        return fit;
+    }
+
+    std::vector<NssFit> fit_nss_panel(std::span<const std::vector<NssObservation> > panel,
+                                      const NssFitOptions &options) {
+        std::vector<NssFit> fits(panel.size());
+        tasks::parallel_for(0, panel.size(), [&](std::size_t day) { fits[day] = fit_nss(panel[day], options); });
+        return fits;
+    }
+}
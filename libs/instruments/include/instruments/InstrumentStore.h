@@ -0,0 +1,89 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#ifndef CURVEFORGE_INSTRUMENTSTORE_H
+#define CURVEFORGE_INSTRUMENTSTORE_H
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "FixFloatSwap.h"
+#include "Leg.h"
+
+namespace curve::instruments {
+    // Trade level data that the instrument classes do not carry.
+    struct SwapTradeInfo {
+        std::string trade_id;
+        double fixed_rate = 0.0;
+        bool pay_fixed = true;
+    };
+
+    /**
+     * @brief Contiguous storage for a book of fix/float swaps.
+     *
+     * Swaps keep references to their legs, so the legs live in a preallocated array next to
+     * the swaps and are never relocated. Slots are sized once with reserve_fix_float_swaps();
+     * distinct slots may then be filled concurrently. Slots of trades that failed to build stay
+     * empty and are skipped by the accessors.
+     */
+    class InstrumentStore {
+    public:
+        InstrumentStore() = default;
+
+        InstrumentStore(InstrumentStore &&) noexcept = default;
+
+        InstrumentStore &operator=(InstrumentStore &&) noexcept = default;
+
+        InstrumentStore(const InstrumentStore &) = delete;
+
+        InstrumentStore &operator=(const InstrumentStore &) = delete;
+
+        // Discards any content and creates `count` empty slots.
+        void reserve_fix_float_swaps(std::size_t count);
+
+        // Thread-safe for distinct slots.
+        const FixFloatSwap &emplace_fix_float_swap(std::size_t slot, SwapTradeInfo info, Leg fixed_leg,
+                                                   Leg floating_leg);
+
+        // Build the trade id index; call after all slots are filled.
+        void finalize();
+
+        /**
+         * @brief Finalized deep copy of `slots` (filled ones), renumbered 0..n-1 in the given order.
+         *
+         * Legs get their own copies of their cashflow schedules; legs that shared a schedule
+         * share the copy. Everything is allocated by the calling thread, so a shard built on a
+         * thread pinned to a NUMA node lives in that node's memory (first-touch placement).
+         */
+        [[nodiscard]] InstrumentStore shard(const std::vector<std::size_t> &slots) const;
+
+        [[nodiscard]] std::size_t slot_count() const { return swaps_.size(); }
+
+        // Number of filled slots
+        [[nodiscard]] std::size_t size() const;
+
+        [[nodiscard]] const FixFloatSwap *fix_float_swap(std::size_t slot) const;
+
+        [[nodiscard]] const SwapTradeInfo &trade_info(std::size_t slot) const { return infos_.at(slot); }
+
+        [[nodiscard]] const FixFloatSwap *find(const std::string &trade_id) const;
+
+        template<typename F>
+        void for_each_fix_float_swap(F &&f) const {
+            for (std::size_t i = 0; i < swaps_.size(); ++i) {
+                if (swaps_[i]) f(infos_[i], *swaps_[i]);
+            }
+        }
+
+    private:
+        std::vector<std::optional<Leg> > legs_; // 2 per swap: fixed, floating
+        std::vector<std::optional<FixFloatSwap> > swaps_;
+        std::vector<SwapTradeInfo> infos_;
+        std::unordered_map<std::string, std::size_t> by_trade_id_;
+    };
+}
+
+#endif //CURVEFORGE_INSTRUMENTSTORE_H
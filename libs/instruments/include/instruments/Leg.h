@@ -4,6 +4,8 @@
 
 #ifndef CURVEFORGE_LEG_H
 #define CURVEFORGE_LEG_H
+#include <memory>
+
 #include "Instrument.h"
 #include "time/calendars.hpp"
 #include "time/date.hpp"
@@ -21,6 +23,10 @@ namespace curve::instruments {
             const std::chrono::months &payment_intervals, const time::CalendarBase &calendar,
             const time::BusinessDayConvention &bdc, const time::DayCountConventionBase &dc, const LegType &leg_type);
 
+        // Leg on an already generated (possibly shared) schedule, e.g. from StaticDataCache
+        Leg(double notional, const std::string &currency, std::shared_ptr<const time::Schedule> schedule,
+            LegType leg_type);
+
         [[nodiscard]] const time::Schedule &cashflows_schedule() const;
 
         [[nodiscard]] double notional() const;
@@ -31,7 +37,7 @@ namespace curve::instruments {
 
     private:
         double notional_;
-        time::Schedule schedule_;
+        std::shared_ptr<const time::Schedule> schedule_;
         LegType leg_type_;
     };
 }
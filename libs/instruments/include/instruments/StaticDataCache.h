@@ -0,0 +1,82 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#ifndef CURVEFORGE_STATICDATACACHE_H
+#define CURVEFORGE_STATICDATACACHE_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "time/calendars.hpp"
+#include "time/calendarsenum.hpp"
+#include "time/date.hpp"
+#include "time/date_modifier.hpp"
+#include "time/daycount.hpp"
+#include "time/scheduler.h"
+
+namespace curve::instruments {
+    // Market conventions used when a trade only specifies its currency.
+    struct LegConventions {
+        time::FinancialCalendar calendar;
+        time::BusinessDayConvention bdc;
+        time::DayCountConvention fixed_day_count;
+        time::DayCountConvention float_day_count;
+        int fixed_frequency_months;
+    };
+
+    /**
+     * @brief Thread-safe interning of static data shared by many trades.
+     *
+     * time::Schedule keeps references to its frequency, business day convention, day count and
+     * calendar, so these objects must outlive every leg; the cache owns one instance of each and
+     * returns stable references. Schedules themselves are interned by their full definition, so
+     * trades on the same dates share one generated schedule.
+     */
+    class StaticDataCache {
+    public:
+        StaticDataCache() = default;
+
+        StaticDataCache(const StaticDataCache &) = delete;
+
+        StaticDataCache &operator=(const StaticDataCache &) = delete;
+
+        const time::CalendarBase &calendar(time::FinancialCalendar calendar);
+
+        const time::DayCountConventionBase &day_count(time::DayCountConvention convention);
+
+        const std::chrono::months &months(int count);
+
+        const time::BusinessDayConvention &business_day_convention(time::BusinessDayConvention bdc);
+
+        // Throws std::invalid_argument for currencies without configured conventions.
+        static const LegConventions &conventions(std::string_view currency);
+
+        std::shared_ptr<const time::Schedule> schedule(const time::Date &start, const time::Date &end,
+                                                       int frequency_months, time::BusinessDayConvention bdc,
+                                                       time::DayCountConvention day_count,
+                                                       time::FinancialCalendar calendar);
+
+        [[nodiscard]] std::size_t schedule_count() const;
+
+    private:
+        using ScheduleKey = std::tuple<int, int, int, int, int, int>;
+
+        template<typename Map, typename Key, typename Make>
+        auto &intern(Map &map, const Key &key, Make make);
+
+        mutable std::shared_mutex mutex_;
+        std::map<time::FinancialCalendar, std::shared_ptr<time::CalendarBase> > calendars_;
+        std::map<time::DayCountConvention, std::shared_ptr<time::DayCountConventionBase> > day_counts_;
+        std::map<int, std::unique_ptr<std::chrono::months> > months_;
+        std::map<time::BusinessDayConvention, std::unique_ptr<time::BusinessDayConvention> > bdcs_;
+        std::map<ScheduleKey, std::shared_ptr<const time::Schedule> > schedules_;
+    };
+}
+
+#endif //CURVEFORGE_STATICDATACACHE_H
@@ -11,6 +11,8 @@
 
 namespace curve::instruments {
     Instrument::Instrument(std::string ccy) : currency_(std::move(ccy)) {
-        id_ = to_string(boost::uuids::random_generator{}());
+        // random_generator seeds itself from the OS on construction: keep one per thread.
+        thread_local boost::uuids::random_generator generator;
+        id_ = to_string(generator());
     }
 } // namespace instruments
@@ -0,0 +1,76 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#include "instruments/InstrumentStore.h"
+
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace curve::instruments {
+    void InstrumentStore::reserve_fix_float_swaps(std::size_t count) {
+        by_trade_id_.clear();
+        swaps_.clear();
+        legs_.clear();
+        infos_.clear();
+        // Fixed size from here on: swaps_ refers into legs_.
+        legs_.resize(2 * count);
+        swaps_.resize(count);
+        infos_.resize(count);
+    }
+
+    const FixFloatSwap &InstrumentStore::emplace_fix_float_swap(std::size_t slot, SwapTradeInfo info, Leg fixed_leg,
+                                                                Leg floating_leg) {
+        if (slot >= swaps_.size()) {
+            throw std::out_of_range("InstrumentStore: slot not reserved");
+        }
+        const auto &fixed = legs_[2 * slot].emplace(std::move(fixed_leg));
+        const auto &floating = legs_[2 * slot + 1].emplace(std::move(floating_leg));
+        infos_[slot] = std::move(info);
+        return swaps_[slot].emplace(fixed, floating);
+    }
+
+    void InstrumentStore::finalize() {
+        by_trade_id_.clear();
+        by_trade_id_.reserve(swaps_.size());
+        for (std::size_t i = 0; i < swaps_.size(); ++i) {
+            if (swaps_[i]) by_trade_id_.emplace(infos_[i].trade_id, i);
+        }
+    }
+
+    InstrumentStore InstrumentStore::shard(const std::vector<std::size_t> &slots) const {
+        InstrumentStore copy;
+        copy.reserve_fix_float_swaps(slots.size());
+        std::map<const time::Schedule *, std::shared_ptr<const time::Schedule> > schedules;
+        const auto copy_leg = [&](const Leg &leg) {
+            auto &schedule = schedules[&leg.cashflows_schedule()];
+            if (!schedule) schedule = std::make_shared<const time::Schedule>(leg.cashflows_schedule());
+            return Leg(leg.notional(), leg.currency(), schedule, leg.leg_type());
+        };
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            const auto *swap = fix_float_swap(slots[i]);
+            if (!swap) continue;
+            copy.emplace_fix_float_swap(i, infos_[slots[i]], copy_leg(swap->leg1()), copy_leg(swap->leg2()));
+        }
+        copy.finalize();
+        return copy;
+    }
+
+    std::size_t InstrumentStore::size() const {
+        std::size_t n = 0;
+        for (const auto &s: swaps_) n += s.has_value();
+        return n;
+    }
+
+    const FixFloatSwap *InstrumentStore::fix_float_swap(std::size_t slot) const {
+        const auto &s = swaps_.at(slot);
+        return s ? &*s : nullptr;
+    }
+
+    const FixFloatSwap *InstrumentStore::find(const std::string &trade_id) const {
+        const auto it = by_trade_id_.find(trade_id);
+        return it == by_trade_id_.end() ? nullptr : fix_float_swap(it->second);
+    }
+}
@@ -2,7 +2,8 @@
 // Created by Francisco Nunez on 18.10.2025.
 //
 #include "instruments/Leg.h"
-#include <future>
+#include <stdexcept>
+#include "tasks/ScratchArena.h"
 #include "time/scheduler.h"
 
 using namespace curve::instruments;
@@ -12,13 +13,23 @@ Leg::Leg(const double &notional, const std::string &currency, Date start_date, t
          const std::chrono::months &payment_intervals, const time::CalendarBase &calendar,
          const time::BusinessDayConvention &bdc, const time::DayCountConventionBase &dc,
          const LegType &leg_type) : Instrument(currency), notional_(notional), leg_type_(leg_type),
-                                    schedule_(std::move(
-                                        Scheduler::generate_schedule(start_date, end_date, payment_intervals, bdc, dc,
-                                                                     calendar))) {
+                                    schedule_([&] {
+                                        const tasks::ArenaScope scratch;
+                                        return std::make_shared<const Schedule>(
+                                            Scheduler::generate_schedule(start_date, end_date, payment_intervals, bdc,
+                                                                         dc, calendar, scratch.resource()));
+                                    }()) {
+}
+
+Leg::Leg(double notional, const std::string &currency, std::shared_ptr<const Schedule> schedule, LegType leg_type)
+    : Instrument(currency), notional_(notional), schedule_(std::move(schedule)), leg_type_(leg_type) {
+    if (!schedule_) {
+        throw std::invalid_argument("Leg requires a schedule.");
+    }
 }
 
 const Schedule &Leg::cashflows_schedule() const {
-    return schedule_;
+    return *schedule_;
 }
 
 double Leg::notional() const {
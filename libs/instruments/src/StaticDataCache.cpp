@@ -0,0 +1,100 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#include "instruments/StaticDataCache.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "tasks/ScratchArena.h"
+#include "time/calendar_factory.hpp"
+#include "time/date.hpp"
+
+namespace curve::instruments {
+    using namespace curve::time;
+
+    template<typename Map, typename Key, typename Make>
+    auto &StaticDataCache::intern(Map &map, const Key &key, Make make) {
+        {
+            std::shared_lock lock(mutex_);
+            if (const auto it = map.find(key); it != map.end()) return *it->second;
+        }
+        // Build outside the lock; if another thread won the race its instance is kept.
+        auto value = make();
+        std::unique_lock lock(mutex_);
+        return *map.try_emplace(key, std::move(value)).first->second;
+    }
+
+    const CalendarBase &StaticDataCache::calendar(FinancialCalendar calendar) {
+        return intern(calendars_, calendar, [&] { return create_calendar(calendar); });
+    }
+
+    const DayCountConventionBase &StaticDataCache::day_count(DayCountConvention convention) {
+        return intern(day_counts_, convention, [&] { return create_daycount_convention(convention); });
+    }
+
+    const std::chrono::months &StaticDataCache::months(int count) {
+        return intern(months_, count, [&] { return std::make_unique<std::chrono::months>(count); });
+    }
+
+    const BusinessDayConvention &StaticDataCache::business_day_convention(BusinessDayConvention bdc) {
+        return intern(bdcs_, bdc, [&] { return std::make_unique<BusinessDayConvention>(bdc); });
+    }
+
+    const LegConventions &StaticDataCache::conventions(std::string_view currency) {
+        using DC = DayCountConvention;
+        using BDC = BusinessDayConvention;
+        static const std::unordered_map<std::string_view, LegConventions> table = {
+            {"EUR", {FinancialCalendar::Euronext, BDC::MODIFIED_FOLLOWING, DC::THIRTY_360, DC::ACT_360, 12}},
+            {"USD", {FinancialCalendar::NYSE, BDC::MODIFIED_FOLLOWING, DC::ACT_360, DC::ACT_360, 12}},
+            {"GBP", {FinancialCalendar::LSE, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 12}},
+            {"JPY", {FinancialCalendar::TSE, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 6}},
+            {"HKD", {FinancialCalendar::HKEX, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 3}},
+            {"CNY", {FinancialCalendar::SSE, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 3}},
+            {"AUD", {FinancialCalendar::ASX, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 6}},
+            {"CAD", {FinancialCalendar::TSX, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 6}},
+            {"INR", {FinancialCalendar::NSE, BDC::MODIFIED_FOLLOWING, DC::ACT_365F, DC::ACT_365F, 6}},
+        };
+        const auto it = table.find(currency);
+        if (it == table.end()) {
+            throw std::invalid_argument("No leg conventions for currency " + std::string(currency));
+        }
+        return it->second;
+    }
+
+    std::shared_ptr<const Schedule> StaticDataCache::schedule(const Date &start, const Date &end,
+                                                              int frequency_months, BusinessDayConvention bdc,
+                                                              DayCountConvention day_count,
+                                                              FinancialCalendar calendar) {
+        const ScheduleKey key{
+            time::to_serial(start), time::to_serial(end),
+            frequency_months, static_cast<int>(bdc), static_cast<int>(day_count), static_cast<int>(calendar)
+        };
+        {
+            std::shared_lock lock(mutex_);
+            if (const auto it = schedules_.find(key); it != schedules_.end()) return it->second;
+        }
+
+        // References handed to the schedule are owned by this cache.
+        const auto &freq = months(frequency_months);
+        const auto &bdc_ref = business_day_convention(bdc);
+        const auto &dc = this->day_count(day_count);
+        const auto &cal = this->calendar(calendar);
+        std::shared_ptr<const Schedule> generated;
+        {
+            const tasks::ArenaScope scratch;
+            generated = std::make_shared<const Schedule>(
+                Scheduler::generate_schedule(start, end, freq, bdc_ref, dc, cal, scratch.resource()));
+        }
+
+        std::unique_lock lock(mutex_);
+        return schedules_.try_emplace(key, std::move(generated)).first->second;
+    }
+
+    std::size_t StaticDataCache::schedule_count() const {
+        std::shared_lock lock(mutex_);
+        return schedules_.size();
+    }
+}
@@ -0,0 +1,279 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_BINARYSNAPSHOT_H
+#define CURVEFORGE_IO_BINARYSNAPSHOT_H
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BinarySnapshotFormat.h"
+#include "MappedFile.h"
+#include "SnapshotRecords.h"
+
+namespace curve::io {
+    /**
+     * @brief Serializes SnapshotData into the binary layout described in BinarySnapshotFormat.h.
+     */
+    class BinarySnapshotWriter {
+    public:
+        static std::vector<std::byte> encode(const SnapshotData &data);
+
+        static void write_file(const SnapshotData &data, const std::string &path);
+    };
+
+    /**
+     * @brief Resolves StringRefs against the STRINGS section.
+     */
+    class StringTable {
+    public:
+        StringTable() = default;
+
+        StringTable(const char *base, std::size_t size) : base_(base), size_(size) {
+        }
+
+        [[nodiscard]] std::string_view operator[](binary::StringRef ref) const;
+
+    private:
+        const char *base_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    class YieldCurveView {
+    public:
+        [[nodiscard]] std::string_view curve_id() const { return strings_[entry_->curve_id]; }
+        [[nodiscard]] std::string_view currency() const { return strings_[entry_->currency]; }
+        [[nodiscard]] std::string_view curve_type() const { return strings_[entry_->curve_type]; }
+        [[nodiscard]] std::string_view day_count() const { return strings_[entry_->day_count]; }
+        [[nodiscard]] std::string_view compounding() const { return strings_[entry_->compounding]; }
+        [[nodiscard]] std::string_view interpolation() const { return strings_[entry_->interpolation]; }
+        [[nodiscard]] std::string_view reference_index() const { return strings_[entry_->reference_index]; }
+        [[nodiscard]] std::string_view calendar_name() const { return strings_[entry_->calendar_name]; }
+
+        [[nodiscard]] std::string_view business_day_convention() const {
+            return strings_[entry_->business_day_convention];
+        }
+
+        [[nodiscard]] time::Date as_of() const;
+
+        [[nodiscard]] std::size_t size() const { return entry_->point_count; }
+
+        [[nodiscard]] std::string_view tenor(std::size_t i) const { return strings_[tenors_[i]]; }
+
+        [[nodiscard]] std::optional<time::Date> maturity_date(std::size_t i) const;
+
+        // Maturity day serials (kNoDate when the point only has a tenor)
+        [[nodiscard]] std::span<const std::int32_t> maturity_serials() const { return {maturities_, size()}; }
+
+        [[nodiscard]] std::span<const double> values() const { return {values_, size()}; }
+
+        [[nodiscard]] YieldCurveRecord to_record() const;
+
+    private:
+        friend class MappedSnapshot;
+
+        const binary::YieldCurveEntry *entry_ = nullptr;
+        const binary::StringRef *tenors_ = nullptr;
+        const std::int32_t *maturities_ = nullptr;
+        const double *values_ = nullptr;
+        StringTable strings_;
+    };
+
+    class VolSurfaceView {
+    public:
+        [[nodiscard]] std::string_view underlying_id() const { return strings_[entry_->underlying_id]; }
+        [[nodiscard]] std::string_view quote_type() const { return strings_[entry_->quote_type]; }
+        [[nodiscard]] std::string_view strike_dimension() const { return strings_[entry_->strike_dimension]; }
+        [[nodiscard]] std::string_view strike_unit() const { return strings_[entry_->strike_unit]; }
+
+        [[nodiscard]] std::string_view expiry_interpolation() const {
+            return strings_[entry_->expiry_interpolation];
+        }
+
+        [[nodiscard]] std::string_view strike_interpolation() const {
+            return strings_[entry_->strike_interpolation];
+        }
+
+        [[nodiscard]] time::Date as_of() const;
+
+        [[nodiscard]] std::size_t size() const { return entry_->point_count; }
+
+        [[nodiscard]] std::string_view expiry(std::size_t i) const { return strings_[expiries_[i]]; }
+
+        [[nodiscard]] std::span<const double> expiry_years() const { return {expiry_years_, size()}; }
+        [[nodiscard]] std::span<const double> strikes() const { return {strikes_, size()}; }
+        [[nodiscard]] std::span<const double> volatilities() const { return {volatilities_, size()}; }
+        [[nodiscard]] std::span<const double> forwards() const { return {forwards_, size()}; }
+        [[nodiscard]] std::span<const double> total_variances() const { return {total_variances_, size()}; }
+
+        [[nodiscard]] VolSurfaceHeaderRecord header_record() const;
+
+        [[nodiscard]] VolSurfaceRecord to_record() const;
+
+    private:
+        friend class MappedSnapshot;
+
+        const binary::VolSurfaceEntry *entry_ = nullptr;
+        const binary::StringRef *expiries_ = nullptr;
+        const double *expiry_years_ = nullptr;
+        const double *strikes_ = nullptr;
+        const double *volatilities_ = nullptr;
+        const double *forwards_ = nullptr;
+        const double *total_variances_ = nullptr;
+        StringTable strings_;
+    };
+
+    class InstrumentQuoteView {
+    public:
+        [[nodiscard]] std::string_view instrument_id() const { return strings_[entry_->instrument_id]; }
+
+        [[nodiscard]] std::size_t size() const { return entry_->quote_count; }
+
+        [[nodiscard]] std::span<const double> values() const { return {values_, size()}; }
+        [[nodiscard]] std::span<const double> sizes() const { return {sizes_, size()}; }
+
+        // Milliseconds since epoch, kNoInstant when absent
+        [[nodiscard]] std::span<const std::int64_t> timestamps() const { return {timestamps_, size()}; }
+
+        [[nodiscard]] std::string_view side(std::size_t i) const { return strings_[sides_[i]]; }
+        [[nodiscard]] std::string_view value_type(std::size_t i) const { return strings_[value_types_[i]]; }
+        [[nodiscard]] std::string_view currency(std::size_t i) const { return strings_[currencies_[i]]; }
+        [[nodiscard]] std::string_view quality(std::size_t i) const { return strings_[qualities_[i]]; }
+        [[nodiscard]] std::string_view source(std::size_t i) const { return strings_[sources_[i]]; }
+
+        [[nodiscard]] InstrumentQuoteRecord to_record() const;
+
+    private:
+        friend class QuoteSetView;
+
+        const binary::InstrumentEntry *entry_ = nullptr;
+        const double *values_ = nullptr;
+        const double *sizes_ = nullptr;
+        const std::int64_t *timestamps_ = nullptr;
+        const binary::StringRef *sides_ = nullptr;
+        const binary::StringRef *value_types_ = nullptr;
+        const binary::StringRef *currencies_ = nullptr;
+        const binary::StringRef *qualities_ = nullptr;
+        const binary::StringRef *sources_ = nullptr;
+        StringTable strings_;
+    };
+
+    class QuoteSetView {
+    public:
+        [[nodiscard]] time::Date as_of() const;
+
+        [[nodiscard]] std::optional<time::Instant> snapshot_time() const;
+
+        [[nodiscard]] std::string_view feed_name() const { return strings_[entry_->feed_name]; }
+        [[nodiscard]] std::string_view scenario_name() const { return strings_[entry_->scenario_name]; }
+
+        [[nodiscard]] std::size_t size() const { return entry_->instrument_count; }
+
+        [[nodiscard]] InstrumentQuoteView instrument(std::size_t i) const;
+
+        // Global position of the first instrument, for MappedSnapshot::instrument_quotes()
+        [[nodiscard]] std::size_t first_instrument() const { return entry_->first_instrument; }
+
+        [[nodiscard]] QuoteSetRecord to_record() const;
+
+    private:
+        friend class MappedSnapshot;
+
+        const binary::QuoteSetEntry *entry_ = nullptr;
+        const binary::QuoteSetsTable *table_ = nullptr;
+        const std::byte *section_ = nullptr;
+        StringTable strings_;
+    };
+
+    /**
+     * @brief Read-only, memory-mapped binary snapshot.
+     *
+     * Opening validates the file header and the section tables only (O(number of sections)),
+     * the OS pages point data in on first access. Views are cheap value types pointing into
+     * the mapping and must not outlive the MappedSnapshot. Lookups by id use the INDEX section
+     * when the file has one.
+     */
+    class MappedSnapshot {
+    public:
+        static MappedSnapshot open(const std::string &path);
+
+        // Non-owning; data must stay alive and be at least 8-byte aligned.
+        static MappedSnapshot from_buffer(const std::byte *data, std::size_t size);
+
+        MappedSnapshot(MappedSnapshot &&other) noexcept = default;
+
+        MappedSnapshot &operator=(MappedSnapshot &&other) noexcept = default;
+
+        MappedSnapshot(const MappedSnapshot &) = delete;
+
+        MappedSnapshot &operator=(const MappedSnapshot &) = delete;
+
+        [[nodiscard]] SnapshotHeaderRecord header() const;
+
+        [[nodiscard]] std::size_t yield_curve_count() const;
+
+        [[nodiscard]] YieldCurveView yield_curve(std::size_t i) const;
+
+        [[nodiscard]] std::optional<YieldCurveView> find_yield_curve(std::string_view curve_id) const;
+
+        [[nodiscard]] std::size_t vol_surface_count() const;
+
+        [[nodiscard]] VolSurfaceView vol_surface(std::size_t i) const;
+
+        [[nodiscard]] std::optional<VolSurfaceView> find_vol_surface(std::string_view underlying_id) const;
+
+        [[nodiscard]] std::size_t quote_set_count() const;
+
+        [[nodiscard]] QuoteSetView quote_set(std::size_t i) const;
+
+        // First set with this feed name (and scenario name, unless empty)
+        [[nodiscard]] std::optional<QuoteSetView> find_quote_set(std::string_view feed_name,
+                                                                 std::string_view scenario_name = {}) const;
+
+        [[nodiscard]] std::optional<InstrumentQuoteView> find_instrument_quotes(std::size_t quote_set,
+                                                                                std::string_view instrument_id) const;
+
+        // Whether the file carries an INDEX section (find_* are then O(log n))
+        [[nodiscard]] bool has_index() const { return index_ != nullptr; }
+
+        // Materialize everything (copies)
+        [[nodiscard]] SnapshotData to_snapshot_data() const;
+
+        [[nodiscard]] const std::byte *data() const { return base_; }
+        [[nodiscard]] std::size_t size_bytes() const { return size_; }
+
+    private:
+        MappedSnapshot(const std::byte *base, std::size_t size, MappedFile file);
+
+        void index_sections();
+
+        void check_index() const;
+
+        // Positions whose key matches, from the sorted entries of one index table (and group)
+        [[nodiscard]] std::span<const binary::IndexEntry> index_range(std::uint64_t offset, std::uint64_t count,
+                                                                      std::string_view key,
+                                                                      std::uint32_t group = 0) const;
+
+        MappedFile file_; // empty for from_buffer()
+        const std::byte *base_ = nullptr;
+        std::size_t size_ = 0;
+
+        StringTable strings_;
+        const binary::HeaderTable *header_ = nullptr;
+        const std::byte *curves_section_ = nullptr;
+        const binary::YieldCurvesTable *curves_ = nullptr;
+        const std::byte *surfaces_section_ = nullptr;
+        const binary::VolSurfacesTable *surfaces_ = nullptr;
+        const std::byte *quotes_section_ = nullptr;
+        const binary::QuoteSetsTable *quotes_ = nullptr;
+        const std::byte *index_section_ = nullptr;
+        const binary::IndexTable *index_ = nullptr;
+    };
+}
+
+#endif //CURVEFORGE_IO_BINARYSNAPSHOT_H
@@ -0,0 +1,193 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_BINARYSNAPSHOTFORMAT_H
+#define CURVEFORGE_IO_BINARYSNAPSHOTFORMAT_H
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * On-disk layout of a binary market data snapshot (".cfsnap").
+ *
+ *   FileHeader | SectionEntry[section_count] | section ... | section ...
+ *
+ * Every section starts at a kAlignment boundary and begins with its own table struct
+ * (counts + offsets of its arrays, relative to the section start). Point data is stored
+ * as structure-of-arrays, each array again aligned to kAlignment, so a reader can map the
+ * file and hand out spans without copying. All strings live in a single deduplicated
+ * STRINGS section and are referenced by (offset, length).
+ *
+ * Integers and doubles are stored in native (little-endian) byte order. Dates are day
+ * serials since 1970-01-01, instants are milliseconds since the Unix epoch; absent optional
+ * values use kNoDate / kNoInstant / NaN.
+ *
+ * Versioning: FileHeader::version is bumped on incompatible layout changes; each section
+ * carries its own version and readers skip section kinds they do not know (files written
+ * before the INDEX section existed therefore still open, with linear lookups).
+ */
+namespace curve::io::binary {
+    inline constexpr char kMagic[8] = {'C', 'F', 'S', 'N', 'A', 'P', '\0', '\0'};
+    inline constexpr std::uint32_t kFormatVersion = 1;
+    inline constexpr std::uint64_t kAlignment = 64;
+
+    inline constexpr std::int32_t kNoDate = std::numeric_limits<std::int32_t>::min();
+    inline constexpr std::int64_t kNoInstant = std::numeric_limits<std::int64_t>::min();
+
+    enum class SectionKind : std::uint32_t {
+        STRINGS = 1,
+        HEADER = 2,
+        YIELD_CURVES = 3,
+        VOL_SURFACES = 4,
+        QUOTE_SETS = 5,
+        INDEX = 6
+    };
+
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t section_count;
+        std::uint64_t file_size;
+        std::uint64_t reserved;
+    };
+
+    struct SectionEntry {
+        std::uint32_t kind; // SectionKind
+        std::uint32_t version;
+        std::uint64_t offset; // from start of file
+        std::uint64_t size;
+        std::uint64_t reserved;
+    };
+
+    struct StringRef {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    // HEADER section
+    struct HeaderTable {
+        std::int32_t as_of;
+        std::int32_t reserved;
+        std::int64_t snapshot_time;
+        StringRef scenario_name;
+        StringRef source;
+        StringRef snapshot_id;
+        StringRef reserved_ref;
+    };
+
+    // YIELD_CURVES section
+    struct YieldCurvesTable {
+        std::uint64_t curve_count;
+        std::uint64_t point_count;
+        std::uint64_t curves_offset; // YieldCurveEntry[curve_count]
+        std::uint64_t tenor_offset; // StringRef[point_count]
+        std::uint64_t maturity_offset; // int32[point_count]
+        std::uint64_t value_offset; // double[point_count]
+    };
+
+    struct YieldCurveEntry {
+        StringRef curve_id;
+        StringRef currency;
+        StringRef curve_type;
+        StringRef day_count;
+        StringRef compounding;
+        StringRef interpolation;
+        StringRef reference_index;
+        StringRef calendar_name;
+        StringRef business_day_convention;
+        std::int32_t as_of;
+        std::uint32_t first_point;
+        std::uint32_t point_count;
+        std::uint32_t reserved;
+    };
+
+    // VOL_SURFACES section
+    struct VolSurfacesTable {
+        std::uint64_t surface_count;
+        std::uint64_t point_count;
+        std::uint64_t surfaces_offset; // VolSurfaceEntry[surface_count]
+        std::uint64_t expiry_offset; // StringRef[point_count]
+        std::uint64_t expiry_years_offset; // double[point_count], expiry tenor pre-converted to years
+        std::uint64_t strike_offset; // double[point_count]
+        std::uint64_t volatility_offset; // double[point_count]
+        std::uint64_t forward_offset; // double[point_count], NaN when absent
+        std::uint64_t total_variance_offset; // double[point_count], NaN when absent
+    };
+
+    struct VolSurfaceEntry {
+        StringRef underlying_id;
+        StringRef quote_type;
+        StringRef strike_dimension;
+        StringRef strike_unit;
+        StringRef expiry_interpolation;
+        StringRef strike_interpolation;
+        std::int32_t as_of;
+        std::uint32_t first_point;
+        std::uint32_t point_count;
+        std::uint32_t reserved;
+    };
+
+    // QUOTE_SETS section
+    struct QuoteSetsTable {
+        std::uint64_t set_count;
+        std::uint64_t instrument_count;
+        std::uint64_t quote_count;
+        std::uint64_t sets_offset; // QuoteSetEntry[set_count]
+        std::uint64_t instruments_offset; // InstrumentEntry[instrument_count]
+        std::uint64_t value_offset; // double[quote_count]
+        std::uint64_t size_offset; // double[quote_count], NaN when absent
+        std::uint64_t timestamp_offset; // int64[quote_count], kNoInstant when absent
+        std::uint64_t side_offset; // StringRef[quote_count]
+        std::uint64_t value_type_offset; // StringRef[quote_count]
+        std::uint64_t currency_offset; // StringRef[quote_count]
+        std::uint64_t quality_offset; // StringRef[quote_count]
+        std::uint64_t source_offset; // StringRef[quote_count]
+    };
+
+    struct QuoteSetEntry {
+        std::int32_t as_of;
+        std::uint32_t first_instrument;
+        std::int64_t snapshot_time;
+        StringRef feed_name;
+        StringRef scenario_name;
+        std::uint32_t instrument_count;
+        std::uint32_t reserved;
+    };
+
+    struct InstrumentEntry {
+        StringRef instrument_id;
+        std::uint32_t first_quote;
+        std::uint32_t quote_count;
+    };
+
+    // INDEX section: lookup tables built at write time so readers can locate single objects by
+    // id with a binary search. Every entry array is sorted by key (byte-wise); instrument entries
+    // by (group, key). Optional: readers fall back to a linear search when it is absent.
+    struct IndexTable {
+        std::uint64_t curve_count;
+        std::uint64_t surface_count;
+        std::uint64_t quote_set_count;
+        std::uint64_t instrument_count;
+        std::uint64_t curves_offset; // IndexEntry[curve_count], key = curveId
+        std::uint64_t surfaces_offset; // IndexEntry[surface_count], key = underlyingId
+        std::uint64_t quote_sets_offset; // IndexEntry[quote_set_count], key = feedName
+        std::uint64_t instruments_offset; // IndexEntry[instrument_count], key = instrumentId, group = quote set
+    };
+
+    struct IndexEntry {
+        StringRef key;
+        std::uint32_t position; // index of the object in its section
+        std::uint32_t group;
+    };
+
+    // Section versions written by this build
+    inline constexpr std::uint32_t kStringsVersion = 1;
+    inline constexpr std::uint32_t kHeaderVersion = 1;
+    inline constexpr std::uint32_t kYieldCurvesVersion = 1;
+    inline constexpr std::uint32_t kVolSurfacesVersion = 1;
+    inline constexpr std::uint32_t kQuoteSetsVersion = 1;
+    inline constexpr std::uint32_t kIndexVersion = 1;
+}
+
+#endif //CURVEFORGE_IO_BINARYSNAPSHOTFORMAT_H
@@ -0,0 +1,94 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_CURVEBUILDER_H
+#define CURVEFORGE_IO_CURVEBUILDER_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "BinarySnapshot.h"
+#include "SnapshotRecords.h"
+#include "curve/ICurve.h"
+#include "time/calendarsenum.hpp"
+#include "time/date_modifier.hpp"
+#include "time/daycount.hpp"
+
+namespace curve::io {
+    // yield.xsd DayCountConvention literal -> time::DayCountConvention. ACT_ACT_ICMA and THIRTYE_360
+    // are not implemented and throw std::invalid_argument, as do unknown literals.
+    time::DayCountConvention day_count_of(std::string_view literal);
+
+    // yield.xsd InterpolationType literal -> InterpolationMode. An absent hint means LINEAR_ZERO;
+    // NONE, CUBIC_SPLINE and unknown literals throw std::invalid_argument.
+    InterpolationMode curve_interpolation_of(std::string_view literal);
+
+    // Free-text calendarName -> FinancialCalendar: enum spelling or exchange name (case-insensitive),
+    // TARGET is accepted for Euronext. Throws on unknown names.
+    time::FinancialCalendar calendar_of(std::string_view name);
+
+    // as_of + tenor ("3D", "2W", "6M", "10Y"), unadjusted
+    time::Date tenor_to_date(const time::Date &as_of, std::string_view tenor);
+
+    /**
+     * @brief Resolves point tenors to maturity dates: as_of + tenor, rolled with the curve's
+     * businessDayConvention on its calendarName.
+     *
+     * Without a calendar dates are left unadjusted; a calendar without a convention rolls
+     * MODIFIED_FOLLOWING. NEAREST picks the closer of the following and preceding business days.
+     */
+    class TenorResolver {
+    public:
+        TenorResolver(const time::Date &as_of, std::string_view calendar_name,
+                      std::string_view business_day_convention);
+
+        [[nodiscard]] time::Date operator()(std::string_view tenor) const;
+
+    private:
+        time::Date as_of_;
+        std::shared_ptr<time::CalendarBase> calendar_; // null: no adjustment
+        time::BusinessDayConvention convention_ = time::BusinessDayConvention::UNADJUSTED;
+        bool nearest_ = false;
+    };
+
+    /**
+     * @brief Build a zero-rate curve from snapshot points.
+     *
+     * ZERO_RATE / OIS_ZERO values are converted from the curve's compounding to continuous
+     * compounding, DISCOUNT_FACTOR values to continuously compounded zero rates. Points use their
+     * maturityDate when given, otherwise the tenor resolved by TenorResolver. The interpolation hint
+     * selects the curve's InterpolationMode. Other curve types throw std::invalid_argument.
+     *
+     * A non-zero zero_shift is added to every continuously compounded pillar rate (parallel
+     * bump, e.g. 1e-4 for one basis point).
+     */
+    std::shared_ptr<ICurve> build_yield_curve(const YieldCurveRecord &record, double zero_shift = 0.0);
+
+    // Same, reading the points straight from the mapped snapshot.
+    std::shared_ptr<ICurve> build_yield_curve(const YieldCurveView &view, double zero_shift = 0.0);
+
+    using YieldCurveMap = std::map<std::string, std::shared_ptr<ICurve> >; // by curve id
+
+    /**
+     * @brief Build every yield curve of a snapshot, spread over up to `threads` tasks.
+     *
+     * The tasks run on tasks::Scheduler::current(), so a build started from inside a parallel
+     * job shares that job's threads; threads <= 1 builds on the calling thread.
+     * The first failing curve aborts the batch and its exception is rethrown; duplicate curve
+     * ids throw std::invalid_argument.
+     */
+    YieldCurveMap build_yield_curves(const MappedSnapshot &snapshot,
+                                     std::size_t threads = std::thread::hardware_concurrency(),
+                                     double zero_shift = 0.0);
+
+    YieldCurveMap build_yield_curves(const std::vector<YieldCurveRecord> &curves,
+                                     std::size_t threads = std::thread::hardware_concurrency(),
+                                     double zero_shift = 0.0);
+}
+
+#endif //CURVEFORGE_IO_CURVEBUILDER_H
@@ -0,0 +1,72 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_LAZYSNAPSHOTLOADER_H
+#define CURVEFORGE_IO_LAZYSNAPSHOTLOADER_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+
+#include "BinarySnapshot.h"
+#include "curve/ICurve.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::io {
+    /**
+     * @brief Materialises single curves / surfaces of a binary snapshot on demand.
+     *
+     * Opening maps the file and reads the section tables only; yield_curve() and vol_surface()
+     * locate the object through the snapshot INDEX, build it on first use and cache it, so a job
+     * that needs two curves touches two curves whatever the snapshot size. Thread-safe: concurrent
+     * first requests for the same id may both build, the first one cached wins.
+     *
+     * Every caller shares the cached object, so it is handed out const. A job that needs to change
+     * its curve takes clone(); surfaces are not copyable and are rebuilt from the snapshot view
+     * (build_vol_surface) instead.
+     */
+    class LazySnapshotLoader {
+    public:
+        explicit LazySnapshotLoader(const std::string &path);
+
+        explicit LazySnapshotLoader(MappedSnapshot snapshot);
+
+        LazySnapshotLoader(const LazySnapshotLoader &) = delete;
+
+        LazySnapshotLoader &operator=(const LazySnapshotLoader &) = delete;
+
+        [[nodiscard]] const MappedSnapshot &snapshot() const { return snapshot_; }
+
+        // Throws std::out_of_range when the snapshot has no such curve / surface
+        std::shared_ptr<const ICurve> yield_curve(std::string_view curve_id);
+
+        std::shared_ptr<const volatility::ImpliedVolSurface> vol_surface(std::string_view underlying_id);
+
+        // Quotes are read in place from the mapping (no caching needed)
+        [[nodiscard]] std::optional<InstrumentQuoteView> instrument_quotes(std::string_view feed_name,
+                                                                           std::string_view instrument_id) const;
+
+        [[nodiscard]] std::size_t cached_yield_curves() const;
+
+        [[nodiscard]] std::size_t cached_vol_surfaces() const;
+
+        void clear_cache();
+
+    private:
+        template<typename T, typename Build>
+        std::shared_ptr<T> cached(std::map<std::string, std::shared_ptr<T>, std::less<> > &cache, std::string_view id,
+                                  Build build);
+
+        MappedSnapshot snapshot_;
+        mutable std::shared_mutex mutex_;
+        std::map<std::string, std::shared_ptr<const ICurve>, std::less<> > curves_;
+        std::map<std::string, std::shared_ptr<const volatility::ImpliedVolSurface>, std::less<> > surfaces_;
+    };
+}
+
+#endif //CURVEFORGE_IO_LAZYSNAPSHOTLOADER_H
@@ -0,0 +1,58 @@
+//
+// Created by Francisco Nunez on 06.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_LIVESNAPSHOT_H
+#define CURVEFORGE_IO_LIVESNAPSHOT_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "CurveBuilder.h"
+#include "SnapshotDelta.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::io {
+    /**
+     * @brief An intraday snapshot together with its built curves and surfaces, advanced by deltas.
+     *
+     * apply() patches the records and rebuilds only the curves / surfaces the delta touches (in
+     * parallel); every other object keeps its instance, so callers can use the returned Changes
+     * to recalibrate or reprice just what depends on the rebuilt ids.
+     */
+    class LiveSnapshot {
+    public:
+        using VolSurfaceMap = std::map<std::string, std::shared_ptr<volatility::ImpliedVolSurface> >;
+
+        struct Changes {
+            std::vector<std::string> rebuilt_curves;
+            std::vector<std::string> removed_curves;
+            std::vector<std::string> rebuilt_surfaces;
+            std::vector<std::string> removed_surfaces;
+            bool quotes_changed = false;
+        };
+
+        explicit LiveSnapshot(SnapshotData data, std::size_t threads = std::thread::hardware_concurrency());
+
+        /**
+         * @brief Advance to the next snapshot version. If the delta does not apply, or a touched
+         * object fails to build, the exception propagates and the LiveSnapshot is unchanged.
+         */
+        Changes apply(const SnapshotDelta &delta);
+
+        [[nodiscard]] const SnapshotData &data() const { return data_; }
+        [[nodiscard]] const YieldCurveMap &yield_curves() const { return curves_; }
+        [[nodiscard]] const VolSurfaceMap &vol_surfaces() const { return surfaces_; }
+
+    private:
+        SnapshotData data_;
+        YieldCurveMap curves_;
+        VolSurfaceMap surfaces_;
+        std::size_t threads_;
+    };
+}
+
+#endif //CURVEFORGE_IO_LIVESNAPSHOT_H
@@ -0,0 +1,43 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_MAPPEDFILE_H
+#define CURVEFORGE_IO_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace curve::io {
+    /**
+     * @brief Read-only POSIX memory mapping of a whole file (move-only RAII).
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+
+        explicit MappedFile(const std::string &path);
+
+        MappedFile(MappedFile &&other) noexcept;
+
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        MappedFile(const MappedFile &) = delete;
+
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile();
+
+        [[nodiscard]] const std::byte *data() const { return static_cast<const std::byte *>(data_); }
+        [[nodiscard]] const char *chars() const { return static_cast<const char *>(data_); }
+        [[nodiscard]] std::size_t size() const { return size_; }
+
+    private:
+        void release() noexcept;
+
+        void *data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}
+
+#endif //CURVEFORGE_IO_MAPPEDFILE_H
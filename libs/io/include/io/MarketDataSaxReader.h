@@ -0,0 +1,67 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_MARKETDATASAXREADER_H
+#define CURVEFORGE_IO_MARKETDATASAXREADER_H
+
+#include <functional>
+#include <string>
+
+#include "SnapshotRecords.h"
+
+namespace curve::io {
+    /**
+     * @brief Callbacks invoked by MarketDataSaxReader, on the parsing thread, as soon as each
+     * object of a MarketDataSnapshot document is complete. Unset callbacks are skipped.
+     */
+    struct MarketDataCallbacks {
+        std::function<void(const SnapshotHeaderRecord &)> on_header;
+        std::function<void(YieldCurveRecord &&)> on_yield_curve;
+
+        std::function<void(const VolSurfaceHeaderRecord &)> on_vol_surface_begin;
+        std::function<void(const VolSurfaceHeaderRecord &, const VolPointRecord &)> on_vol_point;
+        std::function<void(const VolSurfaceHeaderRecord &)> on_vol_surface_end;
+
+        std::function<void(const QuoteSetHeaderRecord &)> on_quote_set_begin;
+        std::function<void(const QuoteSetHeaderRecord &, InstrumentQuoteRecord &&)> on_instrument_quote;
+        std::function<void(const QuoteSetHeaderRecord &)> on_quote_set_end;
+    };
+
+    /**
+     * @brief Streaming (Xerces SAX2) reader for marketdata.xsd documents.
+     *
+     * Unlike the generated DOM binding, no tree is built: at any time only the current yield
+     * curve, vol point or instrument quote is held in memory, so snapshots of hundreds of MB are
+     * processed with bounded memory and consumers can start working before the file is loaded.
+     * Schema validation is not performed; malformed values raise std::runtime_error.
+     */
+    class MarketDataSaxReader {
+    public:
+        explicit MarketDataSaxReader(MarketDataCallbacks callbacks);
+
+        ~MarketDataSaxReader();
+
+        MarketDataSaxReader(const MarketDataSaxReader &) = delete;
+
+        MarketDataSaxReader &operator=(const MarketDataSaxReader &) = delete;
+
+        // Parse a file; the file is read incrementally.
+        void parse_file(const std::string &path);
+
+        // Parse an in-memory document.
+        void parse_buffer(const char *data, std::size_t size);
+
+        /**
+         * @brief Convenience: collect the whole document into SnapshotData (no DOM involved).
+         */
+        static SnapshotData read_file(const std::string &path);
+
+        static SnapshotData read_buffer(const char *data, std::size_t size);
+
+    private:
+        MarketDataCallbacks callbacks_;
+    };
+}
+
+#endif //CURVEFORGE_IO_MARKETDATASAXREADER_H
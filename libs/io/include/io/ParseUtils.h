@@ -0,0 +1,37 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_PARSEUTILS_H
+#define CURVEFORGE_IO_PARSEUTILS_H
+
+#include <string>
+#include <string_view>
+
+#include "time/date.hpp"
+#include "time/instant.h"
+
+namespace curve::io {
+    /**
+     * @brief Text helpers for XML simple types (xs:date, xs:dateTime, xs:double).
+     * All functions throw std::invalid_argument on malformed input.
+     */
+    std::string_view trim(std::string_view s) noexcept;
+
+    // xs:date, "YYYY-MM-DD" with an optional timezone suffix which is ignored.
+    time::Date parse_date(std::string_view s);
+
+    // xs:dateTime, "YYYY-MM-DDThh:mm:ss[.fff][Z|(+|-)hh:mm]" converted to UTC.
+    time::Instant parse_date_time(std::string_view s);
+
+    double parse_double(std::string_view s);
+
+    bool parse_bool(std::string_view s);
+
+    // Inverse of parse_date / parse_date_time (UTC, millisecond precision).
+    std::string format_date(const time::Date &d);
+
+    std::string format_date_time(const time::Instant &t);
+}
+
+#endif //CURVEFORGE_IO_PARSEUTILS_H
@@ -0,0 +1,64 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_PORTFOLIOLOADER_H
+#define CURVEFORGE_IO_PORTFOLIOLOADER_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PortfolioRecords.h"
+#include "instruments/InstrumentStore.h"
+#include "instruments/StaticDataCache.h"
+
+namespace curve::io {
+    struct PortfolioLoadOptions {
+        std::size_t threads = std::thread::hardware_concurrency();
+        std::size_t chunk_bytes = 4u << 20; // target size of one parse chunk
+    };
+
+    struct PortfolioLoadResult {
+        std::string name;
+        std::string key;
+        instruments::InstrumentStore store;
+        std::size_t trades_read = 0;
+        std::map<std::string, std::size_t> unsupported; // xsi:type -> count
+        std::vector<std::string> errors; // "<trade id>: <reason>" for trades that failed to build
+    };
+
+    /**
+     * @brief Parallel loader for portfolio.xsd documents.
+     *
+     * The file is memory mapped and split at top-level <Instrument> boundaries into chunks of
+     * roughly chunk_bytes. Each chunk is wrapped in the document's root element (to keep its
+     * namespace declarations) and SAX-parsed on a worker thread into TradeRecords; instruments
+     * are then built in parallel straight into their InstrumentStore slots, sharing calendars,
+     * day counts and schedules through the StaticDataCache.
+     *
+     * IRSwap maps to FixFloatSwap: the swap ends on its last cashflow date and starts one float
+     * tenor before its first; conventions come from StaticDataCache::conventions(currency).
+     * Other instrument types are counted in `unsupported` (XCrossCurrencySwap carries no dates).
+     */
+    class PortfolioLoader {
+    public:
+        static PortfolioLoadResult load_file(const std::string &path, instruments::StaticDataCache &cache,
+                                             const PortfolioLoadOptions &options = {});
+
+        static PortfolioLoadResult load_buffer(const char *data, std::size_t size,
+                                               instruments::StaticDataCache &cache,
+                                               const PortfolioLoadOptions &options = {});
+
+        // Parse only (no instrument construction)
+        static std::vector<TradeRecord> read_trades(const char *data, std::size_t size,
+                                                    const PortfolioLoadOptions &options = {});
+
+        static void build_fix_float_swap(const TradeRecord &trade, instruments::StaticDataCache &cache,
+                                         instruments::InstrumentStore &store, std::size_t slot);
+    };
+}
+
+#endif //CURVEFORGE_IO_PORTFOLIOLOADER_H
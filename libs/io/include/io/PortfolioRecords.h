@@ -0,0 +1,41 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_PORTFOLIORECORDS_H
+#define CURVEFORGE_IO_PORTFOLIORECORDS_H
+
+#include <string>
+#include <vector>
+
+#include "time/date.hpp"
+
+namespace curve::io {
+    struct CashFlowRecord {
+        time::Date date{};
+        double amount = 0.0;
+    };
+
+    /**
+     * @brief One portfolio.xsd <Instrument> element. Fields not present on the instrument's
+     * xsi:type are left at their defaults; `type` holds the xsi:type local name ("IRSwap",
+     * "XCrossCurrencySwap", ...).
+     */
+    struct TradeRecord {
+        std::string type;
+        std::string id;
+        std::string name;
+        std::string asset_class;
+
+        // IRSwap
+        double notional = 0.0;
+        double fixed_rate = 0.0;
+        std::string float_index;
+        std::string float_tenor;
+        bool pay_fixed = true;
+        std::string currency;
+        std::vector<CashFlowRecord> cashflows;
+    };
+}
+
+#endif //CURVEFORGE_IO_PORTFOLIORECORDS_H
@@ -0,0 +1,174 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_QUOTEHISTORY_H
+#define CURVEFORGE_IO_QUOTEHISTORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MappedFile.h"
+#include "QuoteHistoryFormat.h"
+#include "SnapshotRecords.h"
+
+namespace curve::io {
+    /**
+     * @brief Appends InstrumentQuoteSets to a columnar quote history file (see QuoteHistoryFormat.h).
+     *
+     * Each append() writes and flushes one block; reopening an existing file continues its
+     * dictionaries. Quotes without a timestamp are stamped with the set's snapshotTime, or with
+     * asOf midnight when that is absent too.
+     */
+    class QuoteHistoryWriter {
+    public:
+        // Creates the file, or reopens it for appending (dropping a torn trailing block).
+        static QuoteHistoryWriter open(const std::string &path);
+
+        QuoteHistoryWriter(QuoteHistoryWriter &&other) noexcept = default;
+
+        QuoteHistoryWriter &operator=(QuoteHistoryWriter &&other) noexcept = default;
+
+        void append(const QuoteSetRecord &quote_set);
+
+        [[nodiscard]] std::size_t block_count() const { return block_count_; }
+
+    private:
+        QuoteHistoryWriter() = default;
+
+        std::uint32_t instrument_code(const std::string &id);
+
+        std::uint16_t label_code(const std::string &label);
+
+        std::string path_;
+        std::ofstream out_;
+        std::size_t block_count_ = 0;
+        std::unordered_map<std::string, std::uint32_t> instruments_;
+        std::unordered_map<std::string, std::uint16_t> labels_;
+        std::vector<std::string> new_instruments_; // introduced by the block being written
+        std::vector<std::string> new_labels_;
+    };
+
+    /**
+     * @brief The quotes of one instrument from one appended set, as columns over the mapping.
+     */
+    class QuoteRun {
+    public:
+        [[nodiscard]] std::string_view instrument_id() const { return instrument_id_; }
+        [[nodiscard]] time::Date as_of() const;
+        [[nodiscard]] std::string_view feed_name() const { return labels_[block_->feed_name]; }
+        [[nodiscard]] std::string_view scenario_name() const { return labels_[block_->scenario_name]; }
+
+        [[nodiscard]] std::size_t size() const { return values_.size(); }
+
+        [[nodiscard]] std::span<const double> values() const { return values_; }
+
+        // NaN when absent
+        [[nodiscard]] std::span<const double> sizes() const { return sizes_; }
+
+        // Milliseconds since base_timestamp_ms()
+        [[nodiscard]] std::span<const std::uint32_t> timestamp_deltas() const { return deltas_; }
+        [[nodiscard]] std::int64_t base_timestamp_ms() const { return base_timestamp_; }
+
+        [[nodiscard]] time::Instant timestamp(std::size_t i) const;
+
+        [[nodiscard]] std::string_view side(std::size_t i) const { return labels_[sides_[i]]; }
+        [[nodiscard]] std::string_view value_type(std::size_t i) const { return labels_[value_types_[i]]; }
+        [[nodiscard]] std::string_view currency(std::size_t i) const { return labels_[currencies_[i]]; }
+        [[nodiscard]] std::string_view quality(std::size_t i) const { return labels_[qualities_[i]]; }
+        [[nodiscard]] std::string_view source(std::size_t i) const { return labels_[sources_[i]]; }
+
+        [[nodiscard]] QuoteRecord record(std::size_t i) const;
+
+    private:
+        friend class QuoteHistory;
+
+        const history::BlockHeader *block_ = nullptr;
+        const std::string_view *labels_ = nullptr; // QuoteHistory::labels() storage
+        std::string_view instrument_id_;
+        std::int64_t base_timestamp_ = 0;
+        std::span<const double> values_;
+        std::span<const double> sizes_;
+        std::span<const std::uint32_t> deltas_;
+        const std::uint16_t *sides_ = nullptr;
+        const std::uint16_t *value_types_ = nullptr;
+        const std::uint16_t *currencies_ = nullptr;
+        const std::uint16_t *qualities_ = nullptr;
+        const std::uint16_t *sources_ = nullptr;
+    };
+
+    /**
+     * @brief Read-only, memory-mapped quote history.
+     *
+     * Opening walks the block headers once to rebuild the dictionaries and a per-instrument run
+     * index, point data is only touched by scans. Runs and the string_views they return point into
+     * the mapping and must not outlive the QuoteHistory.
+     */
+    class QuoteHistory {
+    public:
+        static QuoteHistory open(const std::string &path);
+
+        // Non-owning; data must stay alive and be at least 8-byte aligned.
+        static QuoteHistory from_buffer(const std::byte *data, std::size_t size);
+
+        QuoteHistory(QuoteHistory &&other) noexcept = default;
+
+        QuoteHistory &operator=(QuoteHistory &&other) noexcept = default;
+
+        QuoteHistory(const QuoteHistory &) = delete;
+
+        QuoteHistory &operator=(const QuoteHistory &) = delete;
+
+        [[nodiscard]] std::size_t block_count() const { return blocks_.size(); }
+        [[nodiscard]] std::size_t row_count() const { return row_count_; }
+
+        // Bytes covered by complete blocks; anything beyond is a torn append.
+        [[nodiscard]] std::size_t valid_size() const { return valid_size_; }
+
+        [[nodiscard]] std::size_t instrument_count() const { return instrument_ids_.size(); }
+        [[nodiscard]] std::string_view instrument_id(std::size_t code) const { return instrument_ids_[code]; }
+        [[nodiscard]] const std::vector<std::string_view> &labels() const { return labels_; }
+
+        /**
+         * @brief Quotes of one instrument with timestamp in [from, to), in time order of the runs
+         * (one QuoteRun per appended set that has matching rows).
+         */
+        [[nodiscard]] std::vector<QuoteRun> scan(std::string_view instrument_id, time::Instant from,
+                                                 time::Instant to) const;
+
+    private:
+        struct RunRef {
+            const history::BlockHeader *block;
+            const history::RunEntry *run;
+            std::int64_t first_timestamp;
+            std::int64_t last_timestamp;
+        };
+
+        QuoteHistory(const std::byte *base, std::size_t size, MappedFile file);
+
+        void index_blocks();
+
+        [[nodiscard]] QuoteRun make_run(const RunRef &ref, std::size_t begin, std::size_t end) const;
+
+        MappedFile file_; // empty for from_buffer()
+        const std::byte *base_ = nullptr;
+        std::size_t size_ = 0;
+        std::size_t valid_size_ = 0;
+        std::size_t row_count_ = 0;
+
+        std::vector<const history::BlockHeader *> blocks_;
+        std::vector<std::string_view> instrument_ids_;
+        std::vector<std::string_view> labels_;
+        std::unordered_map<std::string_view, std::uint32_t> instrument_codes_;
+        std::vector<std::vector<RunRef> > runs_; // by instrument code, sorted by first_timestamp
+    };
+}
+
+#endif //CURVEFORGE_IO_QUOTEHISTORY_H
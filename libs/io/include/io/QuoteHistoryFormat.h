@@ -0,0 +1,81 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_QUOTEHISTORYFORMAT_H
+#define CURVEFORGE_IO_QUOTEHISTORYFORMAT_H
+
+#include <cstdint>
+
+#include "BinarySnapshotFormat.h"
+
+/**
+ * On-disk layout of an append-only quote history (".cfqh").
+ *
+ *   FileHeader (padded to kAlignment) | Block | Block | ...
+ *
+ * Every appended InstrumentQuoteSet becomes one self-contained Block. A block starts with a
+ * BlockHeader (offsets relative to the block start), followed by the dictionary entries it
+ * introduces and by the quote columns, each aligned to kAlignment:
+ *
+ *   - rows are grouped into runs, one per instrument (sorted by timestamp within a run);
+ *   - values / sizes are raw doubles (NaN for an absent size), so scans hand out spans;
+ *   - timestamps are frame-of-reference encoded: RunEntry::base_timestamp + uint32 millisecond
+ *     deltas (a run is split when the deltas would overflow);
+ *   - side, valueType, currency, quality and source are uint16 codes into the label dictionary.
+ *
+ * Dictionaries are append-only as well: codes are assigned in order of first appearance and a
+ * block only stores the entries it adds (instrument ids and labels separately). Readers rebuild
+ * them while walking the blocks. A trailing block that is shorter than its block_size (torn
+ * append) is ignored by readers and truncated by the next writer.
+ */
+namespace curve::io::history {
+    inline constexpr char kMagic[8] = {'C', 'F', 'Q', 'H', 'I', 'S', 'T', '\0'};
+    inline constexpr std::uint32_t kFormatVersion = 1;
+    inline constexpr std::uint64_t kAlignment = binary::kAlignment;
+    inline constexpr std::uint32_t kBlockMagic = 0x4B4C4251; // "QBLK"
+    inline constexpr std::uint32_t kBlockVersion = 1;
+    inline constexpr std::uint32_t kMaxLabels = 0xFFFF;
+
+    struct FileHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t reserved;
+        std::uint64_t reserved2[2];
+    };
+
+    struct BlockHeader {
+        std::uint32_t magic; // kBlockMagic
+        std::uint32_t version;
+        std::uint64_t block_size; // including this header, multiple of kAlignment
+        std::int64_t min_timestamp; // milliseconds since epoch
+        std::int64_t max_timestamp;
+        std::int32_t as_of; // day serial
+        std::uint32_t run_count;
+        std::uint64_t row_count;
+        std::uint32_t new_instrument_count;
+        std::uint32_t new_label_count;
+        std::uint32_t feed_name; // label code
+        std::uint32_t scenario_name; // label code
+        std::uint64_t dictionary_offset; // binary::StringRef[new_instrument_count + new_label_count]
+        std::uint64_t dictionary_chars_offset; // chars referenced by the dictionary entries
+        std::uint64_t runs_offset; // RunEntry[run_count]
+        std::uint64_t value_offset; // double[row_count]
+        std::uint64_t size_offset; // double[row_count]
+        std::uint64_t delta_offset; // uint32[row_count], ms since the run's base_timestamp
+        std::uint64_t side_offset; // uint16[row_count]
+        std::uint64_t value_type_offset; // uint16[row_count]
+        std::uint64_t currency_offset; // uint16[row_count]
+        std::uint64_t quality_offset; // uint16[row_count]
+        std::uint64_t source_offset; // uint16[row_count]
+    };
+
+    struct RunEntry {
+        std::uint32_t instrument; // instrument dictionary code
+        std::uint32_t row_count;
+        std::uint64_t first_row;
+        std::int64_t base_timestamp; // ms since epoch of the run's first row
+    };
+}
+
+#endif //CURVEFORGE_IO_QUOTEHISTORYFORMAT_H
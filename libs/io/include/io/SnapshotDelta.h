@@ -0,0 +1,117 @@
+//
+// Created by Francisco Nunez on 06.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_SNAPSHOTDELTA_H
+#define CURVEFORGE_IO_SNAPSHOTDELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SnapshotRecords.h"
+
+namespace curve::io {
+    // New value of one curve point; the point's tenor / maturity are unchanged.
+    struct YieldPointUpdate {
+        std::uint32_t index = 0;
+        double value = 0.0;
+
+        bool operator==(const YieldPointUpdate &) const = default;
+    };
+
+    struct YieldCurvePatch {
+        std::string curve_id;
+        std::vector<YieldPointUpdate> points;
+
+        bool operator==(const YieldCurvePatch &) const = default;
+    };
+
+    // New quoted values of one surface point; expiry and strike are unchanged.
+    struct VolPointUpdate {
+        std::uint32_t index = 0;
+        double volatility = 0.0;
+        std::optional<double> forward;
+        std::optional<double> total_variance;
+
+        bool operator==(const VolPointUpdate &) const = default;
+    };
+
+    struct VolSurfacePatch {
+        std::string underlying_id;
+        std::vector<VolPointUpdate> points;
+
+        bool operator==(const VolSurfacePatch &) const = default;
+    };
+
+    // Changes to a quote set identified by (feed name, scenario name)
+    struct QuoteSetPatch {
+        std::string feed_name;
+        std::string scenario_name;
+        std::optional<QuoteSetHeaderRecord> header;
+        std::vector<InstrumentQuoteRecord> upserted; // new instruments or changed quote lists
+        std::vector<std::string> removed;
+
+        bool operator==(const QuoteSetPatch &) const = default;
+    };
+
+    /**
+     * @brief Difference between two snapshots, from base_snapshot_id to header.
+     *
+     * Objects whose identity is unchanged and whose point structure (tenors, maturities, expiries,
+     * strikes and header fields) is unchanged travel as patches of the values that moved; anything
+     * else (new objects, structural changes) travels in full as an upsert. Quote sets are matched
+     * by (feed name, scenario name), instruments within a set by instrument id.
+     */
+    struct SnapshotDelta {
+        std::string base_snapshot_id;
+        SnapshotHeaderRecord header;
+
+        std::vector<YieldCurveRecord> upserted_curves;
+        std::vector<YieldCurvePatch> curve_patches;
+        std::vector<std::string> removed_curves;
+
+        std::vector<VolSurfaceRecord> upserted_surfaces;
+        std::vector<VolSurfacePatch> surface_patches;
+        std::vector<std::string> removed_surfaces;
+
+        std::vector<QuoteSetRecord> added_quote_sets;
+        std::vector<QuoteSetPatch> quote_set_patches;
+        std::vector<std::pair<std::string, std::string> > removed_quote_sets; // (feed, scenario)
+
+        // True when only the header differs (or nothing at all)
+        [[nodiscard]] bool empty() const;
+
+        bool operator==(const SnapshotDelta &) const = default;
+    };
+
+    // Delta turning `base` into `next`.
+    SnapshotDelta diff_snapshots(const SnapshotData &base, const SnapshotData &next);
+
+    /**
+     * @brief Applies a delta in place.
+     *
+     * Patched and replaced objects keep their position, new objects are appended. Throws
+     * std::invalid_argument when the delta was computed against a different snapshot id or
+     * refers to objects / points the snapshot does not have; `snapshot` is then left unchanged.
+     */
+    void apply_delta(SnapshotData &snapshot, const SnapshotDelta &delta);
+
+    /**
+     * @brief Compact binary encoding of a SnapshotDelta (varint counts and indices, raw doubles,
+     * length-prefixed strings), for storing or sending intraday snapshot streams.
+     */
+    class SnapshotDeltaCodec {
+    public:
+        static std::vector<std::byte> encode(const SnapshotDelta &delta);
+
+        // Throws std::runtime_error on truncated or malformed input
+        static SnapshotDelta decode(std::span<const std::byte> bytes);
+    };
+}
+
+#endif //CURVEFORGE_IO_SNAPSHOTDELTA_H
@@ -0,0 +1,132 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_SNAPSHOTRECORDS_H
+#define CURVEFORGE_IO_SNAPSHOTRECORDS_H
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "time/date.hpp"
+#include "time/instant.h"
+
+namespace curve::io {
+    /**
+     * @brief Plain in-memory mirror of the marketdata.xsd content.
+     *
+     * The generated XSD types are DOM-backed and expensive to build; these records are what the
+     * streaming reader, the binary snapshot format and the snapshot deltas exchange. Enumerated
+     * schema values are kept as their schema literals (e.g. "ZERO_RATE", "ACT_365F").
+     */
+    struct SnapshotHeaderRecord {
+        time::Date as_of{};
+        std::optional<time::Instant> snapshot_time;
+        std::string scenario_name;
+        std::string source;
+        std::string snapshot_id;
+
+        bool operator==(const SnapshotHeaderRecord &) const = default;
+    };
+
+    struct YieldPointRecord {
+        std::string tenor;
+        std::optional<time::Date> maturity_date;
+        double value = 0.0;
+
+        bool operator==(const YieldPointRecord &) const = default;
+    };
+
+    struct YieldCurveRecord {
+        std::string curve_id;
+        std::string currency;
+        time::Date as_of{};
+        std::string curve_type;
+        std::string day_count;
+        std::string compounding;
+        std::string interpolation; // empty when not given
+        std::string reference_index;
+        std::string calendar_name;
+        std::string business_day_convention;
+        std::vector<YieldPointRecord> points;
+
+        bool operator==(const YieldCurveRecord &) const = default;
+    };
+
+    struct VolSurfaceHeaderRecord {
+        std::string underlying_id;
+        time::Date as_of{};
+        std::string quote_type;
+        std::string strike_dimension;
+        std::string strike_unit;
+        std::string expiry_interpolation;
+        std::string strike_interpolation;
+
+        bool operator==(const VolSurfaceHeaderRecord &) const = default;
+    };
+
+    struct VolPointRecord {
+        std::string expiry;
+        double strike_coordinate = 0.0;
+        double volatility = 0.0;
+        std::optional<double> forward;
+        std::optional<double> total_variance;
+
+        bool operator==(const VolPointRecord &) const = default;
+    };
+
+    struct VolSurfaceRecord {
+        VolSurfaceHeaderRecord header;
+        std::vector<VolPointRecord> points;
+
+        bool operator==(const VolSurfaceRecord &) const = default;
+    };
+
+    struct QuoteRecord {
+        double value = 0.0;
+        std::string side;
+        std::string value_type;
+        std::string currency;
+        std::optional<double> size;
+        std::optional<time::Instant> timestamp;
+        std::string quality;
+        std::string source;
+
+        bool operator==(const QuoteRecord &) const = default;
+    };
+
+    struct InstrumentQuoteRecord {
+        std::string instrument_id;
+        std::vector<QuoteRecord> quotes;
+
+        bool operator==(const InstrumentQuoteRecord &) const = default;
+    };
+
+    struct QuoteSetHeaderRecord {
+        time::Date as_of{};
+        std::optional<time::Instant> snapshot_time;
+        std::string feed_name;
+        std::string scenario_name;
+
+        bool operator==(const QuoteSetHeaderRecord &) const = default;
+    };
+
+    struct QuoteSetRecord {
+        QuoteSetHeaderRecord header;
+        std::vector<InstrumentQuoteRecord> instruments;
+
+        bool operator==(const QuoteSetRecord &) const = default;
+    };
+
+    struct SnapshotData {
+        SnapshotHeaderRecord header;
+        std::vector<YieldCurveRecord> yield_curves;
+        std::vector<VolSurfaceRecord> vol_surfaces;
+        std::vector<QuoteSetRecord> quote_sets;
+
+        bool operator==(const SnapshotData &) const = default;
+    };
+}
+
+#endif //CURVEFORGE_IO_SNAPSHOTRECORDS_H
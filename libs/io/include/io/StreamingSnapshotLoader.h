@@ -0,0 +1,42 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_STREAMINGSNAPSHOTLOADER_H
+#define CURVEFORGE_IO_STREAMINGSNAPSHOTLOADER_H
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "MarketDataSaxReader.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::io {
+    /**
+     * @brief Loads a MarketDataSnapshot file with the SAX reader and builds every vol surface
+     * in the background as soon as its element is closed, so surface construction overlaps
+     * with parsing the remainder of the file (typically the large quoteSets section).
+     *
+     * Quotes are never accumulated: they are forwarded to the caller's on_instrument_quote
+     * callback, which keeps memory bounded by the largest single curve / surface.
+     */
+    class StreamingSnapshotLoader {
+    public:
+        struct Result {
+            SnapshotHeaderRecord header;
+            std::vector<YieldCurveRecord> yield_curves;
+            std::map<std::string, std::shared_ptr<volatility::ImpliedVolSurface> > vol_surfaces; // by underlying id
+        };
+
+        /**
+         * @param path MarketDataSnapshot XML file
+         * @param quote_callbacks optional quote-set callbacks (on_quote_set_begin/on_instrument_quote/on_quote_set_end)
+         */
+        static Result load_file(const std::string &path, const MarketDataCallbacks &quote_callbacks = {});
+
+        static Result load_buffer(const char *data, std::size_t size, const MarketDataCallbacks &quote_callbacks = {});
+    };
+}
+
+#endif //CURVEFORGE_IO_STREAMINGSNAPSHOTLOADER_H
@@ -0,0 +1,35 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_SURFACEBUILDER_H
+#define CURVEFORGE_IO_SURFACEBUILDER_H
+
+#include <memory>
+#include <vector>
+
+#include "BinarySnapshot.h"
+#include "SnapshotRecords.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::io {
+    /**
+     * @brief Surface settings implied by a vol.xsd header: ABSOLUTE_STRIKE maps to STRIKE_SPACE,
+     * MONEYNESS/DELTA to LOG_MONEYNESS_SPACE; CUBIC_SPLINE/BICUBIC strike interpolation maps to
+     * BICUBIC_SPLINE, anything else to BILINEAR.
+     */
+    volatility::ImpliedVolSurface::SurfaceType surface_type_of(const VolSurfaceHeaderRecord &header);
+
+    volatility::ImpliedVolSurface::InterpolationMethod interpolation_of(const VolSurfaceHeaderRecord &header);
+
+    /**
+     * @brief Build an interpolated surface from vol points (no XSD objects involved).
+     */
+    std::shared_ptr<volatility::ImpliedVolSurface> build_vol_surface(const VolSurfaceHeaderRecord &header,
+                                                                     const std::vector<VolPointRecord> &points);
+
+    // From a mapped binary snapshot, using the pre-converted expiry year fractions.
+    std::shared_ptr<volatility::ImpliedVolSurface> build_vol_surface(const VolSurfaceView &view);
+}
+
+#endif //CURVEFORGE_IO_SURFACEBUILDER_H
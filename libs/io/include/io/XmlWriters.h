@@ -0,0 +1,64 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_XMLWRITERS_H
+#define CURVEFORGE_IO_XMLWRITERS_H
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PortfolioRecords.h"
+#include "SnapshotRecords.h"
+
+namespace curve::io {
+    /**
+     * @brief Writes SnapshotData as a marketdata.xsd document (inverse of MarketDataSaxReader).
+     *
+     * Elements are namespace qualified as the schemas require; doubles are written in shortest
+     * round-trip form, so reading the document back reproduces the records exactly.
+     */
+    class MarketDataXmlWriter {
+    public:
+        static void write(std::ostream &out, const SnapshotData &data);
+
+        static void write_file(const SnapshotData &data, const std::string &path);
+    };
+
+    /**
+     * @brief Streams a portfolio.xsd document one trade at a time (inverse of PortfolioLoader).
+     *
+     * Only IRSwap trades can be written; add() throws std::invalid_argument for other types.
+     * The closing tag is written by finish() or, failing that, by the destructor.
+     */
+    class PortfolioXmlWriter {
+    public:
+        PortfolioXmlWriter(std::ostream &out, std::string_view name, std::string_view key);
+
+        PortfolioXmlWriter(const PortfolioXmlWriter &) = delete;
+
+        PortfolioXmlWriter &operator=(const PortfolioXmlWriter &) = delete;
+
+        ~PortfolioXmlWriter();
+
+        void add(const TradeRecord &trade);
+
+        void finish();
+
+        [[nodiscard]] std::size_t trade_count() const { return trades_; }
+
+        static void write_file(std::string_view name, std::string_view key, const std::vector<TradeRecord> &trades,
+                               const std::string &path);
+
+    private:
+        std::ostream &out_;
+        std::string buffer_;
+        std::size_t trades_ = 0;
+        bool finished_ = false;
+    };
+}
+
+#endif //CURVEFORGE_IO_XMLWRITERS_H
@@ -0,0 +1,29 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_XSDCONVERTERS_H
+#define CURVEFORGE_IO_XSDCONVERTERS_H
+
+#include "SnapshotRecords.h"
+#include "datacontracts/marketdata.hxx"
+
+namespace curve::io {
+    /**
+     * @brief Conversions from the generated XSD (DOM) types to the plain snapshot records,
+     * e.g. to convert an existing XML snapshot into the binary format.
+     */
+    time::Date to_date(const xml_schema::date &d);
+
+    time::Instant to_instant(const xml_schema::date_time &t);
+
+    YieldCurveRecord to_record(const yield::YieldCurve &curve);
+
+    VolSurfaceRecord to_record(const vol::VolSurface &surface);
+
+    QuoteSetRecord to_record(const quotes::InstrumentQuoteSet &quote_set);
+
+    SnapshotData to_snapshot_data(const marketdata::MarketDataSnapshot &md);
+}
+
+#endif //CURVEFORGE_IO_XSDCONVERTERS_H
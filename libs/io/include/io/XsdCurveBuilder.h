@@ -0,0 +1,20 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_XSDCURVEBUILDER_H
+#define CURVEFORGE_IO_XSDCURVEBUILDER_H
+
+#include "CurveBuilder.h"
+#include "datacontracts/marketdata.hxx"
+
+namespace curve::io {
+    // build_yield_curve() reading the generated XSD objects in place, without an intermediate YieldCurveRecord.
+    std::shared_ptr<ICurve> build_yield_curve(const yield::YieldCurve &curve);
+
+    // All yieldCurves of a parsed MarketDataSnapshot, built in parallel (see build_yield_curves()).
+    YieldCurveMap build_yield_curves(const marketdata::MarketDataSnapshot &md,
+                                     std::size_t threads = std::thread::hardware_concurrency());
+}
+
+#endif //CURVEFORGE_IO_XSDCURVEBUILDER_H
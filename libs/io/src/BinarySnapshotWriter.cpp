@@ -0,0 +1,339 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#include "io/BinarySnapshot.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "ByteBuffer.h"
+#include "time/date.hpp"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::io {
+    namespace {
+        using namespace binary;
+        using detail::ByteBuffer;
+
+        using time::to_serial;
+
+        std::int32_t to_serial(const std::optional<time::Date> &d) {
+            return d ? to_serial(*d) : kNoDate;
+        }
+
+        std::int64_t to_millis(const std::optional<time::Instant> &t) {
+            if (!t) return kNoInstant;
+            return std::chrono::duration_cast<std::chrono::milliseconds>(t->time_since_epoch()).count();
+        }
+
+        double or_nan(const std::optional<double> &v) {
+            return v ? *v : std::nan("");
+        }
+
+        class StringTableBuilder {
+        public:
+            StringRef add(std::string_view s) {
+                if (s.empty()) return {0, 0};
+                const auto it = index_.find(std::string(s));
+                if (it != index_.end()) return it->second;
+                if (blob_.size() + s.size() > std::numeric_limits<std::uint32_t>::max()) {
+                    throw std::length_error("BinarySnapshotWriter: string table exceeds 4GB");
+                }
+                const StringRef ref{static_cast<std::uint32_t>(blob_.size()), static_cast<std::uint32_t>(s.size())};
+                blob_.append(s);
+                index_.emplace(std::string(s), ref);
+                return ref;
+            }
+
+            const std::string &blob() const { return blob_; }
+
+        private:
+            std::string blob_;
+            std::unordered_map<std::string, StringRef> index_;
+        };
+
+        template<typename Table>
+        ByteBuffer start_section(std::uint64_t &table_offset) {
+            ByteBuffer section;
+            table_offset = section.append_array(std::vector<Table>(1));
+            return section;
+        }
+
+        std::uint32_t checked_u32(std::size_t n, const char *what) {
+            if (n > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::length_error(std::string("BinarySnapshotWriter: too many ") + what);
+            }
+            return static_cast<std::uint32_t>(n);
+        }
+
+        ByteBuffer header_section(const SnapshotHeaderRecord &h, StringTableBuilder &strings) {
+            HeaderTable table{};
+            table.as_of = to_serial(h.as_of);
+            table.snapshot_time = to_millis(h.snapshot_time);
+            table.scenario_name = strings.add(h.scenario_name);
+            table.source = strings.add(h.source);
+            table.snapshot_id = strings.add(h.snapshot_id);
+            ByteBuffer section;
+            section.append(&table, sizeof(table));
+            return section;
+        }
+
+        ByteBuffer yield_curves_section(const std::vector<YieldCurveRecord> &curves, StringTableBuilder &strings) {
+            std::vector<YieldCurveEntry> entries;
+            std::vector<StringRef> tenors;
+            std::vector<std::int32_t> maturities;
+            std::vector<double> values;
+            entries.reserve(curves.size());
+
+            for (const auto &c: curves) {
+                YieldCurveEntry e{};
+                e.curve_id = strings.add(c.curve_id);
+                e.currency = strings.add(c.currency);
+                e.curve_type = strings.add(c.curve_type);
+                e.day_count = strings.add(c.day_count);
+                e.compounding = strings.add(c.compounding);
+                e.interpolation = strings.add(c.interpolation);
+                e.reference_index = strings.add(c.reference_index);
+                e.calendar_name = strings.add(c.calendar_name);
+                e.business_day_convention = strings.add(c.business_day_convention);
+                e.as_of = to_serial(c.as_of);
+                e.first_point = checked_u32(values.size(), "yield curve points");
+                e.point_count = checked_u32(c.points.size(), "yield curve points");
+                for (const auto &p: c.points) {
+                    tenors.push_back(strings.add(p.tenor));
+                    maturities.push_back(to_serial(p.maturity_date));
+                    values.push_back(p.value);
+                }
+                entries.push_back(e);
+            }
+
+            std::uint64_t table_offset;
+            auto section = start_section<YieldCurvesTable>(table_offset);
+            YieldCurvesTable table{};
+            table.curve_count = entries.size();
+            table.point_count = values.size();
+            table.curves_offset = section.append_array(entries);
+            table.tenor_offset = section.append_array(tenors);
+            table.maturity_offset = section.append_array(maturities);
+            table.value_offset = section.append_array(values);
+            section.patch(table_offset, table);
+            return section;
+        }
+
+        ByteBuffer vol_surfaces_section(const std::vector<VolSurfaceRecord> &surfaces, StringTableBuilder &strings) {
+            std::vector<VolSurfaceEntry> entries;
+            std::vector<StringRef> expiries;
+            std::vector<double> expiry_years, strikes, vols, forwards, total_variances;
+            entries.reserve(surfaces.size());
+
+            for (const auto &s: surfaces) {
+                VolSurfaceEntry e{};
+                e.underlying_id = strings.add(s.header.underlying_id);
+                e.quote_type = strings.add(s.header.quote_type);
+                e.strike_dimension = strings.add(s.header.strike_dimension);
+                e.strike_unit = strings.add(s.header.strike_unit);
+                e.expiry_interpolation = strings.add(s.header.expiry_interpolation);
+                e.strike_interpolation = strings.add(s.header.strike_interpolation);
+                e.as_of = to_serial(s.header.as_of);
+                e.first_point = checked_u32(strikes.size(), "vol points");
+                e.point_count = checked_u32(s.points.size(), "vol points");
+                for (const auto &p: s.points) {
+                    expiries.push_back(strings.add(p.expiry));
+                    expiry_years.push_back(volatility::ImpliedVolSurface::expiry_to_years(p.expiry));
+                    strikes.push_back(p.strike_coordinate);
+                    vols.push_back(p.volatility);
+                    forwards.push_back(or_nan(p.forward));
+                    total_variances.push_back(or_nan(p.total_variance));
+                }
+                entries.push_back(e);
+            }
+
+            std::uint64_t table_offset;
+            auto section = start_section<VolSurfacesTable>(table_offset);
+            VolSurfacesTable table{};
+            table.surface_count = entries.size();
+            table.point_count = strikes.size();
+            table.surfaces_offset = section.append_array(entries);
+            table.expiry_offset = section.append_array(expiries);
+            table.expiry_years_offset = section.append_array(expiry_years);
+            table.strike_offset = section.append_array(strikes);
+            table.volatility_offset = section.append_array(vols);
+            table.forward_offset = section.append_array(forwards);
+            table.total_variance_offset = section.append_array(total_variances);
+            section.patch(table_offset, table);
+            return section;
+        }
+
+        ByteBuffer quote_sets_section(const std::vector<QuoteSetRecord> &sets, StringTableBuilder &strings) {
+            std::vector<QuoteSetEntry> set_entries;
+            std::vector<InstrumentEntry> instruments;
+            std::vector<double> values, sizes;
+            std::vector<std::int64_t> timestamps;
+            std::vector<StringRef> sides, value_types, currencies, qualities, sources;
+
+            for (const auto &qs: sets) {
+                QuoteSetEntry e{};
+                e.as_of = to_serial(qs.header.as_of);
+                e.snapshot_time = to_millis(qs.header.snapshot_time);
+                e.feed_name = strings.add(qs.header.feed_name);
+                e.scenario_name = strings.add(qs.header.scenario_name);
+                e.first_instrument = checked_u32(instruments.size(), "instrument quotes");
+                e.instrument_count = checked_u32(qs.instruments.size(), "instrument quotes");
+                for (const auto &iq: qs.instruments) {
+                    InstrumentEntry ie{};
+                    ie.instrument_id = strings.add(iq.instrument_id);
+                    ie.first_quote = checked_u32(values.size(), "quotes");
+                    ie.quote_count = checked_u32(iq.quotes.size(), "quotes");
+                    for (const auto &q: iq.quotes) {
+                        values.push_back(q.value);
+                        sizes.push_back(or_nan(q.size));
+                        timestamps.push_back(to_millis(q.timestamp));
+                        sides.push_back(strings.add(q.side));
+                        value_types.push_back(strings.add(q.value_type));
+                        currencies.push_back(strings.add(q.currency));
+                        qualities.push_back(strings.add(q.quality));
+                        sources.push_back(strings.add(q.source));
+                    }
+                    instruments.push_back(ie);
+                }
+                set_entries.push_back(e);
+            }
+
+            std::uint64_t table_offset;
+            auto section = start_section<QuoteSetsTable>(table_offset);
+            QuoteSetsTable table{};
+            table.set_count = set_entries.size();
+            table.instrument_count = instruments.size();
+            table.quote_count = values.size();
+            table.sets_offset = section.append_array(set_entries);
+            table.instruments_offset = section.append_array(instruments);
+            table.value_offset = section.append_array(values);
+            table.size_offset = section.append_array(sizes);
+            table.timestamp_offset = section.append_array(timestamps);
+            table.side_offset = section.append_array(sides);
+            table.value_type_offset = section.append_array(value_types);
+            table.currency_offset = section.append_array(currencies);
+            table.quality_offset = section.append_array(qualities);
+            table.source_offset = section.append_array(sources);
+            section.patch(table_offset, table);
+            return section;
+        }
+
+        ByteBuffer index_section(const SnapshotData &data, StringTableBuilder &strings) {
+            struct Keyed {
+                std::string_view key;
+                IndexEntry entry;
+            };
+            const auto sorted_entries = [](std::vector<Keyed> &keyed) {
+                std::stable_sort(keyed.begin(), keyed.end(), [](const Keyed &a, const Keyed &b) {
+                    return a.entry.group != b.entry.group ? a.entry.group < b.entry.group : a.key < b.key;
+                });
+                std::vector<IndexEntry> entries;
+                entries.reserve(keyed.size());
+                for (const auto &k: keyed) entries.push_back(k.entry);
+                return entries;
+            };
+
+            std::vector<Keyed> curves, surfaces, sets, instruments;
+            for (std::size_t i = 0; i < data.yield_curves.size(); ++i) {
+                const auto &id = data.yield_curves[i].curve_id;
+                curves.push_back({id, {strings.add(id), static_cast<std::uint32_t>(i), 0}});
+            }
+            for (std::size_t i = 0; i < data.vol_surfaces.size(); ++i) {
+                const auto &id = data.vol_surfaces[i].header.underlying_id;
+                surfaces.push_back({id, {strings.add(id), static_cast<std::uint32_t>(i), 0}});
+            }
+            std::uint32_t instrument = 0;
+            for (std::size_t s = 0; s < data.quote_sets.size(); ++s) {
+                const auto &qs = data.quote_sets[s];
+                const auto set = static_cast<std::uint32_t>(s);
+                sets.push_back({qs.header.feed_name, {strings.add(qs.header.feed_name), set, 0}});
+                for (const auto &iq: qs.instruments) {
+                    instruments.push_back({iq.instrument_id, {strings.add(iq.instrument_id), instrument++, set}});
+                }
+            }
+
+            std::uint64_t table_offset;
+            auto section = start_section<IndexTable>(table_offset);
+            IndexTable table{};
+            table.curve_count = curves.size();
+            table.surface_count = surfaces.size();
+            table.quote_set_count = sets.size();
+            table.instrument_count = instruments.size();
+            table.curves_offset = section.append_array(sorted_entries(curves));
+            table.surfaces_offset = section.append_array(sorted_entries(surfaces));
+            table.quote_sets_offset = section.append_array(sorted_entries(sets));
+            table.instruments_offset = section.append_array(sorted_entries(instruments));
+            section.patch(table_offset, table);
+            return section;
+        }
+    }
+
+    std::vector<std::byte> BinarySnapshotWriter::encode(const SnapshotData &data) {
+        StringTableBuilder strings;
+
+        struct PendingSection {
+            SectionKind kind;
+            std::uint32_t version;
+            ByteBuffer bytes;
+        };
+        std::vector<PendingSection> sections;
+        sections.push_back({SectionKind::HEADER, kHeaderVersion, header_section(data.header, strings)});
+        sections.push_back({
+            SectionKind::YIELD_CURVES, kYieldCurvesVersion, yield_curves_section(data.yield_curves, strings)
+        });
+        sections.push_back({
+            SectionKind::VOL_SURFACES, kVolSurfacesVersion, vol_surfaces_section(data.vol_surfaces, strings)
+        });
+        sections.push_back({
+            SectionKind::QUOTE_SETS, kQuoteSetsVersion, quote_sets_section(data.quote_sets, strings)
+        });
+        sections.push_back({SectionKind::INDEX, kIndexVersion, index_section(data, strings)});
+        // Strings last: every other section has registered its strings by now.
+        ByteBuffer string_bytes;
+        string_bytes.append(strings.blob().data(), strings.blob().size());
+        sections.push_back({SectionKind::STRINGS, kStringsVersion, std::move(string_bytes)});
+
+        ByteBuffer file;
+        FileHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFormatVersion;
+        header.section_count = static_cast<std::uint32_t>(sections.size());
+        file.append(&header, sizeof(header));
+        // Section directory immediately follows the file header
+        const std::vector<SectionEntry> directory(sections.size());
+        const auto directory_offset = file.append(directory.data(), directory.size() * sizeof(SectionEntry));
+
+        for (std::size_t i = 0; i < sections.size(); ++i) {
+            file.align(kAlignment);
+            SectionEntry entry{};
+            entry.kind = static_cast<std::uint32_t>(sections[i].kind);
+            entry.version = sections[i].version;
+            entry.size = sections[i].bytes.size();
+            entry.offset = file.append(sections[i].bytes.bytes().data(), entry.size);
+            file.patch(directory_offset + i * sizeof(SectionEntry), entry);
+        }
+
+        header.file_size = file.size();
+        file.patch(0, header);
+        return std::move(file.bytes());
+    }
+
+    void BinarySnapshotWriter::write_file(const SnapshotData &data, const std::string &path) {
+        const auto bytes = encode(data);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("BinarySnapshotWriter: cannot open " + path);
+        }
+        out.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!out) {
+            throw std::runtime_error("BinarySnapshotWriter: write failed for " + path);
+        }
+    }
+}
@@ -0,0 +1,50 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_BYTEBUFFER_H
+#define CURVEFORGE_IO_BYTEBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "io/BinarySnapshotFormat.h"
+
+namespace curve::io::detail {
+    // Growable byte image used by the binary writers; arrays are aligned to binary::kAlignment.
+    class ByteBuffer {
+    public:
+        std::uint64_t size() const { return bytes_.size(); }
+
+        void align(std::uint64_t alignment) {
+            bytes_.resize((bytes_.size() + alignment - 1) / alignment * alignment, std::byte{0});
+        }
+
+        std::uint64_t append(const void *data, std::size_t n) {
+            const auto offset = bytes_.size();
+            bytes_.resize(offset + n);
+            if (n > 0) std::memcpy(bytes_.data() + offset, data, n);
+            return offset;
+        }
+
+        template<typename T>
+        std::uint64_t append_array(const std::vector<T> &values) {
+            align(binary::kAlignment);
+            return append(values.data(), values.size() * sizeof(T));
+        }
+
+        template<typename T>
+        void patch(std::uint64_t offset, const T &value) {
+            std::memcpy(bytes_.data() + offset, &value, sizeof(T));
+        }
+
+        std::vector<std::byte> &bytes() { return bytes_; }
+
+    private:
+        std::vector<std::byte> bytes_;
+    };
+}
+
+#endif //CURVEFORGE_IO_BYTEBUFFER_H
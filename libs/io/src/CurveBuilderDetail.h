@@ -0,0 +1,109 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_CURVEBUILDERDETAIL_H
+#define CURVEFORGE_IO_CURVEBUILDERDETAIL_H
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "curve/InterpolatedZeroCurve.h"
+#include "io/CurveBuilder.h"
+#include "tasks/Parallel.h"
+
+// Shared by the record, mapped-view and XSD curve builders.
+namespace curve::io::detail {
+    enum class Compounding { SIMPLE, ANNUAL, SEMI_ANNUAL, QUARTERLY, CONTINUOUS };
+
+    inline Compounding compounding_of(std::string_view literal) {
+        if (literal == "CONTINUOUS") return Compounding::CONTINUOUS;
+        if (literal == "ANNUAL") return Compounding::ANNUAL;
+        if (literal == "SEMI_ANNUAL") return Compounding::SEMI_ANNUAL;
+        if (literal == "QUARTERLY") return Compounding::QUARTERLY;
+        if (literal == "SIMPLE") return Compounding::SIMPLE;
+        throw std::invalid_argument("Unknown compounding: " + std::string(literal));
+    }
+
+    inline double continuous_zero(double rate, Compounding compounding, double t) {
+        switch (compounding) {
+            case Compounding::CONTINUOUS:
+                return rate;
+            case Compounding::ANNUAL:
+                return std::log1p(rate);
+            case Compounding::SEMI_ANNUAL:
+                return 2.0 * std::log1p(rate / 2.0);
+            case Compounding::QUARTERLY:
+                return 4.0 * std::log1p(rate / 4.0);
+            case Compounding::SIMPLE:
+                return t > 0.0 ? std::log1p(rate * t) / t : rate;
+        }
+        return rate;
+    }
+
+    struct CurveHeader {
+        std::string curve_id;
+        time::Date as_of;
+        std::string_view curve_type;
+        std::string_view day_count;
+        std::string_view compounding;
+        std::string_view interpolation;
+    };
+
+    // Point i -> (maturity, value) via accessors, so every source is read in place. zero_shift is
+    // added to every continuously compounded pillar rate.
+    template<typename MaturityOf, typename ValueOf>
+    std::shared_ptr<ICurve> build_curve(CurveHeader header, std::size_t n, MaturityOf maturity_of, ValueOf value_of,
+                                        double zero_shift = 0.0) {
+        const auto &curve_id = header.curve_id;
+        const bool is_zero = header.curve_type == "ZERO_RATE" || header.curve_type == "OIS_ZERO";
+        const bool is_discount = header.curve_type == "DISCOUNT_FACTOR";
+        if (!is_zero && !is_discount) {
+            throw std::invalid_argument("Unsupported curve type for " + curve_id + ": " +
+                                        std::string(header.curve_type));
+        }
+        const auto compounding = is_zero ? compounding_of(header.compounding) : Compounding::CONTINUOUS;
+        const auto interpolation = curve_interpolation_of(header.interpolation);
+        auto dc = time::create_daycount_convention(day_count_of(header.day_count));
+
+        std::vector<Pillar> pillars;
+        pillars.reserve(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            const time::Date maturity = maturity_of(i);
+            const double t = dc->year_fraction(header.as_of, maturity);
+            const double value = value_of(i);
+            if (is_discount) {
+                if (t <= 0.0) continue; // DF(0) = 1 carries no rate information
+                pillars.emplace_back(maturity, -std::log(value) / t + zero_shift);
+            } else {
+                pillars.emplace_back(maturity, continuous_zero(value, compounding, t) + zero_shift);
+            }
+        }
+        if (pillars.empty()) {
+            throw std::invalid_argument("Curve " + curve_id + " has no usable points");
+        }
+        return std::make_shared<InterpolatedZeroCurve>(std::move(header.curve_id), header.as_of, std::move(pillars),
+                                                       std::move(dc), interpolation);
+    }
+
+    // Builds curve i = build_at(i) for i < count in parallel and keys the results by name().
+    template<typename BuildAt>
+    YieldCurveMap build_curves(std::size_t count, std::size_t threads, BuildAt build_at) {
+        std::vector<std::shared_ptr<ICurve> > built(count);
+        tasks::parallel_for_bounded(count, threads, [&](std::size_t i) { built[i] = build_at(i); });
+
+        YieldCurveMap curves;
+        for (auto &curve: built) {
+            auto id = curve->name();
+            if (!curves.emplace(id, std::move(curve)).second) {
+                throw std::invalid_argument("Duplicate yield curve id: " + id);
+            }
+        }
+        return curves;
+    }
+}
+
+#endif //CURVEFORGE_IO_CURVEBUILDERDETAIL_H
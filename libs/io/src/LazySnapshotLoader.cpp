@@ -0,0 +1,77 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#include "io/LazySnapshotLoader.h"
+
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "io/CurveBuilder.h"
+#include "io/SurfaceBuilder.h"
+
+namespace curve::io {
+    LazySnapshotLoader::LazySnapshotLoader(const std::string &path) : snapshot_(MappedSnapshot::open(path)) {
+    }
+
+    LazySnapshotLoader::LazySnapshotLoader(MappedSnapshot snapshot) : snapshot_(std::move(snapshot)) {
+    }
+
+    template<typename T, typename Build>
+    std::shared_ptr<T> LazySnapshotLoader::cached(std::map<std::string, std::shared_ptr<T>, std::less<> > &cache,
+                                                  std::string_view id, Build build) {
+        {
+            std::shared_lock lock(mutex_);
+            if (const auto it = cache.find(id); it != cache.end()) return it->second;
+        }
+        // Built outside the lock so other ids are not blocked behind a slow build
+        std::shared_ptr<T> built = build();
+        std::unique_lock lock(mutex_);
+        return cache.emplace(std::string(id), std::move(built)).first->second;
+    }
+
+    std::shared_ptr<const ICurve> LazySnapshotLoader::yield_curve(std::string_view curve_id) {
+        return cached(curves_, curve_id, [&] {
+            const auto view = snapshot_.find_yield_curve(curve_id);
+            if (!view) throw std::out_of_range("LazySnapshotLoader: no yield curve " + std::string(curve_id));
+            return build_yield_curve(*view);
+        });
+    }
+
+    std::shared_ptr<const volatility::ImpliedVolSurface> LazySnapshotLoader::vol_surface(
+        std::string_view underlying_id) {
+        return cached(surfaces_, underlying_id, [&] {
+            const auto view = snapshot_.find_vol_surface(underlying_id);
+            if (!view) throw std::out_of_range("LazySnapshotLoader: no vol surface " + std::string(underlying_id));
+            return build_vol_surface(*view);
+        });
+    }
+
+    std::optional<InstrumentQuoteView> LazySnapshotLoader::instrument_quotes(std::string_view feed_name,
+                                                                             std::string_view instrument_id) const {
+        for (std::size_t i = 0; i < snapshot_.quote_set_count(); ++i) {
+            // find_quote_set() returns the first match only; feeds may have one set per scenario
+            const auto set = snapshot_.quote_set(i);
+            if (set.feed_name() != feed_name) continue;
+            if (auto quotes = snapshot_.find_instrument_quotes(i, instrument_id)) return quotes;
+        }
+        return std::nullopt;
+    }
+
+    std::size_t LazySnapshotLoader::cached_yield_curves() const {
+        std::shared_lock lock(mutex_);
+        return curves_.size();
+    }
+
+    std::size_t LazySnapshotLoader::cached_vol_surfaces() const {
+        std::shared_lock lock(mutex_);
+        return surfaces_.size();
+    }
+
+    void LazySnapshotLoader::clear_cache() {
+        std::unique_lock lock(mutex_);
+        curves_.clear();
+        surfaces_.clear();
+    }
+}
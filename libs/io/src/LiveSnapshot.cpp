@@ -0,0 +1,125 @@
+//
+// Created by Francisco Nunez on 06.02.2026.
+//
+
+#include "io/LiveSnapshot.h"
+
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+#include <utility>
+
+#include "io/SurfaceBuilder.h"
+#include "tasks/Parallel.h"
+
+namespace curve::io {
+    namespace {
+
+        // Builds the named objects of `records` in parallel, keyed by id.
+        template<typename Object, typename Record, typename IdOf, typename Build>
+        std::map<std::string, std::shared_ptr<Object> > build_selected(const std::vector<Record> &records,
+                                                                      const std::set<std::string> &ids,
+                                                                      std::size_t threads, IdOf id_of, Build build) {
+            std::vector<const Record *> selected;
+            for (const auto &r: records) {
+                if (ids.contains(id_of(r))) selected.push_back(&r);
+            }
+            std::vector<std::shared_ptr<Object> > built(selected.size());
+            tasks::parallel_for_bounded(selected.size(), threads, [&](std::size_t i) { built[i] = build(*selected[i]); });
+
+            std::map<std::string, std::shared_ptr<Object> > result;
+            for (std::size_t i = 0; i < selected.size(); ++i) result.emplace(id_of(*selected[i]), std::move(built[i]));
+            return result;
+        }
+
+        const auto curve_id = [](const YieldCurveRecord &c) -> const std::string & { return c.curve_id; };
+        const auto underlying_id = [](const VolSurfaceRecord &s) -> const std::string & {
+            return s.header.underlying_id;
+        };
+
+        std::shared_ptr<ICurve> build_curve(const YieldCurveRecord &record) { return build_yield_curve(record); }
+
+        std::shared_ptr<volatility::ImpliedVolSurface> build_surface(const VolSurfaceRecord &record) {
+            return build_vol_surface(record.header, record.points);
+        }
+
+        // Copy of the record with id `id` with the patch's point updates applied
+        template<typename Record, typename Patch, typename IdOf, typename Update>
+        Record patched(const std::vector<Record> &records, const Patch &patch, IdOf id_of, const std::string &id,
+                       Update update) {
+            const auto it = std::find_if(records.begin(), records.end(), [&](const Record &r) {
+                return id_of(r) == id;
+            });
+            if (it == records.end()) throw std::invalid_argument("LiveSnapshot: delta patches unknown object " + id);
+            Record copy = *it;
+            try {
+                for (const auto &p: patch.points) update(copy, p);
+            } catch (const std::out_of_range &) {
+                throw std::invalid_argument("LiveSnapshot: delta patches a missing point of " + id);
+            }
+            return copy;
+        }
+
+        template<typename Record, typename IdOf>
+        std::set<std::string> all_ids(const std::vector<Record> &records, IdOf id_of) {
+            std::set<std::string> ids;
+            for (const auto &r: records) ids.insert(id_of(r));
+            return ids;
+        }
+    }
+
+    LiveSnapshot::LiveSnapshot(SnapshotData data, std::size_t threads) : data_(std::move(data)), threads_(threads) {
+        curves_ = build_selected<ICurve>(data_.yield_curves, all_ids(data_.yield_curves, curve_id), threads_, curve_id,
+                                         build_curve);
+        surfaces_ = build_selected<volatility::ImpliedVolSurface>(
+            data_.vol_surfaces, all_ids(data_.vol_surfaces, underlying_id), threads_, underlying_id, build_surface);
+    }
+
+    LiveSnapshot::Changes LiveSnapshot::apply(const SnapshotDelta &delta) {
+        // Only the records the delta touches are copied and built before anything is committed
+        std::vector<YieldCurveRecord> touched_curves = delta.upserted_curves;
+        for (const auto &patch: delta.curve_patches) {
+            touched_curves.push_back(patched(data_.yield_curves, patch, curve_id, patch.curve_id,
+                                             [](YieldCurveRecord &c, const YieldPointUpdate &p) {
+                                                 c.points.at(p.index).value = p.value;
+                                             }));
+        }
+        std::vector<VolSurfaceRecord> touched_surfaces = delta.upserted_surfaces;
+        for (const auto &patch: delta.surface_patches) {
+            touched_surfaces.push_back(patched(data_.vol_surfaces, patch, underlying_id, patch.underlying_id,
+                                               [](VolSurfaceRecord &s, const VolPointUpdate &p) {
+                                                   auto &point = s.points.at(p.index);
+                                                   point.volatility = p.volatility;
+                                                   point.forward = p.forward;
+                                                   point.total_variance = p.total_variance;
+                                               }));
+        }
+        auto rebuilt_curves = build_selected<ICurve>(touched_curves, all_ids(touched_curves, curve_id), threads_,
+                                                     curve_id, build_curve);
+        auto rebuilt_surfaces = build_selected<volatility::ImpliedVolSurface>(
+            touched_surfaces, all_ids(touched_surfaces, underlying_id), threads_, underlying_id, build_surface);
+
+        apply_delta(data_, delta); // validates first, leaves data_ untouched when it throws
+
+        Changes changes;
+        for (auto &[id, curve]: rebuilt_curves) {
+            changes.rebuilt_curves.push_back(id);
+            curves_[id] = std::move(curve);
+        }
+        for (const auto &id: delta.removed_curves) {
+            curves_.erase(id);
+            changes.removed_curves.push_back(id);
+        }
+        for (auto &[id, surface]: rebuilt_surfaces) {
+            changes.rebuilt_surfaces.push_back(id);
+            surfaces_[id] = std::move(surface);
+        }
+        for (const auto &id: delta.removed_surfaces) {
+            surfaces_.erase(id);
+            changes.removed_surfaces.push_back(id);
+        }
+        changes.quotes_changed = !delta.added_quote_sets.empty() || !delta.quote_set_patches.empty() ||
+                                 !delta.removed_quote_sets.empty();
+        return changes;
+    }
+}
@@ -0,0 +1,61 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#include "io/MappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace curve::io {
+    MappedFile::MappedFile(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ > 0) {
+            void *mapping = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("MappedFile: mmap failed for " + path);
+            }
+            data_ = mapping;
+        }
+        ::close(fd);
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            release();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    void MappedFile::release() noexcept {
+        if (data_ != nullptr) {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+        }
+    }
+}
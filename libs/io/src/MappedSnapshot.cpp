@@ -0,0 +1,456 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#include "io/BinarySnapshot.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "time/date.hpp"
+
+namespace curve::io {
+    namespace {
+        using namespace binary;
+
+        std::optional<time::Instant> from_millis(std::int64_t ms) {
+            if (ms == kNoInstant) return std::nullopt;
+            return time::Instant{std::chrono::duration_cast<time::Instant::duration>(std::chrono::milliseconds{ms})};
+        }
+
+        std::optional<double> from_nan(double v) {
+            if (std::isnan(v)) return std::nullopt;
+            return v;
+        }
+
+        [[noreturn]] void corrupt(const std::string &what) {
+            throw std::runtime_error("MappedSnapshot: corrupt snapshot: " + what);
+        }
+
+        // Typed pointer to an array inside a section, bounds-checked against the section size.
+        template<typename T>
+        const T *array_at(const std::byte *section, std::uint64_t section_size, std::uint64_t offset,
+                          std::uint64_t count, const char *what) {
+            if (offset > section_size || count > (section_size - offset) / sizeof(T) ||
+                offset % alignof(T) != 0) {
+                corrupt(what);
+            }
+            return reinterpret_cast<const T *>(section + offset);
+        }
+
+        void check_range(std::uint64_t first, std::uint64_t count, std::uint64_t total, const char *what) {
+            if (first > total || count > total - first) corrupt(what);
+        }
+    }
+
+    std::string_view StringTable::operator[](binary::StringRef ref) const {
+        if (ref.length == 0) return {};
+        if (static_cast<std::uint64_t>(ref.offset) + ref.length > size_) {
+            corrupt("string reference out of range");
+        }
+        return {base_ + ref.offset, ref.length};
+    }
+
+    // ---- views ----
+
+    time::Date YieldCurveView::as_of() const { return time::from_serial(entry_->as_of); }
+
+    std::optional<time::Date> YieldCurveView::maturity_date(std::size_t i) const {
+        if (maturities_[i] == kNoDate) return std::nullopt;
+        return time::from_serial(maturities_[i]);
+    }
+
+    YieldCurveRecord YieldCurveView::to_record() const {
+        YieldCurveRecord r;
+        r.curve_id = curve_id();
+        r.currency = currency();
+        r.as_of = as_of();
+        r.curve_type = curve_type();
+        r.day_count = day_count();
+        r.compounding = compounding();
+        r.interpolation = interpolation();
+        r.reference_index = reference_index();
+        r.calendar_name = calendar_name();
+        r.business_day_convention = business_day_convention();
+        r.points.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            r.points.push_back({std::string(tenor(i)), maturity_date(i), values_[i]});
+        }
+        return r;
+    }
+
+    time::Date VolSurfaceView::as_of() const { return time::from_serial(entry_->as_of); }
+
+    VolSurfaceHeaderRecord VolSurfaceView::header_record() const {
+        VolSurfaceHeaderRecord h;
+        h.underlying_id = underlying_id();
+        h.as_of = as_of();
+        h.quote_type = quote_type();
+        h.strike_dimension = strike_dimension();
+        h.strike_unit = strike_unit();
+        h.expiry_interpolation = expiry_interpolation();
+        h.strike_interpolation = strike_interpolation();
+        return h;
+    }
+
+    VolSurfaceRecord VolSurfaceView::to_record() const {
+        VolSurfaceRecord r{header_record(), {}};
+        r.points.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            r.points.push_back({
+                std::string(expiry(i)), strikes_[i], volatilities_[i], from_nan(forwards_[i]),
+                from_nan(total_variances_[i])
+            });
+        }
+        return r;
+    }
+
+    InstrumentQuoteRecord InstrumentQuoteView::to_record() const {
+        InstrumentQuoteRecord r;
+        r.instrument_id = instrument_id();
+        r.quotes.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            QuoteRecord q;
+            q.value = values_[i];
+            q.side = side(i);
+            q.value_type = value_type(i);
+            q.currency = currency(i);
+            q.size = from_nan(sizes_[i]);
+            q.timestamp = from_millis(timestamps_[i]);
+            q.quality = quality(i);
+            q.source = source(i);
+            r.quotes.push_back(std::move(q));
+        }
+        return r;
+    }
+
+    time::Date QuoteSetView::as_of() const { return time::from_serial(entry_->as_of); }
+
+    std::optional<time::Instant> QuoteSetView::snapshot_time() const { return from_millis(entry_->snapshot_time); }
+
+    InstrumentQuoteView QuoteSetView::instrument(std::size_t i) const {
+        if (i >= size()) throw std::out_of_range("QuoteSetView::instrument");
+        const auto *instruments = reinterpret_cast<const InstrumentEntry *>(section_ + table_->instruments_offset);
+        const auto &e = instruments[entry_->first_instrument + i];
+        check_range(e.first_quote, e.quote_count, table_->quote_count, "instrument quote range");
+
+        InstrumentQuoteView v;
+        v.entry_ = &e;
+        v.values_ = reinterpret_cast<const double *>(section_ + table_->value_offset) + e.first_quote;
+        v.sizes_ = reinterpret_cast<const double *>(section_ + table_->size_offset) + e.first_quote;
+        v.timestamps_ = reinterpret_cast<const std::int64_t *>(section_ + table_->timestamp_offset) + e.first_quote;
+        v.sides_ = reinterpret_cast<const StringRef *>(section_ + table_->side_offset) + e.first_quote;
+        v.value_types_ = reinterpret_cast<const StringRef *>(section_ + table_->value_type_offset) + e.first_quote;
+        v.currencies_ = reinterpret_cast<const StringRef *>(section_ + table_->currency_offset) + e.first_quote;
+        v.qualities_ = reinterpret_cast<const StringRef *>(section_ + table_->quality_offset) + e.first_quote;
+        v.sources_ = reinterpret_cast<const StringRef *>(section_ + table_->source_offset) + e.first_quote;
+        v.strings_ = strings_;
+        return v;
+    }
+
+    QuoteSetRecord QuoteSetView::to_record() const {
+        QuoteSetRecord r;
+        r.header = {as_of(), snapshot_time(), std::string(feed_name()), std::string(scenario_name())};
+        r.instruments.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
+            r.instruments.push_back(instrument(i).to_record());
+        }
+        return r;
+    }
+
+    // ---- MappedSnapshot ----
+
+    MappedSnapshot::MappedSnapshot(const std::byte *base, std::size_t size, MappedFile file)
+        : file_(std::move(file)), base_(base), size_(size) {
+    }
+
+    MappedSnapshot MappedSnapshot::open(const std::string &path) {
+        MappedFile file(path);
+        const auto *base = file.data();
+        const auto size = file.size();
+        MappedSnapshot snapshot(base, size, std::move(file));
+        snapshot.index_sections();
+        return snapshot;
+    }
+
+    MappedSnapshot MappedSnapshot::from_buffer(const std::byte *data, std::size_t size) {
+        if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::uint64_t) != 0) {
+            throw std::invalid_argument("MappedSnapshot: buffer must be 8-byte aligned");
+        }
+        MappedSnapshot snapshot(data, size, MappedFile{});
+        snapshot.index_sections();
+        return snapshot;
+    }
+
+    void MappedSnapshot::index_sections() {
+        if (size_ < sizeof(FileHeader)) corrupt("truncated header");
+        FileHeader header;
+        std::memcpy(&header, base_, sizeof(header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("MappedSnapshot: bad magic, not a CurveForge snapshot");
+        }
+        if (header.version != kFormatVersion) {
+            throw std::runtime_error("MappedSnapshot: unsupported format version " + std::to_string(header.version));
+        }
+        if (header.file_size != size_) corrupt("file size mismatch");
+
+        const auto *directory = array_at<SectionEntry>(base_, size_, sizeof(FileHeader), header.section_count,
+                                                       "section directory");
+        for (std::uint32_t i = 0; i < header.section_count; ++i) {
+            const auto &entry = directory[i];
+            if (entry.offset > size_ || entry.size > size_ - entry.offset || entry.offset % kAlignment != 0) {
+                corrupt("section out of range");
+            }
+            const std::byte *section = base_ + entry.offset;
+            switch (static_cast<SectionKind>(entry.kind)) {
+                case SectionKind::STRINGS:
+                    strings_ = StringTable(reinterpret_cast<const char *>(section), entry.size);
+                    break;
+                case SectionKind::HEADER:
+                    if (entry.version > kHeaderVersion) corrupt("unsupported header section version");
+                    header_ = array_at<HeaderTable>(section, entry.size, 0, 1, "header section");
+                    break;
+                case SectionKind::YIELD_CURVES: {
+                    if (entry.version > kYieldCurvesVersion) corrupt("unsupported yield curve section version");
+                    const auto *t = array_at<YieldCurvesTable>(section, entry.size, 0, 1, "yield curve table");
+                    array_at<YieldCurveEntry>(section, entry.size, t->curves_offset, t->curve_count, "curves");
+                    array_at<StringRef>(section, entry.size, t->tenor_offset, t->point_count, "tenors");
+                    array_at<std::int32_t>(section, entry.size, t->maturity_offset, t->point_count, "maturities");
+                    array_at<double>(section, entry.size, t->value_offset, t->point_count, "curve values");
+                    curves_section_ = section;
+                    curves_ = t;
+                    break;
+                }
+                case SectionKind::VOL_SURFACES: {
+                    if (entry.version > kVolSurfacesVersion) corrupt("unsupported vol surface section version");
+                    const auto *t = array_at<VolSurfacesTable>(section, entry.size, 0, 1, "vol surface table");
+                    array_at<VolSurfaceEntry>(section, entry.size, t->surfaces_offset, t->surface_count, "surfaces");
+                    array_at<StringRef>(section, entry.size, t->expiry_offset, t->point_count, "expiries");
+                    for (const auto offset: {
+                             t->expiry_years_offset, t->strike_offset, t->volatility_offset, t->forward_offset,
+                             t->total_variance_offset
+                         }) {
+                        array_at<double>(section, entry.size, offset, t->point_count, "vol points");
+                    }
+                    surfaces_section_ = section;
+                    surfaces_ = t;
+                    break;
+                }
+                case SectionKind::QUOTE_SETS: {
+                    if (entry.version > kQuoteSetsVersion) corrupt("unsupported quote section version");
+                    const auto *t = array_at<QuoteSetsTable>(section, entry.size, 0, 1, "quote table");
+                    array_at<QuoteSetEntry>(section, entry.size, t->sets_offset, t->set_count, "quote sets");
+                    array_at<InstrumentEntry>(section, entry.size, t->instruments_offset, t->instrument_count,
+                                              "instruments");
+                    array_at<double>(section, entry.size, t->value_offset, t->quote_count, "quote values");
+                    array_at<double>(section, entry.size, t->size_offset, t->quote_count, "quote sizes");
+                    array_at<std::int64_t>(section, entry.size, t->timestamp_offset, t->quote_count, "timestamps");
+                    for (const auto offset: {
+                             t->side_offset, t->value_type_offset, t->currency_offset, t->quality_offset,
+                             t->source_offset
+                         }) {
+                        array_at<StringRef>(section, entry.size, offset, t->quote_count, "quote strings");
+                    }
+                    quotes_section_ = section;
+                    quotes_ = t;
+                    break;
+                }
+                case SectionKind::INDEX: {
+                    if (entry.version > kIndexVersion) break; // optional, fall back to linear lookups
+                    const auto *t = array_at<IndexTable>(section, entry.size, 0, 1, "index table");
+                    array_at<IndexEntry>(section, entry.size, t->curves_offset, t->curve_count, "curve index");
+                    array_at<IndexEntry>(section, entry.size, t->surfaces_offset, t->surface_count, "surface index");
+                    array_at<IndexEntry>(section, entry.size, t->quote_sets_offset, t->quote_set_count,
+                                         "quote set index");
+                    array_at<IndexEntry>(section, entry.size, t->instruments_offset, t->instrument_count,
+                                         "instrument index");
+                    index_section_ = section;
+                    index_ = t;
+                    break;
+                }
+                default:
+                    // Unknown section kind written by a newer build: skip.
+                    break;
+            }
+        }
+        if (header_ == nullptr) corrupt("missing header section");
+        if (index_ != nullptr) check_index();
+    }
+
+    void MappedSnapshot::check_index() const {
+        const auto check = [&](std::uint64_t offset, std::uint64_t count, std::uint64_t objects, const char *what) {
+            if (count != objects) corrupt(what);
+            const auto *entries = reinterpret_cast<const IndexEntry *>(index_section_ + offset);
+            for (std::uint64_t i = 0; i < count; ++i) {
+                if (entries[i].position >= objects) corrupt(what);
+            }
+        };
+        check(index_->curves_offset, index_->curve_count, yield_curve_count(), "curve index");
+        check(index_->surfaces_offset, index_->surface_count, vol_surface_count(), "surface index");
+        check(index_->quote_sets_offset, index_->quote_set_count, quote_set_count(), "quote set index");
+        check(index_->instruments_offset, index_->instrument_count, quotes_ ? quotes_->instrument_count : 0,
+              "instrument index");
+    }
+
+    std::span<const IndexEntry> MappedSnapshot::index_range(std::uint64_t offset, std::uint64_t count,
+                                                            std::string_view key, std::uint32_t group) const {
+        const auto *entries = reinterpret_cast<const IndexEntry *>(index_section_ + offset);
+        const auto *end = entries + count;
+        const auto *first = std::partition_point(entries, end, [&](const IndexEntry &e) {
+            return e.group != group ? e.group < group : strings_[e.key] < key;
+        });
+        const auto *last = std::partition_point(first, end, [&](const IndexEntry &e) {
+            return e.group == group && strings_[e.key] == key;
+        });
+        return {first, last};
+    }
+
+    SnapshotHeaderRecord MappedSnapshot::header() const {
+        SnapshotHeaderRecord h;
+        h.as_of = time::from_serial(header_->as_of);
+        h.snapshot_time = from_millis(header_->snapshot_time);
+        h.scenario_name = strings_[header_->scenario_name];
+        h.source = strings_[header_->source];
+        h.snapshot_id = strings_[header_->snapshot_id];
+        return h;
+    }
+
+    std::size_t MappedSnapshot::yield_curve_count() const {
+        return curves_ ? curves_->curve_count : 0;
+    }
+
+    YieldCurveView MappedSnapshot::yield_curve(std::size_t i) const {
+        if (i >= yield_curve_count()) throw std::out_of_range("MappedSnapshot::yield_curve");
+        const auto &e = reinterpret_cast<const YieldCurveEntry *>(curves_section_ + curves_->curves_offset)[i];
+        check_range(e.first_point, e.point_count, curves_->point_count, "yield curve point range");
+
+        YieldCurveView v;
+        v.entry_ = &e;
+        v.tenors_ = reinterpret_cast<const StringRef *>(curves_section_ + curves_->tenor_offset) + e.first_point;
+        v.maturities_ = reinterpret_cast<const std::int32_t *>(curves_section_ + curves_->maturity_offset) +
+                        e.first_point;
+        v.values_ = reinterpret_cast<const double *>(curves_section_ + curves_->value_offset) + e.first_point;
+        v.strings_ = strings_;
+        return v;
+    }
+
+    std::optional<YieldCurveView> MappedSnapshot::find_yield_curve(std::string_view curve_id) const {
+        if (index_ != nullptr) {
+            const auto hits = index_range(index_->curves_offset, index_->curve_count, curve_id);
+            if (hits.empty()) return std::nullopt;
+            return yield_curve(hits.front().position);
+        }
+        for (std::size_t i = 0; i < yield_curve_count(); ++i) {
+            auto v = yield_curve(i);
+            if (v.curve_id() == curve_id) return v;
+        }
+        return std::nullopt;
+    }
+
+    std::size_t MappedSnapshot::vol_surface_count() const {
+        return surfaces_ ? surfaces_->surface_count : 0;
+    }
+
+    VolSurfaceView MappedSnapshot::vol_surface(std::size_t i) const {
+        if (i >= vol_surface_count()) throw std::out_of_range("MappedSnapshot::vol_surface");
+        const auto &e = reinterpret_cast<const VolSurfaceEntry *>(surfaces_section_ + surfaces_->surfaces_offset)[i];
+        check_range(e.first_point, e.point_count, surfaces_->point_count, "vol surface point range");
+
+        const auto doubles = [&](std::uint64_t offset) {
+            return reinterpret_cast<const double *>(surfaces_section_ + offset) + e.first_point;
+        };
+        VolSurfaceView v;
+        v.entry_ = &e;
+        v.expiries_ = reinterpret_cast<const StringRef *>(surfaces_section_ + surfaces_->expiry_offset) +
+                      e.first_point;
+        v.expiry_years_ = doubles(surfaces_->expiry_years_offset);
+        v.strikes_ = doubles(surfaces_->strike_offset);
+        v.volatilities_ = doubles(surfaces_->volatility_offset);
+        v.forwards_ = doubles(surfaces_->forward_offset);
+        v.total_variances_ = doubles(surfaces_->total_variance_offset);
+        v.strings_ = strings_;
+        return v;
+    }
+
+    std::optional<VolSurfaceView> MappedSnapshot::find_vol_surface(std::string_view underlying_id) const {
+        if (index_ != nullptr) {
+            const auto hits = index_range(index_->surfaces_offset, index_->surface_count, underlying_id);
+            if (hits.empty()) return std::nullopt;
+            return vol_surface(hits.front().position);
+        }
+        for (std::size_t i = 0; i < vol_surface_count(); ++i) {
+            auto v = vol_surface(i);
+            if (v.underlying_id() == underlying_id) return v;
+        }
+        return std::nullopt;
+    }
+
+    std::size_t MappedSnapshot::quote_set_count() const {
+        return quotes_ ? quotes_->set_count : 0;
+    }
+
+    QuoteSetView MappedSnapshot::quote_set(std::size_t i) const {
+        if (i >= quote_set_count()) throw std::out_of_range("MappedSnapshot::quote_set");
+        const auto &e = reinterpret_cast<const QuoteSetEntry *>(quotes_section_ + quotes_->sets_offset)[i];
+        check_range(e.first_instrument, e.instrument_count, quotes_->instrument_count, "quote set range");
+
+        QuoteSetView v;
+        v.entry_ = &e;
+        v.table_ = quotes_;
+        v.section_ = quotes_section_;
+        v.strings_ = strings_;
+        return v;
+    }
+
+    std::optional<QuoteSetView> MappedSnapshot::find_quote_set(std::string_view feed_name,
+                                                               std::string_view scenario_name) const {
+        const auto matches = [&](const QuoteSetView &v) {
+            return v.feed_name() == feed_name && (scenario_name.empty() || v.scenario_name() == scenario_name);
+        };
+        if (index_ != nullptr) {
+            // Entries with equal keys keep file order, so the first match is the first set in the file
+            for (const auto &e: index_range(index_->quote_sets_offset, index_->quote_set_count, feed_name)) {
+                if (auto v = quote_set(e.position); matches(v)) return v;
+            }
+            return std::nullopt;
+        }
+        for (std::size_t i = 0; i < quote_set_count(); ++i) {
+            if (auto v = quote_set(i); matches(v)) return v;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<InstrumentQuoteView> MappedSnapshot::find_instrument_quotes(std::size_t quote_set_index,
+                                                                              std::string_view instrument_id) const {
+        const auto set = quote_set(quote_set_index);
+        if (index_ != nullptr) {
+            const auto hits = index_range(index_->instruments_offset, index_->instrument_count, instrument_id,
+                                          static_cast<std::uint32_t>(quote_set_index));
+            if (hits.empty()) return std::nullopt;
+            const auto position = hits.front().position;
+            if (position < set.first_instrument() || position - set.first_instrument() >= set.size()) {
+                corrupt("instrument index");
+            }
+            return set.instrument(position - set.first_instrument());
+        }
+        for (std::size_t i = 0; i < set.size(); ++i) {
+            if (auto v = set.instrument(i); v.instrument_id() == instrument_id) return v;
+        }
+        return std::nullopt;
+    }
+
+    SnapshotData MappedSnapshot::to_snapshot_data() const {
+        SnapshotData data;
+        data.header = header();
+        data.yield_curves.reserve(yield_curve_count());
+        for (std::size_t i = 0; i < yield_curve_count(); ++i) data.yield_curves.push_back(yield_curve(i).to_record());
+        data.vol_surfaces.reserve(vol_surface_count());
+        for (std::size_t i = 0; i < vol_surface_count(); ++i) data.vol_surfaces.push_back(vol_surface(i).to_record());
+        data.quote_sets.reserve(quote_set_count());
+        for (std::size_t i = 0; i < quote_set_count(); ++i) data.quote_sets.push_back(quote_set(i).to_record());
+        return data;
+    }
+}
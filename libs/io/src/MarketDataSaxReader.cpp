@@ -0,0 +1,290 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#include "io/MarketDataSaxReader.h"
+#include "io/ParseUtils.h"
+#include "XercesUtils.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <xercesc/framework/LocalFileInputSource.hpp>
+#include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/sax/SAXParseException.hpp>
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/util/TransService.hpp>
+#include <xercesc/util/XMLString.hpp>
+
+namespace curve::io {
+    namespace {
+        namespace xc = xercesc;
+
+        using detail::narrow;
+        using detail::to_string;
+
+        enum class Section {
+            NONE, HEADER, YIELD_CURVE, VOL_SURFACE, QUOTE_SET
+        };
+
+        class SnapshotHandler : public xc::DefaultHandler {
+        public:
+            explicit SnapshotHandler(const MarketDataCallbacks &cb) : cb_(cb) {
+            }
+
+            void startElement(const XMLCh *const, const XMLCh *const localname, const XMLCh *const,
+                              const xc::Attributes &) override {
+                narrow(localname, name_);
+                text_.clear();
+                const std::size_t depth = path_.size();
+                path_.push_back(name_);
+
+                // depth 0: MarketDataSnapshot, 1: header | yieldCurves | volSurfaces | quoteSets
+                if (depth == 1 && name_ == "header") {
+                    section_ = Section::HEADER;
+                    header_ = {};
+                } else if (depth == 2 && name_ == "yieldCurve") {
+                    section_ = Section::YIELD_CURVE;
+                    curve_ = {};
+                } else if (depth == 2 && name_ == "volSurface") {
+                    section_ = Section::VOL_SURFACE;
+                    surface_ = {};
+                } else if (depth == 2 && name_ == "quoteSet") {
+                    section_ = Section::QUOTE_SET;
+                    quote_set_ = {};
+                } else if (section_ == Section::YIELD_CURVE && name_ == "point") {
+                    curve_.points.emplace_back();
+                } else if (section_ == Section::VOL_SURFACE && name_ == "point") {
+                    point_ = {};
+                } else if (section_ == Section::VOL_SURFACE && name_ == "points") {
+                    if (cb_.on_vol_surface_begin) cb_.on_vol_surface_begin(surface_);
+                } else if (section_ == Section::QUOTE_SET && name_ == "instruments") {
+                    if (cb_.on_quote_set_begin) cb_.on_quote_set_begin(quote_set_);
+                } else if (section_ == Section::QUOTE_SET && name_ == "instrumentQuote") {
+                    instrument_ = {};
+                } else if (section_ == Section::QUOTE_SET && name_ == "quote") {
+                    instrument_.quotes.emplace_back();
+                }
+            }
+
+            void characters(const XMLCh *const chars, const XMLSize_t length) override {
+                xc::TranscodeToStr utf8(chars, length, "UTF-8");
+                text_.append(reinterpret_cast<const char *>(utf8.str()), utf8.length());
+            }
+
+            void endElement(const XMLCh *const, const XMLCh *const localname, const XMLCh *const) override {
+                narrow(localname, name_);
+                const std::string &parent = path_.size() >= 2 ? path_[path_.size() - 2] : empty_;
+                try {
+                    switch (section_) {
+                        case Section::HEADER:
+                            end_header();
+                            break;
+                        case Section::YIELD_CURVE:
+                            end_yield_curve(parent);
+                            break;
+                        case Section::VOL_SURFACE:
+                            end_vol_surface(parent);
+                            break;
+                        case Section::QUOTE_SET:
+                            end_quote_set(parent);
+                            break;
+                        case Section::NONE:
+                            break;
+                    }
+                } catch (const std::invalid_argument &e) {
+                    throw std::runtime_error(std::string("MarketDataSaxReader: <") + name_ + ">: " + e.what());
+                }
+                path_.pop_back();
+                text_.clear();
+            }
+
+            void fatalError(const xc::SAXParseException &e) override {
+                throw std::runtime_error("MarketDataSaxReader: XML error at line " + std::to_string(e.getLineNumber()) +
+                                         ": " + to_string(e.getMessage()));
+            }
+
+        private:
+            void end_header() {
+                if (path_.size() == 2) {
+                    // </header>
+                    section_ = Section::NONE;
+                    if (cb_.on_header) cb_.on_header(header_);
+                    return;
+                }
+                if (name_ == "asOf") header_.as_of = parse_date(text_);
+                else if (name_ == "snapshotTime") header_.snapshot_time = parse_date_time(text_);
+                else if (name_ == "scenarioName") header_.scenario_name = trim(text_);
+                else if (name_ == "source") header_.source = trim(text_);
+                else if (name_ == "snapshotId") header_.snapshot_id = trim(text_);
+            }
+
+            void end_yield_curve(const std::string &parent) {
+                if (path_.size() == 3) {
+                    // </yieldCurve>
+                    section_ = Section::NONE;
+                    if (cb_.on_yield_curve) cb_.on_yield_curve(std::move(curve_));
+                    curve_ = {};
+                    return;
+                }
+                if (parent == "point") {
+                    auto &p = curve_.points.back();
+                    if (name_ == "tenor") p.tenor = trim(text_);
+                    else if (name_ == "maturityDate") p.maturity_date = parse_date(text_);
+                    else if (name_ == "curveValue") p.value = parse_double(text_);
+                } else if (parent == "header") {
+                    const std::string v(trim(text_));
+                    if (name_ == "curveId") curve_.curve_id = v;
+                    else if (name_ == "currency") curve_.currency = v;
+                    else if (name_ == "asOf") curve_.as_of = parse_date(v);
+                    else if (name_ == "curveType") curve_.curve_type = v;
+                    else if (name_ == "dayCount") curve_.day_count = v;
+                    else if (name_ == "compounding") curve_.compounding = v;
+                    else if (name_ == "interpolation") curve_.interpolation = v;
+                    else if (name_ == "referenceIndex") curve_.reference_index = v;
+                    else if (name_ == "calendarName") curve_.calendar_name = v;
+                    else if (name_ == "businessDayConvention") curve_.business_day_convention = v;
+                }
+            }
+
+            void end_vol_surface(const std::string &parent) {
+                if (path_.size() == 3) {
+                    // </volSurface>
+                    section_ = Section::NONE;
+                    if (cb_.on_vol_surface_end) cb_.on_vol_surface_end(surface_);
+                    return;
+                }
+                if (name_ == "point" && parent == "points") {
+                    if (cb_.on_vol_point) cb_.on_vol_point(surface_, point_);
+                } else if (parent == "point") {
+                    if (name_ == "expiry") point_.expiry = trim(text_);
+                    else if (name_ == "strikeCoordinate") point_.strike_coordinate = parse_double(text_);
+                    else if (name_ == "volatility") point_.volatility = parse_double(text_);
+                    else if (name_ == "forward") point_.forward = parse_double(text_);
+                    else if (name_ == "totalVariance") point_.total_variance = parse_double(text_);
+                } else if (parent == "header") {
+                    const std::string v(trim(text_));
+                    if (name_ == "underlyingId") surface_.underlying_id = v;
+                    else if (name_ == "asOf") surface_.as_of = parse_date(v);
+                    else if (name_ == "quoteType") surface_.quote_type = v;
+                    else if (name_ == "strikeDimension") surface_.strike_dimension = v;
+                    else if (name_ == "strikeUnit") surface_.strike_unit = v;
+                    else if (name_ == "expiryInterpolation") surface_.expiry_interpolation = v;
+                    else if (name_ == "strikeInterpolation") surface_.strike_interpolation = v;
+                }
+            }
+
+            void end_quote_set(const std::string &parent) {
+                if (path_.size() == 3) {
+                    // </quoteSet>
+                    section_ = Section::NONE;
+                    if (cb_.on_quote_set_end) cb_.on_quote_set_end(quote_set_);
+                    return;
+                }
+                if (name_ == "instrumentQuote") {
+                    if (cb_.on_instrument_quote) cb_.on_instrument_quote(quote_set_, std::move(instrument_));
+                    instrument_ = {};
+                } else if (parent == "instrumentQuote" && name_ == "instrumentId") {
+                    instrument_.instrument_id = trim(text_);
+                } else if (parent == "quote") {
+                    auto &q = instrument_.quotes.back();
+                    if (name_ == "value") q.value = parse_double(text_);
+                    else if (name_ == "side") q.side = trim(text_);
+                    else if (name_ == "valueType") q.value_type = trim(text_);
+                    else if (name_ == "currency") q.currency = trim(text_);
+                    else if (name_ == "size") q.size = parse_double(text_);
+                    else if (name_ == "timestamp") q.timestamp = parse_date_time(text_);
+                    else if (name_ == "quality") q.quality = trim(text_);
+                    else if (name_ == "source") q.source = trim(text_);
+                } else if (parent == "quoteSet") {
+                    if (name_ == "asOf") quote_set_.as_of = parse_date(text_);
+                    else if (name_ == "snapshotTime") quote_set_.snapshot_time = parse_date_time(text_);
+                    else if (name_ == "feedName") quote_set_.feed_name = trim(text_);
+                    else if (name_ == "scenarioName") quote_set_.scenario_name = trim(text_);
+                }
+            }
+
+            const MarketDataCallbacks &cb_;
+            const std::string empty_;
+            std::vector<std::string> path_;
+            std::string name_;
+            std::string text_;
+            Section section_ = Section::NONE;
+
+            SnapshotHeaderRecord header_;
+            YieldCurveRecord curve_;
+            VolSurfaceHeaderRecord surface_;
+            VolPointRecord point_;
+            QuoteSetHeaderRecord quote_set_;
+            InstrumentQuoteRecord instrument_;
+        };
+
+        void run_parser(const MarketDataCallbacks &cb, const xc::InputSource &source) {
+            std::unique_ptr<xc::SAX2XMLReader> parser(xc::XMLReaderFactory::createXMLReader());
+            parser->setFeature(xc::XMLUni::fgSAX2CoreNameSpaces, true);
+            parser->setFeature(xc::XMLUni::fgSAX2CoreValidation, false);
+            parser->setFeature(xc::XMLUni::fgXercesLoadExternalDTD, false);
+            SnapshotHandler handler(cb);
+            parser->setContentHandler(&handler);
+            parser->setErrorHandler(&handler);
+            parser->parse(source);
+        }
+
+        MarketDataCallbacks collecting_callbacks(SnapshotData &data) {
+            MarketDataCallbacks cb;
+            cb.on_header = [&data](const SnapshotHeaderRecord &h) { data.header = h; };
+            cb.on_yield_curve = [&data](YieldCurveRecord &&c) { data.yield_curves.push_back(std::move(c)); };
+            cb.on_vol_surface_begin = [&data](const VolSurfaceHeaderRecord &h) {
+                data.vol_surfaces.push_back({h, {}});
+            };
+            cb.on_vol_point = [&data](const VolSurfaceHeaderRecord &, const VolPointRecord &p) {
+                data.vol_surfaces.back().points.push_back(p);
+            };
+            cb.on_quote_set_begin = [&data](const QuoteSetHeaderRecord &h) { data.quote_sets.push_back({h, {}}); };
+            cb.on_instrument_quote = [&data](const QuoteSetHeaderRecord &, InstrumentQuoteRecord &&q) {
+                data.quote_sets.back().instruments.push_back(std::move(q));
+            };
+            return cb;
+        }
+    }
+
+    MarketDataSaxReader::MarketDataSaxReader(MarketDataCallbacks callbacks) : callbacks_(std::move(callbacks)) {
+        xc::XMLPlatformUtils::Initialize();
+    }
+
+    MarketDataSaxReader::~MarketDataSaxReader() {
+        xc::XMLPlatformUtils::Terminate();
+    }
+
+    void MarketDataSaxReader::parse_file(const std::string &path) {
+        std::unique_ptr<XMLCh[], void (*)(XMLCh *)> xpath(xc::XMLString::transcode(path.c_str()), [](XMLCh *p) {
+            xc::XMLString::release(&p);
+        });
+        const xc::LocalFileInputSource source(xpath.get());
+        run_parser(callbacks_, source);
+    }
+
+    void MarketDataSaxReader::parse_buffer(const char *data, std::size_t size) {
+        const xc::MemBufInputSource source(reinterpret_cast<const XMLByte *>(data), size, "MarketDataSnapshot");
+        run_parser(callbacks_, source);
+    }
+
+    SnapshotData MarketDataSaxReader::read_file(const std::string &path) {
+        SnapshotData data;
+        MarketDataSaxReader reader(collecting_callbacks(data));
+        reader.parse_file(path);
+        return data;
+    }
+
+    SnapshotData MarketDataSaxReader::read_buffer(const char *data, std::size_t size) {
+        SnapshotData out;
+        MarketDataSaxReader reader(collecting_callbacks(out));
+        reader.parse_buffer(data, size);
+        return out;
+    }
+}
@@ -0,0 +1,128 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#include "io/ParseUtils.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+namespace curve::io {
+    namespace {
+        int parse_int(std::string_view s, std::size_t pos, std::size_t len, std::string_view what) {
+            if (pos + len > s.size()) throw std::invalid_argument("Truncated " + std::string(what) + ": " + std::string(s));
+            int v = 0;
+            for (std::size_t i = pos; i < pos + len; ++i) {
+                const char c = s[i];
+                if (c < '0' || c > '9') throw std::invalid_argument("Invalid " + std::string(what) + ": " + std::string(s));
+                v = v * 10 + (c - '0');
+            }
+            return v;
+        }
+    }
+
+    std::string_view trim(std::string_view s) noexcept {
+        const auto first = s.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos) return {};
+        const auto last = s.find_last_not_of(" \t\r\n");
+        return s.substr(first, last - first + 1);
+    }
+
+    time::Date parse_date(std::string_view s) {
+        s = trim(s);
+        if (s.size() < 10 || s[4] != '-' || s[7] != '-') {
+            throw std::invalid_argument("Invalid xs:date: " + std::string(s));
+        }
+        const time::Date d{
+            std::chrono::year{parse_int(s, 0, 4, "xs:date")},
+            std::chrono::month{static_cast<unsigned>(parse_int(s, 5, 2, "xs:date"))},
+            std::chrono::day{static_cast<unsigned>(parse_int(s, 8, 2, "xs:date"))}
+        };
+        if (!d.ok()) throw std::invalid_argument("Invalid xs:date: " + std::string(s));
+        return d;
+    }
+
+    time::Instant parse_date_time(std::string_view s) {
+        s = trim(s);
+        if (s.size() < 19 || s[10] != 'T' || s[13] != ':' || s[16] != ':') {
+            throw std::invalid_argument("Invalid xs:dateTime: " + std::string(s));
+        }
+        using namespace std::chrono;
+        const auto day_part = sys_days(parse_date(s.substr(0, 10)));
+        auto t = time::Instant(day_part) + hours{parse_int(s, 11, 2, "xs:dateTime")}
+                 + minutes{parse_int(s, 14, 2, "xs:dateTime")} + seconds{parse_int(s, 17, 2, "xs:dateTime")};
+
+        std::size_t pos = 19;
+        if (pos < s.size() && s[pos] == '.') {
+            // fractional seconds, keep up to nanoseconds
+            ++pos;
+            std::int64_t frac = 0;
+            int digits = 0;
+            while (pos < s.size() && s[pos] >= '0' && s[pos] <= '9') {
+                if (digits < 9) {
+                    frac = frac * 10 + (s[pos] - '0');
+                    ++digits;
+                }
+                ++pos;
+            }
+            while (digits++ < 9) frac *= 10;
+            t += duration_cast<time::Instant::duration>(nanoseconds{frac});
+        }
+        if (pos < s.size()) {
+            const char tz = s[pos];
+            if (tz == 'Z') {
+                ++pos;
+            } else if (tz == '+' || tz == '-') {
+                const int hh = parse_int(s, pos + 1, 2, "xs:dateTime");
+                const int mm = parse_int(s, pos + 4, 2, "xs:dateTime");
+                const minutes offset{hh * 60 + mm};
+                t = tz == '+' ? t - offset : t + offset;
+                pos += 6;
+            }
+        }
+        if (pos != s.size()) throw std::invalid_argument("Invalid xs:dateTime: " + std::string(s));
+        return t;
+    }
+
+    double parse_double(std::string_view s) {
+        s = trim(s);
+        const std::string buf(s);
+        char *end = nullptr;
+        const double v = std::strtod(buf.c_str(), &end);
+        if (buf.empty() || end != buf.c_str() + buf.size()) {
+            // xs:double also allows INF / -INF / NaN
+            if (buf == "INF") return std::numeric_limits<double>::infinity();
+            if (buf == "-INF") return -std::numeric_limits<double>::infinity();
+            if (buf == "NaN") return std::numeric_limits<double>::quiet_NaN();
+            throw std::invalid_argument("Invalid xs:double: " + buf);
+        }
+        return v;
+    }
+
+    bool parse_bool(std::string_view s) {
+        s = trim(s);
+        if (s == "true" || s == "1") return true;
+        if (s == "false" || s == "0") return false;
+        throw std::invalid_argument("Invalid xs:boolean: " + std::string(s));
+    }
+
+    std::string format_date(const time::Date &d) {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "%04d-%02u-%02u", static_cast<int>(d.year()),
+                      static_cast<unsigned>(d.month()), static_cast<unsigned>(d.day()));
+        return buf;
+    }
+
+    std::string format_date_time(const time::Instant &t) {
+        using namespace std::chrono;
+        const auto day = floor<days>(t);
+        const auto ms = duration_cast<milliseconds>(t - day).count();
+        char buf[40];
+        std::snprintf(buf, sizeof(buf), "%sT%02lld:%02lld:%02lld.%03lldZ", format_date(time::Date{day}).c_str(),
+                      static_cast<long long>(ms / 3600000), static_cast<long long>(ms / 60000 % 60),
+                      static_cast<long long>(ms / 1000 % 60), static_cast<long long>(ms % 1000));
+        return buf;
+    }
+}
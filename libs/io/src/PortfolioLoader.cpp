@@ -0,0 +1,398 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#include "io/PortfolioLoader.h"
+#include "io/MappedFile.h"
+#include "io/ParseUtils.h"
+#include "tasks/Parallel.h"
+#include "XercesUtils.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string_view>
+
+#include <xercesc/framework/MemBufInputSource.hpp>
+#include <xercesc/sax/SAXParseException.hpp>
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+#include <xercesc/util/TransService.hpp>
+
+namespace curve::io {
+    namespace {
+        namespace xc = xercesc;
+        using detail::narrow;
+
+        constexpr std::string_view kXsiNamespace = "http://www.w3.org/2001/XMLSchema-instance";
+
+        /**
+         * Collects the top-level <Instrument> elements (depth 1 under the root) of a portfolio
+         * document, plus the portfolio name and key.
+         */
+        class TradeHandler : public xc::DefaultHandler {
+        public:
+            explicit TradeHandler(std::vector<TradeRecord> &out) : out_(out) {
+            }
+
+            std::string name;
+            std::string key;
+
+            void startElement(const XMLCh *const, const XMLCh *const localname, const XMLCh *const,
+                              const xc::Attributes &attrs) override {
+                narrow(localname, element_);
+                text_.clear();
+                ++depth_;
+                if (depth_ == 2 && element_ == "Instrument") {
+                    in_trade_ = true;
+                    trade_ = {};
+                    for (XMLSize_t i = 0; i < attrs.getLength(); ++i) {
+                        narrow(attrs.getLocalName(i), attr_);
+                        if (attr_ != "type") continue;
+                        narrow(attrs.getURI(i), uri_);
+                        if (uri_ != kXsiNamespace) continue;
+                        narrow(attrs.getValue(i), trade_.type);
+                        // QName value: keep the local part
+                        if (const auto colon = trade_.type.find(':'); colon != std::string::npos) {
+                            trade_.type.erase(0, colon + 1);
+                        }
+                    }
+                } else if (in_trade_ && element_ == "cashflow") {
+                    trade_.cashflows.emplace_back();
+                }
+            }
+
+            void characters(const XMLCh *const chars, const XMLSize_t length) override {
+                xc::TranscodeToStr utf8(chars, length, "UTF-8");
+                text_.append(reinterpret_cast<const char *>(utf8.str()), utf8.length());
+            }
+
+            void endElement(const XMLCh *const, const XMLCh *const localname, const XMLCh *const) override {
+                narrow(localname, element_);
+                try {
+                    if (depth_ == 2) {
+                        if (in_trade_ && element_ == "Instrument") {
+                            out_.push_back(std::move(trade_));
+                            in_trade_ = false;
+                        } else if (element_ == "name") {
+                            name = trim(text_);
+                        } else if (element_ == "key") {
+                            key = trim(text_);
+                        }
+                    } else if (in_trade_ && depth_ == 3) {
+                        end_trade_field();
+                    } else if (in_trade_ && depth_ == 5 && !trade_.cashflows.empty()) {
+                        // Instrument / cashflows / cashflow / (date | amount)
+                        if (element_ == "date") trade_.cashflows.back().date = parse_date(text_);
+                        else if (element_ == "amount") trade_.cashflows.back().amount = parse_double(text_);
+                    }
+                } catch (const std::invalid_argument &e) {
+                    throw std::runtime_error("PortfolioLoader: trade '" + trade_.id + "' <" + element_ + ">: " +
+                                             e.what());
+                }
+                --depth_;
+                text_.clear();
+            }
+
+            void fatalError(const xc::SAXParseException &e) override {
+                throw std::runtime_error("PortfolioLoader: XML error at line " + std::to_string(e.getLineNumber()) +
+                                         ": " + detail::to_string(e.getMessage()));
+            }
+
+        private:
+            void end_trade_field() {
+                const std::string_view v = trim(text_);
+                if (element_ == "id") trade_.id = v;
+                else if (element_ == "name") trade_.name = v;
+                else if (element_ == "assetClass") trade_.asset_class = v;
+                else if (element_ == "notional") trade_.notional = parse_double(v);
+                else if (element_ == "fixedRate") trade_.fixed_rate = parse_double(v);
+                else if (element_ == "floatIndex") trade_.float_index = v;
+                else if (element_ == "floatTenor") trade_.float_tenor = v;
+                else if (element_ == "payFixed") trade_.pay_fixed = parse_bool(v);
+                else if (element_ == "currency") trade_.currency = v;
+            }
+
+            std::vector<TradeRecord> &out_;
+            TradeRecord trade_;
+            bool in_trade_ = false;
+            int depth_ = 0;
+            std::string element_;
+            std::string attr_;
+            std::string uri_;
+            std::string text_;
+        };
+
+        void parse_document(const std::string &doc, TradeHandler &handler, xc::SAX2XMLReader &parser) {
+            const xc::MemBufInputSource source(reinterpret_cast<const XMLByte *>(doc.data()), doc.size(),
+                                               "Portfolio");
+            parser.setContentHandler(&handler);
+            parser.setErrorHandler(&handler);
+            parser.parse(source);
+        }
+
+        std::unique_ptr<xc::SAX2XMLReader> make_parser() {
+            std::unique_ptr<xc::SAX2XMLReader> parser(xc::XMLReaderFactory::createXMLReader());
+            parser->setFeature(xc::XMLUni::fgSAX2CoreNameSpaces, true);
+            parser->setFeature(xc::XMLUni::fgSAX2CoreValidation, false);
+            parser->setFeature(xc::XMLUni::fgXercesLoadExternalDTD, false);
+            return parser;
+        }
+
+        /**
+         * Byte layout of a portfolio document: the root start tag, and the offsets of each
+         * top-level <Instrument> start tag up to the end of the last </Instrument>.
+         */
+        struct DocumentLayout {
+            std::string_view root_start_tag; // "<p:Portfolio xmlns:...>"
+            std::string root_end_tag; // "</p:Portfolio>"
+            std::size_t first_instrument = 0;
+            std::size_t instruments_end = 0;
+            std::vector<std::size_t> boundaries; // chunk starts, plus instruments_end
+        };
+
+        bool is_name_end(char c) {
+            return c == '>' || c == '/' || c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        // End of the tag starting at data[pos] == '<' (index of its '>'), honouring quoted attributes.
+        std::size_t tag_end(std::string_view data, std::size_t pos) {
+            char quote = 0;
+            for (std::size_t i = pos + 1; i < data.size(); ++i) {
+                const char c = data[i];
+                if (quote) {
+                    if (c == quote) quote = 0;
+                } else if (c == '"' || c == '\'') {
+                    quote = c;
+                } else if (c == '>') {
+                    return i;
+                }
+            }
+            throw std::runtime_error("PortfolioLoader: unterminated tag");
+        }
+
+        std::string_view tag_name(std::string_view data, std::size_t pos) {
+            std::size_t end = pos + 1;
+            while (end < data.size() && !is_name_end(data[end])) ++end;
+            return data.substr(pos + 1, end - pos - 1);
+        }
+
+        // Next element start tag at or after pos, skipping the prolog, comments, PIs and CDATA.
+        std::size_t next_start_tag(std::string_view data, std::size_t pos) {
+            while ((pos = data.find('<', pos)) != std::string_view::npos) {
+                if (data.compare(pos, 4, "<!--") == 0) {
+                    pos = data.find("-->", pos);
+                } else if (data.compare(pos, 9, "<![CDATA[") == 0) {
+                    pos = data.find("]]>", pos);
+                } else if (pos + 1 < data.size() && (data[pos + 1] == '?' || data[pos + 1] == '!' ||
+                                                     data[pos + 1] == '/')) {
+                    pos = data.find('>', pos);
+                } else {
+                    return pos;
+                }
+                if (pos == std::string_view::npos) break;
+            }
+            return std::string_view::npos;
+        }
+
+        std::string_view local_part(std::string_view qname) {
+            const auto colon = qname.find(':');
+            return colon == std::string_view::npos ? qname : qname.substr(colon + 1);
+        }
+
+        DocumentLayout scan_layout(std::string_view data, std::size_t chunk_bytes) {
+            DocumentLayout layout;
+            const auto root = next_start_tag(data, 0);
+            if (root == std::string_view::npos) {
+                throw std::runtime_error("PortfolioLoader: no root element");
+            }
+            const auto root_end = tag_end(data, root);
+            layout.root_start_tag = data.substr(root, root_end - root + 1);
+            layout.root_end_tag = "</" + std::string(tag_name(data, root)) + ">";
+
+            // First top-level Instrument; the header elements (name, key) have no children.
+            std::string_view instrument_qname;
+            for (auto pos = next_start_tag(data, root_end); pos != std::string_view::npos;
+                 pos = next_start_tag(data, pos + 1)) {
+                const auto qname = tag_name(data, pos);
+                if (local_part(qname) == "Instrument") {
+                    instrument_qname = qname;
+                    layout.first_instrument = pos;
+                    break;
+                }
+            }
+            if (instrument_qname.empty()) {
+                layout.first_instrument = layout.instruments_end = data.size();
+                return layout;
+            }
+
+            const std::string close = "</" + std::string(instrument_qname) + ">";
+            const auto last_close = data.rfind(close);
+            if (last_close == std::string_view::npos || last_close < layout.first_instrument) {
+                throw std::runtime_error("PortfolioLoader: unterminated <Instrument>");
+            }
+            layout.instruments_end = last_close + close.size();
+
+            // Chunk boundaries: the first Instrument start tag after every chunk_bytes step.
+            // Instrument children never use the name "Instrument", so a plain search is safe.
+            const std::string open = "<" + std::string(instrument_qname);
+            layout.boundaries.push_back(layout.first_instrument);
+            std::size_t pos = layout.first_instrument;
+            while (true) {
+                pos = data.find(open, pos + std::max<std::size_t>(chunk_bytes, 1));
+                while (pos != std::string_view::npos && pos < layout.instruments_end &&
+                       !is_name_end(data[pos + open.size()])) {
+                    pos = data.find(open, pos + 1);
+                }
+                if (pos == std::string_view::npos || pos >= layout.instruments_end) break;
+                layout.boundaries.push_back(pos);
+            }
+            layout.boundaries.push_back(layout.instruments_end);
+            return layout;
+        }
+
+        int tenor_months(std::string_view tenor) {
+            int count = 0;
+            const auto [end, ec] = std::from_chars(tenor.data(), tenor.data() + tenor.size(), count);
+            if (ec == std::errc() && end + 1 == tenor.data() + tenor.size() && count > 0) {
+                if (*end == 'M') return count;
+                if (*end == 'Y') return 12 * count;
+            }
+            throw std::invalid_argument("unsupported float tenor '" + std::string(tenor) + "'");
+        }
+
+        struct ParsedPortfolio {
+            std::string name;
+            std::string key;
+            std::vector<std::vector<TradeRecord> > chunks;
+        };
+
+        ParsedPortfolio parse_portfolio(const char *data, std::size_t size, const PortfolioLoadOptions &options) {
+            const std::string_view doc(data, size);
+            const auto layout = scan_layout(doc, options.chunk_bytes);
+            detail::XercesSession xerces;
+
+            ParsedPortfolio parsed;
+            {
+                // Header: everything before the first Instrument, closed with the root end tag.
+                std::vector<TradeRecord> none;
+                TradeHandler handler(none);
+                auto parser = make_parser();
+                std::string header_doc(doc.substr(0, layout.first_instrument));
+                header_doc += layout.root_end_tag;
+                parse_document(header_doc, handler, *parser);
+                parsed.name = std::move(handler.name);
+                parsed.key = std::move(handler.key);
+            }
+
+            const std::size_t chunk_count = layout.boundaries.empty() ? 0 : layout.boundaries.size() - 1;
+            parsed.chunks.resize(chunk_count);
+            tasks::parallel_for_bounded(chunk_count, options.threads, [&](std::size_t c) {
+                const auto begin = layout.boundaries[c];
+                const auto end = layout.boundaries[c + 1];
+                std::string chunk_doc;
+                chunk_doc.reserve(layout.root_start_tag.size() + (end - begin) + layout.root_end_tag.size());
+                chunk_doc.append(layout.root_start_tag);
+                chunk_doc.append(doc.substr(begin, end - begin));
+                chunk_doc.append(layout.root_end_tag);
+
+                auto parser = make_parser();
+                TradeHandler handler(parsed.chunks[c]);
+                parse_document(chunk_doc, handler, *parser);
+            });
+            return parsed;
+        }
+    }
+
+    std::vector<TradeRecord> PortfolioLoader::read_trades(const char *data, std::size_t size,
+                                                          const PortfolioLoadOptions &options) {
+        auto parsed = parse_portfolio(data, size, options);
+        std::vector<TradeRecord> trades;
+        for (auto &chunk: parsed.chunks) {
+            std::move(chunk.begin(), chunk.end(), std::back_inserter(trades));
+        }
+        return trades;
+    }
+
+    void PortfolioLoader::build_fix_float_swap(const TradeRecord &trade, instruments::StaticDataCache &cache,
+                                               instruments::InstrumentStore &store, std::size_t slot) {
+        using instruments::Leg;
+        if (trade.cashflows.empty()) {
+            throw std::invalid_argument("no cashflows");
+        }
+        const auto &conv = instruments::StaticDataCache::conventions(trade.currency);
+        const int float_months = tenor_months(trade.float_tenor);
+
+        const auto [first, last] = std::minmax_element(
+            trade.cashflows.begin(), trade.cashflows.end(),
+            [](const CashFlowRecord &a, const CashFlowRecord &b) { return a.date < b.date; });
+        const auto end = last->date;
+        const auto start = time::DateModifier::add_months(first->date, std::chrono::months(-float_months));
+
+        auto fixed_schedule = cache.schedule(start, end, conv.fixed_frequency_months, conv.bdc,
+                                             conv.fixed_day_count, conv.calendar);
+        auto float_schedule = cache.schedule(start, end, float_months, conv.bdc, conv.float_day_count,
+                                             conv.calendar);
+
+        store.emplace_fix_float_swap(slot, {trade.id, trade.fixed_rate, trade.pay_fixed},
+                                     Leg(trade.notional, trade.currency, std::move(fixed_schedule), Leg::FIXED),
+                                     Leg(trade.notional, trade.currency, std::move(float_schedule), Leg::FLOATING));
+    }
+
+    PortfolioLoadResult PortfolioLoader::load_buffer(const char *data, std::size_t size,
+                                                     instruments::StaticDataCache &cache,
+                                                     const PortfolioLoadOptions &options) {
+        auto parsed = parse_portfolio(data, size, options);
+
+        PortfolioLoadResult result;
+        result.name = std::move(parsed.name);
+        result.key = std::move(parsed.key);
+
+        // Assign store slots in document order
+        struct Job {
+            const TradeRecord *trade;
+            std::size_t slot;
+        };
+        std::vector<Job> jobs;
+        for (const auto &chunk: parsed.chunks) {
+            for (const auto &trade: chunk) {
+                ++result.trades_read;
+                if (trade.type == "IRSwap") {
+                    jobs.push_back({&trade, jobs.size()});
+                } else {
+                    ++result.unsupported[trade.type.empty() ? "Instrument" : trade.type];
+                }
+            }
+        }
+
+        result.store.reserve_fix_float_swaps(jobs.size());
+        std::mutex errors_mutex;
+        constexpr std::size_t batch = 256;
+        tasks::parallel_for_bounded((jobs.size() + batch - 1) / batch, options.threads, [&](std::size_t b) {
+            const auto end = std::min(jobs.size(), (b + 1) * batch);
+            for (std::size_t j = b * batch; j < end; ++j) {
+                try {
+                    build_fix_float_swap(*jobs[j].trade, cache, result.store, jobs[j].slot);
+                } catch (const std::exception &e) {
+                    std::lock_guard lock(errors_mutex);
+                    result.errors.push_back(jobs[j].trade->id + ": " + e.what());
+                }
+            }
+        });
+        result.store.finalize();
+        return result;
+    }
+
+    PortfolioLoadResult PortfolioLoader::load_file(const std::string &path, instruments::StaticDataCache &cache,
+                                                   const PortfolioLoadOptions &options) {
+        const MappedFile file(path);
+        return load_buffer(file.chars(), file.size(), cache, options);
+    }
+}
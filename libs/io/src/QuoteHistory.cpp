@@ -0,0 +1,224 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#include "io/QuoteHistory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "time/date.hpp"
+
+namespace curve::io {
+    namespace {
+        using namespace history;
+
+        std::int64_t to_millis(const time::Instant &t) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+        }
+
+        [[noreturn]] void corrupt(const std::string &what) {
+            throw std::runtime_error("QuoteHistory: corrupt quote history: " + what);
+        }
+
+        // Typed pointer to an array inside a block, bounds-checked against the block size.
+        template<typename T>
+        const T *array_at(const std::byte *block, std::uint64_t block_size, std::uint64_t offset,
+                          std::uint64_t count, const char *what) {
+            if (offset > block_size || count > (block_size - offset) / sizeof(T) || offset % alignof(T) != 0) {
+                corrupt(what);
+            }
+            return reinterpret_cast<const T *>(block + offset);
+        }
+
+        template<typename T>
+        std::span<const T> column(const BlockHeader *block, std::uint64_t offset, std::size_t first, std::size_t n) {
+            return {reinterpret_cast<const T *>(reinterpret_cast<const std::byte *>(block) + offset) + first, n};
+        }
+
+        // First row in [deltas) whose timestamp base + delta is >= t
+        std::size_t lower_row(std::span<const std::uint32_t> deltas, std::int64_t base, std::int64_t t) {
+            if (t <= base) return 0;
+            const auto delta = static_cast<std::uint64_t>(t - base);
+            if (delta > std::numeric_limits<std::uint32_t>::max()) return deltas.size();
+            return std::lower_bound(deltas.begin(), deltas.end(), static_cast<std::uint32_t>(delta)) - deltas.begin();
+        }
+    }
+
+    // ---- QuoteRun ----
+
+    time::Date QuoteRun::as_of() const {
+        return time::from_serial(block_->as_of);
+    }
+
+    time::Instant QuoteRun::timestamp(std::size_t i) const {
+        return time::Instant{
+            std::chrono::duration_cast<time::Instant::duration>(std::chrono::milliseconds{base_timestamp_ + deltas_[i]})
+        };
+    }
+
+    QuoteRecord QuoteRun::record(std::size_t i) const {
+        QuoteRecord q;
+        q.value = values_[i];
+        q.side = side(i);
+        q.value_type = value_type(i);
+        q.currency = currency(i);
+        if (!std::isnan(sizes_[i])) q.size = sizes_[i];
+        q.timestamp = timestamp(i);
+        q.quality = quality(i);
+        q.source = source(i);
+        return q;
+    }
+
+    // ---- QuoteHistory ----
+
+    QuoteHistory::QuoteHistory(const std::byte *base, std::size_t size, MappedFile file)
+        : file_(std::move(file)), base_(base), size_(size) {
+        index_blocks();
+    }
+
+    QuoteHistory QuoteHistory::open(const std::string &path) {
+        MappedFile file(path);
+        const auto *base = file.data();
+        const auto size = file.size();
+        return QuoteHistory(base, size, std::move(file));
+    }
+
+    QuoteHistory QuoteHistory::from_buffer(const std::byte *data, std::size_t size) {
+        if (reinterpret_cast<std::uintptr_t>(data) % alignof(std::int64_t) != 0) {
+            throw std::invalid_argument("QuoteHistory: buffer must be 8-byte aligned");
+        }
+        return QuoteHistory(data, size, MappedFile{});
+    }
+
+    void QuoteHistory::index_blocks() {
+        if (size_ < kAlignment) corrupt("file too small");
+        FileHeader header{};
+        std::memcpy(&header, base_, sizeof(header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) corrupt("bad magic");
+        if (header.version != kFormatVersion) {
+            throw std::runtime_error("QuoteHistory: unsupported format version " + std::to_string(header.version));
+        }
+
+        labels_.emplace_back(); // code 0: empty label
+        std::uint64_t offset = kAlignment;
+        while (offset < size_) {
+            const auto remaining = size_ - offset;
+            if (remaining < sizeof(BlockHeader)) break; // torn append
+            const auto *block_bytes = base_ + offset;
+            const auto *block = reinterpret_cast<const BlockHeader *>(block_bytes);
+            if (block->block_size > remaining) break; // torn append
+            if (block->magic != kBlockMagic) corrupt("bad block magic");
+            if (block->version != kBlockVersion) {
+                throw std::runtime_error("QuoteHistory: unsupported block version " + std::to_string(block->version));
+            }
+            const auto block_size = block->block_size;
+            if (block_size < sizeof(BlockHeader) || block_size % kAlignment != 0) corrupt("bad block size");
+
+            // Dictionary additions
+            const auto entries = static_cast<std::uint64_t>(block->new_instrument_count) + block->new_label_count;
+            const auto *dictionary = array_at<binary::StringRef>(block_bytes, block_size, block->dictionary_offset,
+                                                                 entries, "dictionary");
+            if (block->dictionary_chars_offset > block_size) corrupt("dictionary chars");
+            const auto *chars = reinterpret_cast<const char *>(block_bytes + block->dictionary_chars_offset);
+            const auto chars_size = block_size - block->dictionary_chars_offset;
+            for (std::uint64_t i = 0; i < entries; ++i) {
+                const auto ref = dictionary[i];
+                if (static_cast<std::uint64_t>(ref.offset) + ref.length > chars_size) corrupt("dictionary entry");
+                const std::string_view name(chars + ref.offset, ref.length);
+                if (i < block->new_instrument_count) {
+                    instrument_codes_.emplace(name, static_cast<std::uint32_t>(instrument_ids_.size()));
+                    instrument_ids_.push_back(name);
+                } else {
+                    labels_.push_back(name);
+                }
+            }
+            if (labels_.size() > kMaxLabels + 1) corrupt("too many labels");
+            if (block->feed_name >= labels_.size() || block->scenario_name >= labels_.size()) corrupt("block labels");
+
+            // Columns
+            const auto rows = block->row_count;
+            array_at<double>(block_bytes, block_size, block->value_offset, rows, "values");
+            array_at<double>(block_bytes, block_size, block->size_offset, rows, "sizes");
+            const auto *deltas = array_at<std::uint32_t>(block_bytes, block_size, block->delta_offset, rows, "deltas");
+            for (const auto label_offset: {
+                     block->side_offset, block->value_type_offset, block->currency_offset, block->quality_offset,
+                     block->source_offset
+                 }) {
+                const auto *codes = array_at<std::uint16_t>(block_bytes, block_size, label_offset, rows, "labels");
+                if (rows > 0 && *std::max_element(codes, codes + rows) >= labels_.size()) corrupt("label code");
+            }
+
+            // Runs
+            const auto *runs = array_at<RunEntry>(block_bytes, block_size, block->runs_offset, block->run_count, "runs");
+            runs_.resize(instrument_ids_.size());
+            for (std::uint32_t r = 0; r < block->run_count; ++r) {
+                const auto &run = runs[r];
+                if (run.instrument >= instrument_ids_.size() || run.row_count == 0 || run.first_row > rows ||
+                    run.row_count > rows - run.first_row) {
+                    corrupt("run");
+                }
+                runs_[run.instrument].push_back({
+                    block, &run, run.base_timestamp + deltas[run.first_row],
+                    run.base_timestamp + deltas[run.first_row + run.row_count - 1]
+                });
+            }
+
+            blocks_.push_back(block);
+            row_count_ += rows;
+            offset += block_size;
+        }
+        valid_size_ = std::min<std::uint64_t>(offset, size_);
+
+        for (auto &refs: runs_) {
+            std::stable_sort(refs.begin(), refs.end(), [](const RunRef &a, const RunRef &b) {
+                return a.first_timestamp < b.first_timestamp;
+            });
+        }
+    }
+
+    QuoteRun QuoteHistory::make_run(const RunRef &ref, std::size_t begin, std::size_t end) const {
+        const auto *block = ref.block;
+        const auto first = ref.run->first_row + begin;
+        const auto n = end - begin;
+
+        QuoteRun run;
+        run.block_ = block;
+        run.labels_ = labels_.data();
+        run.instrument_id_ = instrument_ids_[ref.run->instrument];
+        run.base_timestamp_ = ref.run->base_timestamp;
+        run.values_ = column<double>(block, block->value_offset, first, n);
+        run.sizes_ = column<double>(block, block->size_offset, first, n);
+        run.deltas_ = column<std::uint32_t>(block, block->delta_offset, first, n);
+        run.sides_ = column<std::uint16_t>(block, block->side_offset, first, n).data();
+        run.value_types_ = column<std::uint16_t>(block, block->value_type_offset, first, n).data();
+        run.currencies_ = column<std::uint16_t>(block, block->currency_offset, first, n).data();
+        run.qualities_ = column<std::uint16_t>(block, block->quality_offset, first, n).data();
+        run.sources_ = column<std::uint16_t>(block, block->source_offset, first, n).data();
+        return run;
+    }
+
+    std::vector<QuoteRun> QuoteHistory::scan(std::string_view instrument_id, time::Instant from,
+                                             time::Instant to) const {
+        std::vector<QuoteRun> result;
+        const auto it = instrument_codes_.find(instrument_id);
+        if (it == instrument_codes_.end()) return result;
+
+        const auto from_ms = to_millis(from);
+        const auto to_ms = to_millis(to);
+        for (const auto &ref: runs_[it->second]) {
+            if (ref.first_timestamp >= to_ms) break;
+            if (ref.last_timestamp < from_ms) continue;
+            const auto deltas = column<std::uint32_t>(ref.block, ref.block->delta_offset, ref.run->first_row,
+                                                      ref.run->row_count);
+            const auto begin = lower_row(deltas, ref.run->base_timestamp, from_ms);
+            const auto end = lower_row(deltas, ref.run->base_timestamp, to_ms);
+            if (begin < end) result.push_back(make_run(ref, begin, end));
+        }
+        return result;
+    }
+}
@@ -0,0 +1,201 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#include "io/QuoteHistory.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+
+#include "ByteBuffer.h"
+#include "time/date.hpp"
+
+namespace curve::io {
+    namespace {
+        using namespace history;
+        using detail::ByteBuffer;
+
+        struct Row {
+            std::uint32_t instrument;
+            std::int64_t timestamp;
+            const QuoteRecord *quote;
+        };
+
+        std::int64_t to_millis(const time::Instant &t) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(t.time_since_epoch()).count();
+        }
+
+        void append_dictionary(const std::vector<std::string> &names, std::vector<binary::StringRef> &refs,
+                               std::string &chars) {
+            for (const auto &name: names) {
+                if (chars.size() + name.size() > std::numeric_limits<std::uint32_t>::max()) {
+                    throw std::length_error("QuoteHistoryWriter: dictionary block exceeds 4GB");
+                }
+                refs.push_back({static_cast<std::uint32_t>(chars.size()), static_cast<std::uint32_t>(name.size())});
+                chars.append(name);
+            }
+        }
+    }
+
+    QuoteHistoryWriter QuoteHistoryWriter::open(const std::string &path) {
+        QuoteHistoryWriter writer;
+        writer.path_ = path;
+        writer.labels_.emplace("", 0); // code 0 is the empty label, never stored
+
+        std::error_code ec;
+        const auto existing = std::filesystem::file_size(path, ec);
+        if (!ec && existing > 0) {
+            std::size_t valid_size = 0;
+            {
+                const auto history = QuoteHistory::open(path);
+                for (std::size_t i = 0; i < history.instrument_count(); ++i) {
+                    writer.instruments_.emplace(std::string(history.instrument_id(i)), static_cast<std::uint32_t>(i));
+                }
+                const auto &labels = history.labels();
+                for (std::size_t i = 1; i < labels.size(); ++i) {
+                    writer.labels_.emplace(std::string(labels[i]), static_cast<std::uint16_t>(i));
+                }
+                writer.block_count_ = history.block_count();
+                valid_size = history.valid_size();
+            }
+            if (valid_size != existing) std::filesystem::resize_file(path, valid_size);
+            writer.out_.open(path, std::ios::binary | std::ios::app);
+        } else {
+            writer.out_.open(path, std::ios::binary | std::ios::trunc);
+            FileHeader header{};
+            std::copy(std::begin(kMagic), std::end(kMagic), header.magic);
+            header.version = kFormatVersion;
+            ByteBuffer bytes;
+            bytes.append(&header, sizeof(header));
+            bytes.align(kAlignment);
+            writer.out_.write(reinterpret_cast<const char *>(bytes.bytes().data()),
+                              static_cast<std::streamsize>(bytes.size()));
+            writer.out_.flush();
+        }
+        if (!writer.out_) {
+            throw std::runtime_error("QuoteHistoryWriter: cannot open " + path);
+        }
+        return writer;
+    }
+
+    std::uint32_t QuoteHistoryWriter::instrument_code(const std::string &id) {
+        const auto [it, inserted] = instruments_.emplace(id, static_cast<std::uint32_t>(instruments_.size()));
+        if (inserted) new_instruments_.push_back(id);
+        return it->second;
+    }
+
+    std::uint16_t QuoteHistoryWriter::label_code(const std::string &label) {
+        const auto it = labels_.find(label);
+        if (it != labels_.end()) return it->second;
+        if (labels_.size() > kMaxLabels) {
+            throw std::length_error("QuoteHistoryWriter: more than 65535 distinct labels");
+        }
+        new_labels_.push_back(label);
+        return labels_.emplace(label, static_cast<std::uint16_t>(labels_.size())).first->second;
+    }
+
+    void QuoteHistoryWriter::append(const QuoteSetRecord &quote_set) {
+        if (!out_) {
+            throw std::runtime_error("QuoteHistoryWriter: " + path_ + " is in a failed state, reopen it");
+        }
+        new_instruments_.clear();
+        new_labels_.clear();
+        try {
+            const auto &h = quote_set.header;
+            const auto default_timestamp = to_millis(h.snapshot_time ? *h.snapshot_time
+                                                                     : time::Instant{std::chrono::sys_days{h.as_of}});
+            std::vector<Row> rows;
+            for (const auto &instrument: quote_set.instruments) {
+                const auto code = instrument_code(instrument.instrument_id);
+                for (const auto &q: instrument.quotes) {
+                    rows.push_back({code, q.timestamp ? to_millis(*q.timestamp) : default_timestamp, &q});
+                }
+            }
+            std::stable_sort(rows.begin(), rows.end(), [](const Row &a, const Row &b) {
+                return a.instrument != b.instrument ? a.instrument < b.instrument : a.timestamp < b.timestamp;
+            });
+
+            BlockHeader block{};
+            block.magic = kBlockMagic;
+            block.version = kBlockVersion;
+            block.as_of = time::to_serial(h.as_of);
+            block.row_count = rows.size();
+            block.feed_name = label_code(h.feed_name);
+            block.scenario_name = label_code(h.scenario_name);
+            block.min_timestamp = rows.empty() ? default_timestamp : std::numeric_limits<std::int64_t>::max();
+            block.max_timestamp = rows.empty() ? default_timestamp : std::numeric_limits<std::int64_t>::min();
+
+            std::vector<RunEntry> runs;
+            std::vector<double> values, sizes;
+            std::vector<std::uint32_t> deltas;
+            std::vector<std::uint16_t> sides, value_types, currencies, qualities, sources;
+            for (auto *column: {&values, &sizes}) column->reserve(rows.size());
+            for (auto *column: {&sides, &value_types, &currencies, &qualities, &sources}) column->reserve(rows.size());
+            deltas.reserve(rows.size());
+
+            constexpr auto kMaxDelta = static_cast<std::int64_t>(std::numeric_limits<std::uint32_t>::max());
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                const auto &row = rows[i];
+                if (runs.empty() || runs.back().instrument != row.instrument ||
+                    row.timestamp - runs.back().base_timestamp > kMaxDelta) {
+                    runs.push_back({row.instrument, 0, i, row.timestamp});
+                }
+                auto &run = runs.back();
+                ++run.row_count;
+                block.min_timestamp = std::min(block.min_timestamp, row.timestamp);
+                block.max_timestamp = std::max(block.max_timestamp, row.timestamp);
+
+                const auto &q = *row.quote;
+                values.push_back(q.value);
+                sizes.push_back(q.size ? *q.size : std::nan(""));
+                deltas.push_back(static_cast<std::uint32_t>(row.timestamp - run.base_timestamp));
+                sides.push_back(label_code(q.side));
+                value_types.push_back(label_code(q.value_type));
+                currencies.push_back(label_code(q.currency));
+                qualities.push_back(label_code(q.quality));
+                sources.push_back(label_code(q.source));
+            }
+            block.run_count = static_cast<std::uint32_t>(runs.size());
+
+            std::vector<binary::StringRef> dictionary;
+            std::string dictionary_chars;
+            append_dictionary(new_instruments_, dictionary, dictionary_chars);
+            append_dictionary(new_labels_, dictionary, dictionary_chars);
+            block.new_instrument_count = static_cast<std::uint32_t>(new_instruments_.size());
+            block.new_label_count = static_cast<std::uint32_t>(new_labels_.size());
+
+            ByteBuffer bytes;
+            bytes.append(&block, sizeof(block));
+            block.dictionary_offset = bytes.append_array(dictionary);
+            bytes.align(kAlignment);
+            block.dictionary_chars_offset = bytes.append(dictionary_chars.data(), dictionary_chars.size());
+            block.runs_offset = bytes.append_array(runs);
+            block.value_offset = bytes.append_array(values);
+            block.size_offset = bytes.append_array(sizes);
+            block.delta_offset = bytes.append_array(deltas);
+            block.side_offset = bytes.append_array(sides);
+            block.value_type_offset = bytes.append_array(value_types);
+            block.currency_offset = bytes.append_array(currencies);
+            block.quality_offset = bytes.append_array(qualities);
+            block.source_offset = bytes.append_array(sources);
+            bytes.align(kAlignment);
+            block.block_size = bytes.size();
+            bytes.patch(0, block);
+
+            out_.write(reinterpret_cast<const char *>(bytes.bytes().data()), static_cast<std::streamsize>(bytes.size()));
+            out_.flush();
+            if (!out_) {
+                throw std::runtime_error("QuoteHistoryWriter: write failed for " + path_);
+            }
+        } catch (...) {
+            // Codes handed out for this block never reached the file
+            for (const auto &id: new_instruments_) instruments_.erase(id);
+            for (const auto &label: new_labels_) labels_.erase(label);
+            throw;
+        }
+        ++block_count_;
+    }
+}
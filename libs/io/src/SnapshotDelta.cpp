@@ -0,0 +1,749 @@
+//
+// Created by Francisco Nunez on 06.02.2026.
+//
+
+#include "io/SnapshotDelta.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "time/date.hpp"
+
+namespace curve::io {
+    namespace {
+        // ---- diff ----
+
+        template<typename Record, typename IdOf>
+        std::unordered_map<std::string_view, const Record *> by_id(const std::vector<Record> &records, IdOf id_of) {
+            std::unordered_map<std::string_view, const Record *> index;
+            index.reserve(records.size());
+            for (const auto &r: records) index.emplace(id_of(r), &r);
+            return index;
+        }
+
+        bool same_structure(const YieldCurveRecord &a, const YieldCurveRecord &b) {
+            if (a.points.size() != b.points.size()) return false;
+            for (std::size_t i = 0; i < a.points.size(); ++i) {
+                if (a.points[i].tenor != b.points[i].tenor || a.points[i].maturity_date != b.points[i].maturity_date) {
+                    return false;
+                }
+            }
+            auto a_header = a, b_header = b;
+            a_header.points.clear();
+            b_header.points.clear();
+            return a_header == b_header;
+        }
+
+        bool same_structure(const VolSurfaceRecord &a, const VolSurfaceRecord &b) {
+            if (a.header != b.header || a.points.size() != b.points.size()) return false;
+            for (std::size_t i = 0; i < a.points.size(); ++i) {
+                if (a.points[i].expiry != b.points[i].expiry ||
+                    a.points[i].strike_coordinate != b.points[i].strike_coordinate) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        std::pair<std::string_view, std::string_view> key_of(const QuoteSetRecord &set) {
+            return {set.header.feed_name, set.header.scenario_name};
+        }
+
+        struct PairHash {
+            std::size_t operator()(const std::pair<std::string_view, std::string_view> &k) const {
+                const std::hash<std::string_view> h;
+                return h(k.first) * 31 + h(k.second);
+            }
+        };
+
+        std::optional<QuoteSetPatch> diff_quote_set(const QuoteSetRecord &base, const QuoteSetRecord &next) {
+            QuoteSetPatch patch;
+            patch.feed_name = next.header.feed_name;
+            patch.scenario_name = next.header.scenario_name;
+            if (base.header != next.header) patch.header = next.header;
+
+            const auto base_instruments = by_id(base.instruments, [](const auto &i) -> std::string_view {
+                return i.instrument_id;
+            });
+            std::unordered_set<std::string_view> seen;
+            for (const auto &instrument: next.instruments) {
+                seen.insert(instrument.instrument_id);
+                const auto it = base_instruments.find(instrument.instrument_id);
+                if (it == base_instruments.end() || it->second->quotes != instrument.quotes) {
+                    patch.upserted.push_back(instrument);
+                }
+            }
+            for (const auto &instrument: base.instruments) {
+                if (!seen.contains(instrument.instrument_id)) patch.removed.push_back(instrument.instrument_id);
+            }
+            if (!patch.header && patch.upserted.empty() && patch.removed.empty()) return std::nullopt;
+            return patch;
+        }
+
+        // ---- apply ----
+
+        [[noreturn]] void reject(const std::string &what) {
+            throw std::invalid_argument("apply_delta: " + what);
+        }
+
+        template<typename Record, typename IdOf>
+        std::unordered_map<std::string, std::size_t> positions(const std::vector<Record> &records, IdOf id_of) {
+            std::unordered_map<std::string, std::size_t> index;
+            index.reserve(records.size());
+            for (std::size_t i = 0; i < records.size(); ++i) index.emplace(id_of(records[i]), i);
+            return index;
+        }
+
+        template<typename Record, typename IdOf>
+        void erase_ids(std::vector<Record> &records, const std::vector<std::string> &ids, IdOf id_of) {
+            if (ids.empty()) return;
+            const std::unordered_set<std::string_view> removed(ids.begin(), ids.end());
+            std::erase_if(records, [&](const Record &r) { return removed.contains(id_of(r)); });
+        }
+
+        // Upserts resolve to positions before anything is appended; npos = append.
+        template<typename Record, typename IdOf>
+        std::vector<std::size_t> upsert_positions(const std::unordered_map<std::string, std::size_t> &index,
+                                                  const std::vector<Record> &upserts, IdOf id_of) {
+            std::vector<std::size_t> targets;
+            targets.reserve(upserts.size());
+            for (const auto &r: upserts) {
+                const auto it = index.find(std::string(id_of(r)));
+                targets.push_back(it == index.end() ? std::string::npos : it->second);
+            }
+            return targets;
+        }
+
+        template<typename Record>
+        void upsert(std::vector<Record> &records, const std::vector<Record> &upserts,
+                    const std::vector<std::size_t> &targets) {
+            for (std::size_t i = 0; i < upserts.size(); ++i) {
+                if (targets[i] == std::string::npos) {
+                    records.push_back(upserts[i]);
+                } else {
+                    records[targets[i]] = upserts[i];
+                }
+            }
+        }
+
+        const auto curve_id = [](const YieldCurveRecord &c) -> const std::string & { return c.curve_id; };
+        const auto underlying_id = [](const VolSurfaceRecord &s) -> const std::string & {
+            return s.header.underlying_id;
+        };
+        const auto instrument_id = [](const InstrumentQuoteRecord &i) -> const std::string & {
+            return i.instrument_id;
+        };
+
+        // ---- codec ----
+
+        constexpr char kDeltaMagic[8] = {'C', 'F', 'D', 'E', 'L', 'T', 'A', '\0'};
+        constexpr std::uint64_t kDeltaVersion = 1;
+
+        class Encoder {
+        public:
+            void u(std::uint64_t v) {
+                while (v >= 0x80) {
+                    byte(static_cast<std::uint8_t>(v) | 0x80);
+                    v >>= 7;
+                }
+                byte(static_cast<std::uint8_t>(v));
+            }
+
+            void i(std::int64_t v) { u((static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63)); }
+
+            void f(double v) {
+                const auto bits = std::bit_cast<std::uint64_t>(v);
+                for (int k = 0; k < 8; ++k) byte(static_cast<std::uint8_t>(bits >> (8 * k)));
+            }
+
+            void s(std::string_view v) {
+                u(v.size());
+                const auto *p = reinterpret_cast<const std::byte *>(v.data());
+                out_.insert(out_.end(), p, p + v.size());
+            }
+
+            void flag(bool v) { byte(v ? 1 : 0); }
+
+            void date(const time::Date &d) { i(time::to_serial(d)); }
+
+            void optional_date(const std::optional<time::Date> &d) {
+                flag(d.has_value());
+                if (d) date(*d);
+            }
+
+            void optional_instant(const std::optional<time::Instant> &t) {
+                flag(t.has_value());
+                if (t) i(std::chrono::duration_cast<std::chrono::milliseconds>(t->time_since_epoch()).count());
+            }
+
+            void optional_double(const std::optional<double> &v) {
+                flag(v.has_value());
+                if (v) f(*v);
+            }
+
+            template<typename T, typename Put>
+            void list(const std::vector<T> &values, Put put) {
+                u(values.size());
+                for (const auto &v: values) put(v);
+            }
+
+            void raw(const void *data, std::size_t n) {
+                const auto *p = static_cast<const std::byte *>(data);
+                out_.insert(out_.end(), p, p + n);
+            }
+
+            std::vector<std::byte> take() { return std::move(out_); }
+
+        private:
+            void byte(std::uint8_t b) { out_.push_back(static_cast<std::byte>(b)); }
+
+            std::vector<std::byte> out_;
+        };
+
+        class Decoder {
+        public:
+            explicit Decoder(std::span<const std::byte> bytes) : bytes_(bytes) {
+            }
+
+            std::uint64_t u() {
+                std::uint64_t v = 0;
+                for (int shift = 0; shift < 64; shift += 7) {
+                    const auto b = byte();
+                    v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+                    if ((b & 0x80) == 0) return v;
+                }
+                malformed("varint too long");
+            }
+
+            std::int64_t i() {
+                const auto v = u();
+                return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1);
+            }
+
+            double f() {
+                need(8);
+                std::uint64_t bits = 0;
+                for (int k = 0; k < 8; ++k) bits |= static_cast<std::uint64_t>(bytes_[pos_ + k]) << (8 * k);
+                pos_ += 8;
+                return std::bit_cast<double>(bits);
+            }
+
+            std::string s() {
+                const auto n = u();
+                need(n);
+                std::string v(reinterpret_cast<const char *>(bytes_.data() + pos_), n);
+                pos_ += n;
+                return v;
+            }
+
+            bool flag() {
+                const auto b = byte();
+                if (b > 1) malformed("bad flag");
+                return b == 1;
+            }
+
+            time::Date date() {
+                const auto serial = i();
+                if (serial < std::numeric_limits<std::int32_t>::min() || serial > std::numeric_limits<std::int32_t>::max()) {
+                    malformed("date out of range");
+                }
+                return time::from_serial(static_cast<std::int32_t>(serial));
+            }
+
+            std::optional<time::Date> optional_date() {
+                if (!flag()) return std::nullopt;
+                return date();
+            }
+
+            std::optional<time::Instant> optional_instant() {
+                if (!flag()) return std::nullopt;
+                return time::Instant{std::chrono::duration_cast<time::Instant::duration>(std::chrono::milliseconds{i()})};
+            }
+
+            std::optional<double> optional_double() {
+                if (!flag()) return std::nullopt;
+                return f();
+            }
+
+            template<typename Get>
+            auto list(Get get) {
+                const auto n = u();
+                // Every element takes at least one byte: rejects absurd counts before allocating
+                if (n > bytes_.size() - pos_) malformed("bad element count");
+                std::vector<decltype(get())> values;
+                values.reserve(n);
+                for (std::uint64_t k = 0; k < n; ++k) values.push_back(get());
+                return values;
+            }
+
+            void raw(void *data, std::size_t n) {
+                need(n);
+                std::memcpy(data, bytes_.data() + pos_, n);
+                pos_ += n;
+            }
+
+            [[nodiscard]] bool done() const { return pos_ == bytes_.size(); }
+
+            [[noreturn]] static void malformed(const char *what) {
+                throw std::runtime_error(std::string("SnapshotDeltaCodec: malformed delta: ") + what);
+            }
+
+        private:
+            std::uint8_t byte() {
+                need(1);
+                return static_cast<std::uint8_t>(bytes_[pos_++]);
+            }
+
+            void need(std::uint64_t n) const {
+                if (n > bytes_.size() - pos_) malformed("truncated");
+            }
+
+            std::span<const std::byte> bytes_;
+            std::size_t pos_ = 0;
+        };
+
+        void put(Encoder &e, const SnapshotHeaderRecord &h) {
+            e.date(h.as_of);
+            e.optional_instant(h.snapshot_time);
+            e.s(h.scenario_name);
+            e.s(h.source);
+            e.s(h.snapshot_id);
+        }
+
+        SnapshotHeaderRecord get_snapshot_header(Decoder &d) {
+            SnapshotHeaderRecord h;
+            h.as_of = d.date();
+            h.snapshot_time = d.optional_instant();
+            h.scenario_name = d.s();
+            h.source = d.s();
+            h.snapshot_id = d.s();
+            return h;
+        }
+
+        void put(Encoder &e, const YieldCurveRecord &c) {
+            for (const auto *field: {
+                     &c.curve_id, &c.currency, &c.curve_type, &c.day_count, &c.compounding, &c.interpolation,
+                     &c.reference_index, &c.calendar_name, &c.business_day_convention
+                 }) {
+                e.s(*field);
+            }
+            e.date(c.as_of);
+            e.list(c.points, [&](const YieldPointRecord &p) {
+                e.s(p.tenor);
+                e.optional_date(p.maturity_date);
+                e.f(p.value);
+            });
+        }
+
+        YieldCurveRecord get_curve(Decoder &d) {
+            YieldCurveRecord c;
+            for (auto *field: {
+                     &c.curve_id, &c.currency, &c.curve_type, &c.day_count, &c.compounding, &c.interpolation,
+                     &c.reference_index, &c.calendar_name, &c.business_day_convention
+                 }) {
+                *field = d.s();
+            }
+            c.as_of = d.date();
+            c.points = d.list([&] {
+                YieldPointRecord p;
+                p.tenor = d.s();
+                p.maturity_date = d.optional_date();
+                p.value = d.f();
+                return p;
+            });
+            return c;
+        }
+
+        void put(Encoder &e, const VolSurfaceRecord &s) {
+            const auto &h = s.header;
+            for (const auto *field: {
+                     &h.underlying_id, &h.quote_type, &h.strike_dimension, &h.strike_unit, &h.expiry_interpolation,
+                     &h.strike_interpolation
+                 }) {
+                e.s(*field);
+            }
+            e.date(h.as_of);
+            e.list(s.points, [&](const VolPointRecord &p) {
+                e.s(p.expiry);
+                e.f(p.strike_coordinate);
+                e.f(p.volatility);
+                e.optional_double(p.forward);
+                e.optional_double(p.total_variance);
+            });
+        }
+
+        VolSurfaceRecord get_surface(Decoder &d) {
+            VolSurfaceRecord s;
+            auto &h = s.header;
+            for (auto *field: {
+                     &h.underlying_id, &h.quote_type, &h.strike_dimension, &h.strike_unit, &h.expiry_interpolation,
+                     &h.strike_interpolation
+                 }) {
+                *field = d.s();
+            }
+            h.as_of = d.date();
+            s.points = d.list([&] {
+                VolPointRecord p;
+                p.expiry = d.s();
+                p.strike_coordinate = d.f();
+                p.volatility = d.f();
+                p.forward = d.optional_double();
+                p.total_variance = d.optional_double();
+                return p;
+            });
+            return s;
+        }
+
+        void put(Encoder &e, const InstrumentQuoteRecord &instrument) {
+            e.s(instrument.instrument_id);
+            e.list(instrument.quotes, [&](const QuoteRecord &q) {
+                e.f(q.value);
+                e.s(q.side);
+                e.s(q.value_type);
+                e.s(q.currency);
+                e.optional_double(q.size);
+                e.optional_instant(q.timestamp);
+                e.s(q.quality);
+                e.s(q.source);
+            });
+        }
+
+        InstrumentQuoteRecord get_instrument(Decoder &d) {
+            InstrumentQuoteRecord instrument;
+            instrument.instrument_id = d.s();
+            instrument.quotes = d.list([&] {
+                QuoteRecord q;
+                q.value = d.f();
+                q.side = d.s();
+                q.value_type = d.s();
+                q.currency = d.s();
+                q.size = d.optional_double();
+                q.timestamp = d.optional_instant();
+                q.quality = d.s();
+                q.source = d.s();
+                return q;
+            });
+            return instrument;
+        }
+
+        void put(Encoder &e, const QuoteSetHeaderRecord &h) {
+            e.date(h.as_of);
+            e.optional_instant(h.snapshot_time);
+            e.s(h.feed_name);
+            e.s(h.scenario_name);
+        }
+
+        QuoteSetHeaderRecord get_quote_set_header(Decoder &d) {
+            QuoteSetHeaderRecord h;
+            h.as_of = d.date();
+            h.snapshot_time = d.optional_instant();
+            h.feed_name = d.s();
+            h.scenario_name = d.s();
+            return h;
+        }
+
+        std::uint32_t get_index(Decoder &d) {
+            const auto v = d.u();
+            if (v > std::numeric_limits<std::uint32_t>::max()) Decoder::malformed("point index");
+            return static_cast<std::uint32_t>(v);
+        }
+    }
+
+    bool SnapshotDelta::empty() const {
+        return upserted_curves.empty() && curve_patches.empty() && removed_curves.empty() &&
+               upserted_surfaces.empty() && surface_patches.empty() && removed_surfaces.empty() &&
+               added_quote_sets.empty() && quote_set_patches.empty() && removed_quote_sets.empty();
+    }
+
+    SnapshotDelta diff_snapshots(const SnapshotData &base, const SnapshotData &next) {
+        SnapshotDelta delta;
+        delta.base_snapshot_id = base.header.snapshot_id;
+        delta.header = next.header;
+
+        // Yield curves
+        const auto base_curves = by_id(base.yield_curves, [](const auto &c) -> std::string_view { return c.curve_id; });
+        std::unordered_set<std::string_view> seen;
+        for (const auto &curve: next.yield_curves) {
+            seen.insert(curve.curve_id);
+            const auto it = base_curves.find(curve.curve_id);
+            if (it == base_curves.end() || !same_structure(*it->second, curve)) {
+                delta.upserted_curves.push_back(curve);
+                continue;
+            }
+            YieldCurvePatch patch{curve.curve_id, {}};
+            for (std::size_t i = 0; i < curve.points.size(); ++i) {
+                if (curve.points[i].value != it->second->points[i].value) {
+                    patch.points.push_back({static_cast<std::uint32_t>(i), curve.points[i].value});
+                }
+            }
+            if (!patch.points.empty()) delta.curve_patches.push_back(std::move(patch));
+        }
+        for (const auto &curve: base.yield_curves) {
+            if (!seen.contains(curve.curve_id)) delta.removed_curves.push_back(curve.curve_id);
+        }
+
+        // Vol surfaces
+        const auto base_surfaces = by_id(base.vol_surfaces, [](const auto &s) -> std::string_view {
+            return s.header.underlying_id;
+        });
+        seen.clear();
+        for (const auto &surface: next.vol_surfaces) {
+            seen.insert(surface.header.underlying_id);
+            const auto it = base_surfaces.find(surface.header.underlying_id);
+            if (it == base_surfaces.end() || !same_structure(*it->second, surface)) {
+                delta.upserted_surfaces.push_back(surface);
+                continue;
+            }
+            VolSurfacePatch patch{surface.header.underlying_id, {}};
+            for (std::size_t i = 0; i < surface.points.size(); ++i) {
+                const auto &p = surface.points[i];
+                if (p != it->second->points[i]) {
+                    patch.points.push_back({static_cast<std::uint32_t>(i), p.volatility, p.forward, p.total_variance});
+                }
+            }
+            if (!patch.points.empty()) delta.surface_patches.push_back(std::move(patch));
+        }
+        for (const auto &surface: base.vol_surfaces) {
+            if (!seen.contains(surface.header.underlying_id)) {
+                delta.removed_surfaces.push_back(surface.header.underlying_id);
+            }
+        }
+
+        // Quote sets
+        std::unordered_map<std::pair<std::string_view, std::string_view>, const QuoteSetRecord *, PairHash> base_sets;
+        for (const auto &set: base.quote_sets) base_sets.emplace(key_of(set), &set);
+        std::unordered_set<std::pair<std::string_view, std::string_view>, PairHash> seen_sets;
+        for (const auto &set: next.quote_sets) {
+            seen_sets.insert(key_of(set));
+            const auto it = base_sets.find(key_of(set));
+            if (it == base_sets.end()) {
+                delta.added_quote_sets.push_back(set);
+            } else if (auto patch = diff_quote_set(*it->second, set)) {
+                delta.quote_set_patches.push_back(std::move(*patch));
+            }
+        }
+        for (const auto &set: base.quote_sets) {
+            if (!seen_sets.contains(key_of(set))) {
+                delta.removed_quote_sets.emplace_back(set.header.feed_name, set.header.scenario_name);
+            }
+        }
+        return delta;
+    }
+
+    void apply_delta(SnapshotData &snapshot, const SnapshotDelta &delta) {
+        if (!delta.base_snapshot_id.empty() && !snapshot.header.snapshot_id.empty() &&
+            delta.base_snapshot_id != snapshot.header.snapshot_id) {
+            reject("delta is based on snapshot '" + delta.base_snapshot_id + "', not '" +
+                   snapshot.header.snapshot_id + "'");
+        }
+
+        // Validate everything first so a bad delta leaves the snapshot untouched
+        const auto curve_index = positions(snapshot.yield_curves, curve_id);
+        const auto surface_index = positions(snapshot.vol_surfaces, underlying_id);
+        std::map<std::pair<std::string, std::string>, std::size_t> set_index;
+        for (std::size_t i = 0; i < snapshot.quote_sets.size(); ++i) {
+            const auto &h = snapshot.quote_sets[i].header;
+            set_index.emplace(std::pair{h.feed_name, h.scenario_name}, i);
+        }
+        const auto find = [](const auto &index, const auto &key, const std::string &what) {
+            const auto it = index.find(key);
+            if (it == index.end()) reject("unknown " + what);
+            return it->second;
+        };
+
+        std::vector<std::size_t> curve_targets, surface_targets, set_targets;
+        for (const auto &patch: delta.curve_patches) {
+            const auto i = find(curve_index, patch.curve_id, "yield curve " + patch.curve_id);
+            for (const auto &p: patch.points) {
+                if (p.index >= snapshot.yield_curves[i].points.size()) reject("point index in " + patch.curve_id);
+            }
+            curve_targets.push_back(i);
+        }
+        for (const auto &patch: delta.surface_patches) {
+            const auto i = find(surface_index, patch.underlying_id, "vol surface " + patch.underlying_id);
+            for (const auto &p: patch.points) {
+                if (p.index >= snapshot.vol_surfaces[i].points.size()) reject("point index in " + patch.underlying_id);
+            }
+            surface_targets.push_back(i);
+        }
+        for (const auto &id: delta.removed_curves) find(curve_index, id, "yield curve " + id);
+        for (const auto &id: delta.removed_surfaces) find(surface_index, id, "vol surface " + id);
+
+        std::vector<std::unordered_map<std::string, std::size_t> > instrument_indices;
+        for (const auto &patch: delta.quote_set_patches) {
+            const auto i = find(set_index, std::pair{patch.feed_name, patch.scenario_name},
+                                "quote set " + patch.feed_name + "/" + patch.scenario_name);
+            auto instruments = positions(snapshot.quote_sets[i].instruments, instrument_id);
+            for (const auto &id: patch.removed) find(instruments, id, "instrument " + id);
+            instrument_indices.push_back(std::move(instruments));
+            set_targets.push_back(i);
+        }
+        for (const auto &[feed, scenario]: delta.removed_quote_sets) {
+            find(set_index, std::pair{feed, scenario}, "quote set " + feed + "/" + scenario);
+        }
+        for (const auto &set: delta.added_quote_sets) {
+            if (set_index.contains({set.header.feed_name, set.header.scenario_name})) {
+                reject("quote set " + set.header.feed_name + "/" + set.header.scenario_name + " already exists");
+            }
+        }
+        const auto curve_upserts = upsert_positions(curve_index, delta.upserted_curves, curve_id);
+        const auto surface_upserts = upsert_positions(surface_index, delta.upserted_surfaces, underlying_id);
+
+        // Patch in place
+        for (std::size_t k = 0; k < delta.curve_patches.size(); ++k) {
+            auto &points = snapshot.yield_curves[curve_targets[k]].points;
+            for (const auto &p: delta.curve_patches[k].points) points[p.index].value = p.value;
+        }
+        for (std::size_t k = 0; k < delta.surface_patches.size(); ++k) {
+            auto &points = snapshot.vol_surfaces[surface_targets[k]].points;
+            for (const auto &p: delta.surface_patches[k].points) {
+                points[p.index].volatility = p.volatility;
+                points[p.index].forward = p.forward;
+                points[p.index].total_variance = p.total_variance;
+            }
+        }
+        for (std::size_t k = 0; k < delta.quote_set_patches.size(); ++k) {
+            const auto &patch = delta.quote_set_patches[k];
+            auto &set = snapshot.quote_sets[set_targets[k]];
+            if (patch.header) set.header = *patch.header;
+            upsert(set.instruments, patch.upserted, upsert_positions(instrument_indices[k], patch.upserted,
+                                                                     instrument_id));
+            erase_ids(set.instruments, patch.removed, instrument_id);
+        }
+
+        upsert(snapshot.yield_curves, delta.upserted_curves, curve_upserts);
+        upsert(snapshot.vol_surfaces, delta.upserted_surfaces, surface_upserts);
+        erase_ids(snapshot.yield_curves, delta.removed_curves, curve_id);
+        erase_ids(snapshot.vol_surfaces, delta.removed_surfaces, underlying_id);
+
+        if (!delta.removed_quote_sets.empty()) {
+            std::erase_if(snapshot.quote_sets, [&](const QuoteSetRecord &set) {
+                return std::find(delta.removed_quote_sets.begin(), delta.removed_quote_sets.end(),
+                                 std::pair{set.header.feed_name, set.header.scenario_name}) !=
+                       delta.removed_quote_sets.end();
+            });
+        }
+        snapshot.quote_sets.insert(snapshot.quote_sets.end(), delta.added_quote_sets.begin(),
+                                   delta.added_quote_sets.end());
+        snapshot.header = delta.header;
+    }
+
+    std::vector<std::byte> SnapshotDeltaCodec::encode(const SnapshotDelta &delta) {
+        Encoder e;
+        e.raw(kDeltaMagic, sizeof(kDeltaMagic));
+        e.u(kDeltaVersion);
+        e.s(delta.base_snapshot_id);
+        put(e, delta.header);
+
+        e.list(delta.upserted_curves, [&](const YieldCurveRecord &c) { put(e, c); });
+        e.list(delta.curve_patches, [&](const YieldCurvePatch &patch) {
+            e.s(patch.curve_id);
+            e.list(patch.points, [&](const YieldPointUpdate &p) {
+                e.u(p.index);
+                e.f(p.value);
+            });
+        });
+        e.list(delta.removed_curves, [&](const std::string &id) { e.s(id); });
+
+        e.list(delta.upserted_surfaces, [&](const VolSurfaceRecord &s) { put(e, s); });
+        e.list(delta.surface_patches, [&](const VolSurfacePatch &patch) {
+            e.s(patch.underlying_id);
+            e.list(patch.points, [&](const VolPointUpdate &p) {
+                e.u(p.index);
+                e.f(p.volatility);
+                e.optional_double(p.forward);
+                e.optional_double(p.total_variance);
+            });
+        });
+        e.list(delta.removed_surfaces, [&](const std::string &id) { e.s(id); });
+
+        e.list(delta.added_quote_sets, [&](const QuoteSetRecord &set) {
+            put(e, set.header);
+            e.list(set.instruments, [&](const InstrumentQuoteRecord &i) { put(e, i); });
+        });
+        e.list(delta.quote_set_patches, [&](const QuoteSetPatch &patch) {
+            e.s(patch.feed_name);
+            e.s(patch.scenario_name);
+            e.flag(patch.header.has_value());
+            if (patch.header) put(e, *patch.header);
+            e.list(patch.upserted, [&](const InstrumentQuoteRecord &i) { put(e, i); });
+            e.list(patch.removed, [&](const std::string &id) { e.s(id); });
+        });
+        e.list(delta.removed_quote_sets, [&](const std::pair<std::string, std::string> &key) {
+            e.s(key.first);
+            e.s(key.second);
+        });
+        return e.take();
+    }
+
+    SnapshotDelta SnapshotDeltaCodec::decode(std::span<const std::byte> bytes) {
+        Decoder d(bytes);
+        char magic[sizeof(kDeltaMagic)];
+        d.raw(magic, sizeof(magic));
+        if (std::memcmp(magic, kDeltaMagic, sizeof(kDeltaMagic)) != 0) Decoder::malformed("bad magic");
+        if (d.u() != kDeltaVersion) Decoder::malformed("unsupported version");
+
+        SnapshotDelta delta;
+        delta.base_snapshot_id = d.s();
+        delta.header = get_snapshot_header(d);
+
+        delta.upserted_curves = d.list([&] { return get_curve(d); });
+        delta.curve_patches = d.list([&] {
+            YieldCurvePatch patch;
+            patch.curve_id = d.s();
+            patch.points = d.list([&] {
+                YieldPointUpdate p;
+                p.index = get_index(d);
+                p.value = d.f();
+                return p;
+            });
+            return patch;
+        });
+        delta.removed_curves = d.list([&] { return d.s(); });
+
+        delta.upserted_surfaces = d.list([&] { return get_surface(d); });
+        delta.surface_patches = d.list([&] {
+            VolSurfacePatch patch;
+            patch.underlying_id = d.s();
+            patch.points = d.list([&] {
+                VolPointUpdate p;
+                p.index = get_index(d);
+                p.volatility = d.f();
+                p.forward = d.optional_double();
+                p.total_variance = d.optional_double();
+                return p;
+            });
+            return patch;
+        });
+        delta.removed_surfaces = d.list([&] { return d.s(); });
+
+        delta.added_quote_sets = d.list([&] {
+            QuoteSetRecord set;
+            set.header = get_quote_set_header(d);
+            set.instruments = d.list([&] { return get_instrument(d); });
+            return set;
+        });
+        delta.quote_set_patches = d.list([&] {
+            QuoteSetPatch patch;
+            patch.feed_name = d.s();
+            patch.scenario_name = d.s();
+            if (d.flag()) patch.header = get_quote_set_header(d);
+            patch.upserted = d.list([&] { return get_instrument(d); });
+            patch.removed = d.list([&] { return d.s(); });
+            return patch;
+        });
+        delta.removed_quote_sets = d.list([&] {
+            auto feed = d.s();
+            return std::pair{std::move(feed), d.s()};
+        });
+        if (!d.done()) Decoder::malformed("trailing bytes");
+        return delta;
+    }
+}
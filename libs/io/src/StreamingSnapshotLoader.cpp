@@ -0,0 +1,78 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#include "io/StreamingSnapshotLoader.h"
+#include "io/SurfaceBuilder.h"
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "tasks/TaskGroup.h"
+
+namespace curve::io {
+    namespace {
+        struct PendingSurface {
+            std::string underlying_id;
+            std::shared_ptr<volatility::ImpliedVolSurface> surface;
+        };
+
+        template<typename Parse>
+        StreamingSnapshotLoader::Result load(const MarketDataCallbacks &quote_callbacks, Parse &&parse) {
+            StreamingSnapshotLoader::Result result;
+            // A deque: tasks write into their element while later surfaces are appended
+            std::deque<PendingSurface> pending;
+            tasks::TaskGroup builds;
+            std::vector<VolPointRecord> points;
+
+            MarketDataCallbacks callbacks = quote_callbacks;
+            callbacks.on_header = [&](const SnapshotHeaderRecord &header) {
+                result.header = header;
+                if (quote_callbacks.on_header) quote_callbacks.on_header(header);
+            };
+            callbacks.on_yield_curve = [&](YieldCurveRecord &&curve) {
+                result.yield_curves.push_back(std::move(curve));
+            };
+            callbacks.on_vol_surface_begin = [&](const VolSurfaceHeaderRecord &) {
+                points.clear();
+            };
+            callbacks.on_vol_point = [&](const VolSurfaceHeaderRecord &, const VolPointRecord &point) {
+                points.push_back(point);
+            };
+            callbacks.on_vol_surface_end = [&](const VolSurfaceHeaderRecord &header) {
+                // Hand the points over to a task and keep parsing.
+                auto &slot = pending.emplace_back(PendingSurface{header.underlying_id, nullptr});
+                builds.run([&slot, header, surface_points = std::move(points)] {
+                    slot.surface = build_vol_surface(header, surface_points);
+                });
+                points = {};
+            };
+
+            try {
+                MarketDataSaxReader reader(std::move(callbacks));
+                parse(reader);
+            } catch (...) {
+                // The group's destructor waits for builds already running
+                builds.cancel();
+                throw;
+            }
+
+            builds.wait();
+            for (auto &p: pending) {
+                result.vol_surfaces[p.underlying_id] = std::move(p.surface);
+            }
+            return result;
+        }
+    }
+
+    StreamingSnapshotLoader::Result StreamingSnapshotLoader::load_file(const std::string &path,
+                                                                       const MarketDataCallbacks &quote_callbacks) {
+        return load(quote_callbacks, [&](MarketDataSaxReader &reader) { reader.parse_file(path); });
+    }
+
+    StreamingSnapshotLoader::Result StreamingSnapshotLoader::load_buffer(const char *data, std::size_t size,
+                                                                         const MarketDataCallbacks &quote_callbacks) {
+        return load(quote_callbacks, [&](MarketDataSaxReader &reader) { reader.parse_buffer(data, size); });
+    }
+}
@@ -0,0 +1,51 @@
+//
+// Created by Francisco Nunez on 02.02.2026.
+//
+
+#include "io/SurfaceBuilder.h"
+
+namespace curve::io {
+    using volatility::ImpliedVolSurface;
+
+    ImpliedVolSurface::SurfaceType surface_type_of(const VolSurfaceHeaderRecord &header) {
+        if (header.strike_dimension == "ABSOLUTE_STRIKE") {
+            return ImpliedVolSurface::SurfaceType::STRIKE_SPACE;
+        }
+        return ImpliedVolSurface::SurfaceType::LOG_MONEYNESS_SPACE;
+    }
+
+    ImpliedVolSurface::InterpolationMethod interpolation_of(const VolSurfaceHeaderRecord &header) {
+        if (header.strike_interpolation == "CUBIC_SPLINE" || header.strike_interpolation == "BICUBIC") {
+            return ImpliedVolSurface::InterpolationMethod::BICUBIC_SPLINE;
+        }
+        return ImpliedVolSurface::InterpolationMethod::BILINEAR;
+    }
+
+    std::shared_ptr<ImpliedVolSurface> build_vol_surface(const VolSurfaceHeaderRecord &header,
+                                                         const std::vector<VolPointRecord> &points) {
+        std::vector<volatility::VolPoint> vol_points;
+        vol_points.reserve(points.size());
+        for (const auto &p: points) {
+            vol_points.emplace_back(p.strike_coordinate, ImpliedVolSurface::expiry_to_years(p.expiry), p.volatility,
+                                    p.strike_coordinate);
+        }
+        auto surface = std::make_shared<ImpliedVolSurface>(surface_type_of(header), interpolation_of(header));
+        surface->import_from_points(std::move(vol_points));
+        return surface;
+    }
+
+    std::shared_ptr<ImpliedVolSurface> build_vol_surface(const VolSurfaceView &view) {
+        const auto expiry_years = view.expiry_years();
+        const auto strikes = view.strikes();
+        const auto vols = view.volatilities();
+        std::vector<volatility::VolPoint> vol_points;
+        vol_points.reserve(view.size());
+        for (std::size_t i = 0; i < view.size(); ++i) {
+            vol_points.emplace_back(strikes[i], expiry_years[i], vols[i], strikes[i]);
+        }
+        const auto header = view.header_record();
+        auto surface = std::make_shared<ImpliedVolSurface>(surface_type_of(header), interpolation_of(header));
+        surface->import_from_points(std::move(vol_points));
+        return surface;
+    }
+}
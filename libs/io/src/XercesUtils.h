@@ -0,0 +1,38 @@
+//
+// Created by Francisco Nunez on 04.02.2026.
+//
+
+#ifndef CURVEFORGE_IO_XERCESUTILS_H
+#define CURVEFORGE_IO_XERCESUTILS_H
+
+#include <string>
+
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/util/XercesDefs.hpp>
+
+namespace curve::io::detail {
+    // Element and attribute names in our schemas are ASCII, so narrowing is enough (and
+    // allocation-free for the short names thanks to SSO).
+    inline void narrow(const XMLCh *s, std::string &out) {
+        out.clear();
+        for (; *s; ++s) out.push_back(static_cast<char>(*s));
+    }
+
+    inline std::string to_string(const XMLCh *s) {
+        std::string out;
+        narrow(s, out);
+        return out;
+    }
+
+    // Scoped XMLPlatformUtils::Initialize/Terminate (reference counted by Xerces).
+    struct XercesSession {
+        XercesSession() { xercesc::XMLPlatformUtils::Initialize(); }
+        ~XercesSession() { xercesc::XMLPlatformUtils::Terminate(); }
+
+        XercesSession(const XercesSession &) = delete;
+
+        XercesSession &operator=(const XercesSession &) = delete;
+    };
+}
+
+#endif //CURVEFORGE_IO_XERCESUTILS_H
@@ -0,0 +1,263 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "io/XmlWriters.h"
+
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+
+#include "io/ParseUtils.h"
+
+namespace curve::io {
+    namespace {
+        void append_escaped(std::string &out, std::string_view s) {
+            for (const char c: s) {
+                switch (c) {
+                    case '&': out += "&amp;";
+                        break;
+                    case '<': out += "&lt;";
+                        break;
+                    case '>': out += "&gt;";
+                        break;
+                    case '"': out += "&quot;";
+                        break;
+                    default: out += c;
+                }
+            }
+        }
+
+        void append_double(std::string &out, double v) {
+            char buf[32];
+            const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), v);
+            out.append(buf, end);
+        }
+
+        // <tag>value</tag> with `tag` already carrying its prefix
+        void element(std::string &out, std::string_view tag, std::string_view value) {
+            out += '<';
+            out += tag;
+            out += '>';
+            append_escaped(out, value);
+            out += "</";
+            out += tag;
+            out += '>';
+        }
+
+        void element(std::string &out, std::string_view tag, double value) {
+            out += '<';
+            out += tag;
+            out += '>';
+            append_double(out, value);
+            out += "</";
+            out += tag;
+            out += '>';
+        }
+
+        // Optional schema elements are skipped when empty
+        void optional_element(std::string &out, std::string_view tag, std::string_view value) {
+            if (!value.empty()) element(out, tag, value);
+        }
+
+        void write_header(std::string &out, const SnapshotHeaderRecord &h) {
+            out += "  <md:header>";
+            element(out, "md:asOf", format_date(h.as_of));
+            if (h.snapshot_time) element(out, "md:snapshotTime", format_date_time(*h.snapshot_time));
+            optional_element(out, "md:scenarioName", h.scenario_name);
+            optional_element(out, "md:source", h.source);
+            optional_element(out, "md:snapshotId", h.snapshot_id);
+            out += "</md:header>\n";
+        }
+
+        void write_curve(std::string &out, const YieldCurveRecord &c) {
+            out += "    <md:yieldCurve>\n      <y:header>";
+            element(out, "y:curveId", c.curve_id);
+            element(out, "y:currency", c.currency);
+            element(out, "y:asOf", format_date(c.as_of));
+            element(out, "y:curveType", c.curve_type);
+            element(out, "y:dayCount", c.day_count);
+            element(out, "y:compounding", c.compounding);
+            optional_element(out, "y:interpolation", c.interpolation);
+            optional_element(out, "y:referenceIndex", c.reference_index);
+            optional_element(out, "y:calendarName", c.calendar_name);
+            optional_element(out, "y:businessDayConvention", c.business_day_convention);
+            out += "</y:header>\n      <y:points>\n";
+            for (const auto &p: c.points) {
+                out += "        <y:point>";
+                element(out, "y:tenor", p.tenor);
+                if (p.maturity_date) element(out, "y:maturityDate", format_date(*p.maturity_date));
+                element(out, "y:curveValue", p.value);
+                out += "</y:point>\n";
+            }
+            out += "      </y:points>\n    </md:yieldCurve>\n";
+        }
+
+        void write_surface(std::string &out, const VolSurfaceRecord &s) {
+            const auto &h = s.header;
+            out += "    <md:volSurface>\n      <v:header>";
+            element(out, "v:underlyingId", h.underlying_id);
+            element(out, "v:asOf", format_date(h.as_of));
+            element(out, "v:quoteType", h.quote_type);
+            element(out, "v:strikeDimension", h.strike_dimension);
+            optional_element(out, "v:strikeUnit", h.strike_unit);
+            optional_element(out, "v:expiryInterpolation", h.expiry_interpolation);
+            optional_element(out, "v:strikeInterpolation", h.strike_interpolation);
+            out += "</v:header>\n      <v:points>\n";
+            for (const auto &p: s.points) {
+                out += "        <v:point>";
+                element(out, "v:expiry", p.expiry);
+                element(out, "v:strikeCoordinate", p.strike_coordinate);
+                element(out, "v:volatility", p.volatility);
+                if (p.forward) element(out, "v:forward", *p.forward);
+                if (p.total_variance) element(out, "v:totalVariance", *p.total_variance);
+                out += "</v:point>\n";
+            }
+            out += "      </v:points>\n    </md:volSurface>\n";
+        }
+
+        void write_quote_set(std::string &out, const QuoteSetRecord &qs) {
+            const auto &h = qs.header;
+            out += "    <md:quoteSet>\n      ";
+            element(out, "q:asOf", format_date(h.as_of));
+            if (h.snapshot_time) element(out, "q:snapshotTime", format_date_time(*h.snapshot_time));
+            optional_element(out, "q:feedName", h.feed_name);
+            optional_element(out, "q:scenarioName", h.scenario_name);
+            out += "\n      <q:instruments>\n";
+            for (const auto &instrument: qs.instruments) {
+                out += "        <q:instrumentQuote>";
+                element(out, "q:instrumentId", instrument.instrument_id);
+                out += "<q:quotes>\n";
+                for (const auto &q: instrument.quotes) {
+                    out += "          <q:quote>";
+                    element(out, "q:value", q.value);
+                    element(out, "q:side", q.side);
+                    element(out, "q:valueType", q.value_type);
+                    optional_element(out, "q:currency", q.currency);
+                    if (q.size) element(out, "q:size", *q.size);
+                    if (q.timestamp) element(out, "q:timestamp", format_date_time(*q.timestamp));
+                    optional_element(out, "q:quality", q.quality);
+                    optional_element(out, "q:source", q.source);
+                    out += "</q:quote>\n";
+                }
+                out += "        </q:quotes></q:instrumentQuote>\n";
+            }
+            out += "      </q:instruments>\n    </md:quoteSet>\n";
+        }
+
+        // Flushes the staging buffer once it is large enough
+        void drain(std::ostream &out, std::string &buffer, std::size_t threshold = 1 << 16) {
+            if (buffer.size() < threshold) return;
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+
+        std::ofstream open_output(const std::string &path) {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) throw std::runtime_error("cannot open " + path + " for writing");
+            return out;
+        }
+    }
+
+    void MarketDataXmlWriter::write(std::ostream &out, const SnapshotData &data) {
+        std::string buffer = R"(<?xml version="1.0" encoding="UTF-8"?>
+<md:MarketDataSnapshot xmlns:md="http://curveforge.com/marketdata" xmlns:y="http://curveforge.com/yield"
+                       xmlns:v="http://curveforge.com/vol" xmlns:q="http://curveforge.com/quotes">
+)";
+        write_header(buffer, data.header);
+        if (!data.yield_curves.empty()) {
+            buffer += "  <md:yieldCurves>\n";
+            for (const auto &c: data.yield_curves) {
+                write_curve(buffer, c);
+                drain(out, buffer);
+            }
+            buffer += "  </md:yieldCurves>\n";
+        }
+        if (!data.vol_surfaces.empty()) {
+            buffer += "  <md:volSurfaces>\n";
+            for (const auto &s: data.vol_surfaces) {
+                write_surface(buffer, s);
+                drain(out, buffer);
+            }
+            buffer += "  </md:volSurfaces>\n";
+        }
+        if (!data.quote_sets.empty()) {
+            buffer += "  <md:quoteSets>\n";
+            for (const auto &qs: data.quote_sets) {
+                write_quote_set(buffer, qs);
+                drain(out, buffer);
+            }
+            buffer += "  </md:quoteSets>\n";
+        }
+        buffer += "</md:MarketDataSnapshot>\n";
+        drain(out, buffer, 0);
+    }
+
+    void MarketDataXmlWriter::write_file(const SnapshotData &data, const std::string &path) {
+        auto out = open_output(path);
+        write(out, data);
+        if (!out.flush()) throw std::runtime_error("failed writing " + path);
+    }
+
+    PortfolioXmlWriter::PortfolioXmlWriter(std::ostream &out, std::string_view name, std::string_view key)
+        : out_(out) {
+        buffer_ = R"(<?xml version="1.0" encoding="UTF-8"?>
+<p:Portfolio xmlns:p="http://curveforge.com/portfolio" xmlns:i="http://curveforge.com/instruments"
+             xmlns:c="http://curveforge.com/commons" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance">
+  )";
+        element(buffer_, "p:name", name);
+        element(buffer_, "p:key", key);
+        buffer_ += '\n';
+    }
+
+    PortfolioXmlWriter::~PortfolioXmlWriter() {
+        try {
+            finish();
+        } catch (...) {
+        }
+    }
+
+    void PortfolioXmlWriter::add(const TradeRecord &trade) {
+        if (finished_) throw std::logic_error("PortfolioXmlWriter: add() after finish()");
+        if (trade.type != "IRSwap") {
+            throw std::invalid_argument("PortfolioXmlWriter: cannot write instrument type '" + trade.type + "'");
+        }
+        buffer_ += "  <p:Instrument xsi:type=\"i:IRSwap\">\n    ";
+        element(buffer_, "i:name", trade.name);
+        element(buffer_, "i:assetClass", trade.asset_class);
+        element(buffer_, "i:id", trade.id);
+        buffer_ += "\n    ";
+        element(buffer_, "i:notional", trade.notional);
+        element(buffer_, "i:fixedRate", trade.fixed_rate);
+        element(buffer_, "i:floatIndex", trade.float_index);
+        element(buffer_, "i:floatTenor", trade.float_tenor);
+        element(buffer_, "i:payFixed", trade.pay_fixed ? "true" : "false");
+        element(buffer_, "i:currency", trade.currency);
+        buffer_ += "\n    <i:cashflows>";
+        for (const auto &cf: trade.cashflows) {
+            buffer_ += "<c:cashflow>";
+            element(buffer_, "c:date", format_date(cf.date));
+            element(buffer_, "c:amount", cf.amount);
+            buffer_ += "</c:cashflow>";
+        }
+        buffer_ += "</i:cashflows>\n  </p:Instrument>\n";
+        ++trades_;
+        drain(out_, buffer_);
+    }
+
+    void PortfolioXmlWriter::finish() {
+        if (finished_) return;
+        finished_ = true;
+        buffer_ += "</p:Portfolio>\n";
+        drain(out_, buffer_, 0);
+    }
+
+    void PortfolioXmlWriter::write_file(std::string_view name, std::string_view key,
+                                        const std::vector<TradeRecord> &trades, const std::string &path) {
+        auto out = open_output(path);
+        PortfolioXmlWriter writer(out, name, key);
+        for (const auto &trade: trades) writer.add(trade);
+        writer.finish();
+        if (!out.flush()) throw std::runtime_error("failed writing " + path);
+    }
+}
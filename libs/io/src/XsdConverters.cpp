@@ -0,0 +1,137 @@
+//
+// Created by Francisco Nunez on 03.02.2026.
+//
+
+#include "io/XsdConverters.h"
+
+#include <cmath>
+
+namespace curve::io {
+    namespace {
+        template<typename Optional>
+        std::string string_or_empty(const Optional &o) {
+            return o.present() ? std::string(o.get()) : std::string();
+        }
+    }
+
+    time::Date to_date(const xml_schema::date &d) {
+        return time::Date{
+            std::chrono::year{d.year()}, std::chrono::month{static_cast<unsigned>(d.month())},
+            std::chrono::day{static_cast<unsigned>(d.day())}
+        };
+    }
+
+    time::Instant to_instant(const xml_schema::date_time &t) {
+        using namespace std::chrono;
+        const sys_days day{
+            year{t.year()} / month{static_cast<unsigned>(t.month())} / std::chrono::day{static_cast<unsigned>(t.day())}
+        };
+        auto instant = time::Instant{day} + hours{t.hours()} + minutes{t.minutes()} +
+                       duration_cast<time::Instant::duration>(milliseconds{std::llround(t.seconds() * 1000.0)});
+        if (t.zone_present()) {
+            instant -= hours{t.zone_hours()} + minutes{t.zone_minutes()};
+        }
+        return instant;
+    }
+
+    YieldCurveRecord to_record(const yield::YieldCurve &curve) {
+        const auto &h = curve.header();
+        YieldCurveRecord r;
+        r.curve_id = h.curveId();
+        r.currency = h.currency();
+        r.as_of = to_date(h.asOf());
+        r.curve_type = h.curveType();
+        r.day_count = h.dayCount();
+        r.compounding = h.compounding();
+        r.interpolation = string_or_empty(h.interpolation());
+        r.reference_index = string_or_empty(h.referenceIndex());
+        r.calendar_name = string_or_empty(h.calendarName());
+        r.business_day_convention = string_or_empty(h.businessDayConvention());
+
+        const auto &points = curve.points().point();
+        r.points.reserve(points.size());
+        for (const auto &p: points) {
+            YieldPointRecord point;
+            point.tenor = p.tenor();
+            if (p.maturityDate().present()) point.maturity_date = to_date(p.maturityDate().get());
+            point.value = p.curveValue();
+            r.points.push_back(std::move(point));
+        }
+        return r;
+    }
+
+    VolSurfaceRecord to_record(const vol::VolSurface &surface) {
+        const auto &h = surface.header();
+        VolSurfaceRecord r;
+        r.header.underlying_id = h.underlyingId();
+        r.header.as_of = to_date(h.asOf());
+        r.header.quote_type = h.quoteType();
+        r.header.strike_dimension = h.strikeDimension();
+        r.header.strike_unit = string_or_empty(h.strikeUnit());
+        r.header.expiry_interpolation = string_or_empty(h.expiryInterpolation());
+        r.header.strike_interpolation = string_or_empty(h.strikeInterpolation());
+
+        const auto &points = surface.points().point();
+        r.points.reserve(points.size());
+        for (const auto &p: points) {
+            VolPointRecord point;
+            point.expiry = p.expiry();
+            point.strike_coordinate = p.strikeCoordinate();
+            point.volatility = p.volatility();
+            if (p.forward().present()) point.forward = p.forward().get();
+            if (p.totalVariance().present()) point.total_variance = p.totalVariance().get();
+            r.points.push_back(std::move(point));
+        }
+        return r;
+    }
+
+    QuoteSetRecord to_record(const quotes::InstrumentQuoteSet &quote_set) {
+        QuoteSetRecord r;
+        r.header.as_of = to_date(quote_set.asOf());
+        if (quote_set.snapshotTime().present()) r.header.snapshot_time = to_instant(quote_set.snapshotTime().get());
+        r.header.feed_name = string_or_empty(quote_set.feedName());
+        r.header.scenario_name = string_or_empty(quote_set.scenarioName());
+
+        const auto &instruments = quote_set.instruments().instrumentQuote();
+        r.instruments.reserve(instruments.size());
+        for (const auto &iq: instruments) {
+            InstrumentQuoteRecord instrument;
+            instrument.instrument_id = iq.instrumentId();
+            for (const auto &q: iq.quotes().quote()) {
+                QuoteRecord quote;
+                quote.value = q.value();
+                quote.side = q.side();
+                quote.value_type = q.valueType();
+                quote.currency = string_or_empty(q.currency());
+                if (q.size().present()) quote.size = q.size().get();
+                if (q.timestamp().present()) quote.timestamp = to_instant(q.timestamp().get());
+                quote.quality = string_or_empty(q.quality());
+                quote.source = string_or_empty(q.source());
+                instrument.quotes.push_back(std::move(quote));
+            }
+            r.instruments.push_back(std::move(instrument));
+        }
+        return r;
+    }
+
+    SnapshotData to_snapshot_data(const marketdata::MarketDataSnapshot &md) {
+        SnapshotData data;
+        const auto &h = md.header();
+        data.header.as_of = to_date(h.asOf());
+        if (h.snapshotTime().present()) data.header.snapshot_time = to_instant(h.snapshotTime().get());
+        data.header.scenario_name = string_or_empty(h.scenarioName());
+        data.header.source = string_or_empty(h.source());
+        data.header.snapshot_id = string_or_empty(h.snapshotId());
+
+        if (md.yieldCurves().present()) {
+            for (const auto &c: md.yieldCurves()->yieldCurve()) data.yield_curves.push_back(to_record(c));
+        }
+        if (md.volSurfaces().present()) {
+            for (const auto &s: md.volSurfaces()->volSurface()) data.vol_surfaces.push_back(to_record(s));
+        }
+        if (md.quoteSets().present()) {
+            for (const auto &q: md.quoteSets()->quoteSet()) data.quote_sets.push_back(to_record(q));
+        }
+        return data;
+    }
+}
@@ -0,0 +1,43 @@
+//
+// Created by Francisco Nunez on 05.02.2026.
+//
+
+#include "io/XsdCurveBuilder.h"
+
+#include "CurveBuilderDetail.h"
+#include "io/XsdConverters.h"
+
+namespace curve::io {
+    namespace {
+        template<typename Optional>
+        std::string_view view_or_empty(const Optional &o) {
+            return o.present() ? std::string_view(o.get()) : std::string_view();
+        }
+    }
+
+    std::shared_ptr<ICurve> build_yield_curve(const yield::YieldCurve &curve) {
+        const auto &h = curve.header();
+        const auto as_of = to_date(h.asOf());
+        const auto &points = curve.points().point();
+        const TenorResolver resolve(as_of, view_or_empty(h.calendarName()), view_or_empty(h.businessDayConvention()));
+        return detail::build_curve({
+                                       h.curveId(), as_of, h.curveType(), h.dayCount(), h.compounding(),
+                                       view_or_empty(h.interpolation())
+                                   },
+                                   points.size(),
+                                   [&](std::size_t i) {
+                                       const auto &p = points[i];
+                                       return p.maturityDate().present() ? to_date(p.maturityDate().get())
+                                                                         : resolve(p.tenor());
+                                   },
+                                   [&](std::size_t i) { return static_cast<double>(points[i].curveValue()); });
+    }
+
+    YieldCurveMap build_yield_curves(const marketdata::MarketDataSnapshot &md, std::size_t threads) {
+        if (!md.yieldCurves().present()) return {};
+        const auto &curves = md.yieldCurves()->yieldCurve();
+        return detail::build_curves(curves.size(), threads, [&](std::size_t i) {
+            return build_yield_curve(curves[i]);
+        });
+    }
+}
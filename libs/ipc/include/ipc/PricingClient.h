@@ -0,0 +1,83 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_PRICINGCLIENT_H
+#define CURVEFORGE_IPC_PRICINGCLIENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "PricingProtocol.h"
+
+namespace curve::ipc {
+    /**
+     * @brief Blocking client of the pricing service.
+     *
+     * add_*() queue requests and return their request id; flush() sends the queue in one write
+     * and returns the replies in request order. The single-request helpers need an empty queue
+     * and throw std::runtime_error on an ERROR reply. Not thread-safe: one client per thread.
+     */
+    class PricingClient {
+    public:
+        static PricingClient connect(const std::string &socket_path);
+
+        PricingClient(PricingClient &&other) noexcept;
+
+        PricingClient &operator=(PricingClient &&other) noexcept;
+
+        PricingClient(const PricingClient &) = delete;
+
+        PricingClient &operator=(const PricingClient &) = delete;
+
+        ~PricingClient();
+
+        std::uint32_t add_discount_factor(std::string_view curve_id, const time::Date &date);
+
+        std::uint32_t add_forward_rate(std::string_view curve_id, const time::Date &start, const time::Date &end);
+
+        std::uint32_t add_swap_par_rate(std::string_view discount_curve, std::string_view forward_curve,
+                                        const SwapSpec &swap);
+
+        std::uint32_t add_option_price(std::string_view surface_id, std::string_view discount_curve,
+                                       const OptionSpec &option);
+
+        std::uint32_t add_implied_vol(std::string_view discount_curve, double price, const OptionSpec &option);
+
+        std::uint32_t add_market_version();
+
+        [[nodiscard]] std::size_t pending() const { return pending_count_; }
+
+        std::vector<Reply> flush();
+
+        double discount_factor(std::string_view curve_id, const time::Date &date);
+
+        double forward_rate(std::string_view curve_id, const time::Date &start, const time::Date &end);
+
+        double swap_par_rate(std::string_view discount_curve, std::string_view forward_curve, const SwapSpec &swap);
+
+        double option_price(std::string_view surface_id, std::string_view discount_curve, const OptionSpec &option);
+
+        double implied_vol(std::string_view discount_curve, double price, const OptionSpec &option);
+
+        std::uint64_t market_version();
+
+    private:
+        explicit PricingClient(int fd) : fd_(fd) {
+        }
+
+        template<typename Add>
+        double single(Add add);
+
+        int fd_ = -1;
+        std::uint32_t next_id_ = 1;
+        std::size_t pending_count_ = 0;
+        std::vector<std::byte> out_;
+        std::vector<std::byte> in_;
+    };
+}
+
+#endif //CURVEFORGE_IPC_PRICINGCLIENT_H
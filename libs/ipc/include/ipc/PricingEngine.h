@@ -0,0 +1,56 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_PRICINGENGINE_H
+#define CURVEFORGE_IPC_PRICINGENGINE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "PricingMarket.h"
+#include "PricingProtocol.h"
+#include "instruments/StaticDataCache.h"
+
+namespace curve::ipc {
+    // Frame header that cannot be parsed: the connection has lost framing and must be closed.
+    struct ProtocolError : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @brief Evaluates request frames against the published market.
+     *
+     * process() answers every complete frame in the input under a single market acquire, so a
+     * batch of requests read together sees one consistent market version. One engine per thread.
+     */
+    class PricingEngine {
+    public:
+        explicit PricingEngine(const MarketPublisher &publisher);
+
+        /**
+         * @brief Appends one response per complete request frame in `input` to `output`.
+         * @return bytes consumed; a trailing partial frame is left for the next call
+         * @throws ProtocolError on a frame header with an impossible size
+         */
+        std::size_t process(std::span<const std::byte> input, std::vector<std::byte> &output);
+
+        // Requests answered so far
+        [[nodiscard]] std::uint64_t request_count() const { return request_count_; }
+
+        // Schedules held by the static data cache; swap requests never add any
+        [[nodiscard]] std::size_t cached_schedule_count() const { return static_data_.schedule_count(); }
+
+    private:
+        double evaluate(Op op, const std::byte *payload, std::size_t size, const PricingMarket &market);
+
+        MarketPublisher::Reader reader_;
+        instruments::StaticDataCache static_data_; // calendars and day counts; schedules are per request
+        std::uint64_t request_count_ = 0;
+    };
+}
+
+#endif //CURVEFORGE_IPC_PRICINGENGINE_H
@@ -0,0 +1,133 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_PRICINGMARKET_H
+#define CURVEFORGE_IPC_PRICINGMARKET_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "io/BinarySnapshot.h"
+#include "io/CurveBuilder.h"
+#include "volatility/ImpliedVolSurface.h"
+
+namespace curve::ipc {
+    using VolSurfaceMap = std::map<std::string, std::shared_ptr<volatility::ImpliedVolSurface>, std::less<> >;
+
+    // Calibrated, immutable market served by the pricing service.
+    struct PricingMarket {
+        time::Date as_of{};
+        std::uint64_t version = 0; // set by MarketPublisher::publish()
+        std::map<std::string, std::shared_ptr<ICurve>, std::less<> > curves;
+        VolSurfaceMap surfaces;
+
+        // Builds every curve and surface of a binary snapshot.
+        static std::shared_ptr<PricingMarket> from_snapshot(const io::MappedSnapshot &snapshot,
+                                                            std::size_t threads =
+                                                                    std::thread::hardware_concurrency());
+    };
+
+    /**
+     * @brief Publishes the current PricingMarket to reader threads without locks on the read path.
+     *
+     * Each reader thread claims a hazard slot once; acquire() then costs two atomic loads and one
+     * store. publish() swaps the market in and frees the retired markets no slot points to; one
+     * still guarded stays alive and is freed by a later publish(). Publishing is serialised
+     * internally and may happen from any thread.
+     */
+    class MarketPublisher {
+    public:
+        class Guard;
+
+        class Reader {
+        public:
+            Reader(Reader &&other) noexcept;
+
+            Reader &operator=(Reader &&) = delete;
+
+            ~Reader();
+
+            // The market current at the time of the call, valid until the Guard is destroyed.
+            [[nodiscard]] Guard acquire() const;
+
+        private:
+            friend class MarketPublisher;
+
+            Reader(const MarketPublisher *publisher, std::size_t slot) : publisher_(publisher), slot_(slot) {
+            }
+
+            const MarketPublisher *publisher_;
+            std::size_t slot_;
+        };
+
+        class Guard {
+        public:
+            Guard(Guard &&other) noexcept : hazard_(other.hazard_), market_(other.market_) {
+                other.hazard_ = nullptr;
+            }
+
+            Guard &operator=(Guard &&) = delete;
+
+            ~Guard();
+
+            [[nodiscard]] const PricingMarket *get() const { return market_; }
+            const PricingMarket *operator->() const { return market_; }
+            const PricingMarket &operator*() const { return *market_; }
+            explicit operator bool() const { return market_ != nullptr; }
+
+        private:
+            friend class Reader;
+
+            Guard(std::atomic<const PricingMarket *> *hazard, const PricingMarket *market)
+                : hazard_(hazard), market_(market) {
+            }
+
+            std::atomic<const PricingMarket *> *hazard_;
+            const PricingMarket *market_;
+        };
+
+        explicit MarketPublisher(std::size_t max_readers = 64);
+
+        MarketPublisher(const MarketPublisher &) = delete;
+
+        MarketPublisher &operator=(const MarketPublisher &) = delete;
+
+        // Throws std::length_error when all slots are taken.
+        [[nodiscard]] Reader register_reader() const;
+
+        // Stamps the next version on the market and makes it current; returns that version.
+        std::uint64_t publish(std::shared_ptr<PricingMarket> market);
+
+        [[nodiscard]] std::uint64_t version() const;
+
+        // Markets replaced but still guarded by a reader
+        [[nodiscard]] std::size_t retired_count() const;
+
+    private:
+        struct alignas(64) Slot {
+            std::atomic<const PricingMarket *> hazard{nullptr};
+            std::atomic<bool> claimed{false};
+        };
+
+        void reclaim();
+
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t slot_count_;
+        std::atomic<const PricingMarket *> current_{nullptr};
+
+        mutable std::mutex publish_mutex_;
+        std::shared_ptr<const PricingMarket> owner_; // keeps current_ alive
+        std::vector<std::shared_ptr<const PricingMarket> > retired_;
+        std::uint64_t version_ = 0;
+    };
+}
+
+#endif //CURVEFORGE_IPC_PRICINGMARKET_H
@@ -0,0 +1,90 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_PRICINGPROTOCOL_H
+#define CURVEFORGE_IPC_PRICINGPROTOCOL_H
+
+#include <cstdint>
+#include <string>
+
+#include "time/calendarsenum.hpp"
+#include "time/date.hpp"
+#include "time/date_modifier.hpp"
+#include "time/daycount.hpp"
+
+/**
+ * Wire protocol of the local pricing service. Every message is a frame: a FrameHeader followed by
+ * its payload, in host byte order (the socket never leaves the machine). A client may write any
+ * number of request frames at once; the server answers each with one response frame carrying the
+ * same request_id, in request order.
+ *
+ * Payload fields, by op (str = u16 length + bytes, date = i32 days since 1970-01-01, u8 enums use
+ * the time:: enum values):
+ *
+ *   DISCOUNT_FACTOR  str curve, date
+ *   FORWARD_RATE     str curve, date start, date end
+ *   SWAP_PAR_RATE    str discount curve, str forward curve, date start, date end,
+ *                    u8 fixed months, u8 float months, u8 day count, u8 calendar, u8 bdc
+ *   OPTION_PRICE     str surface, str discount curve, f64 spot, f64 strike, date expiry, u8 is call
+ *   IMPLIED_VOL      str discount curve, f64 price, f64 spot, f64 strike, date expiry, u8 is call
+ *   MARKET_VERSION   (empty)
+ *
+ * Responses: status OK + f64 value, or status ERROR + str message. A frame with an unknown op or
+ * a malformed payload gets an ERROR response; a malformed frame header closes the connection.
+ */
+namespace curve::ipc {
+    enum class Op : std::uint8_t {
+        DISCOUNT_FACTOR = 1,
+        FORWARD_RATE = 2,
+        SWAP_PAR_RATE = 3,
+        OPTION_PRICE = 4,
+        IMPLIED_VOL = 5,
+        MARKET_VERSION = 6
+    };
+
+    enum class Status : std::uint8_t {
+        OK = 0,
+        ERROR = 1
+    };
+
+    struct FrameHeader {
+        std::uint32_t size; // whole frame, header included
+        std::uint32_t request_id;
+        std::uint8_t code; // Op for requests, Status for responses
+        std::uint8_t reserved[3];
+    };
+
+    static_assert(sizeof(FrameHeader) == 12);
+
+    inline constexpr std::uint32_t kMaxFrameSize = 1u << 16;
+
+    struct SwapSpec {
+        time::Date start{};
+        time::Date end{};
+        int fixed_months = 12;
+        int float_months = 6;
+        time::DayCountConvention day_count = time::DayCountConvention::ACT_360;
+        time::FinancialCalendar calendar = time::FinancialCalendar::Euronext;
+        time::BusinessDayConvention bdc = time::BusinessDayConvention::MODIFIED_FOLLOWING;
+    };
+
+    struct OptionSpec {
+        double spot = 0.0;
+        double strike = 0.0;
+        time::Date expiry{};
+        bool is_call = true;
+    };
+
+    // Result of one request
+    struct Reply {
+        std::uint32_t request_id = 0;
+        Status status = Status::OK;
+        double value = 0.0;
+        std::string error;
+
+        [[nodiscard]] bool ok() const { return status == Status::OK; }
+    };
+}
+
+#endif //CURVEFORGE_IPC_PRICINGPROTOCOL_H
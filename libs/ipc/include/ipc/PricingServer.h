@@ -0,0 +1,81 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_PRICINGSERVER_H
+#define CURVEFORGE_IPC_PRICINGSERVER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "PricingEngine.h"
+#include "PricingMarket.h"
+
+namespace curve::ipc {
+    /**
+     * @brief Unix domain socket front end of the pricing service.
+     *
+     * A single poll() loop serves every connection: each readable socket is read up to a fixed
+     * budget per wakeup, all complete request frames are evaluated as one batch (one market
+     * acquire) and the responses go out in one write. A client that keeps its socket full is
+     * served over several wakeups, interleaved with the other connections. The socket is bound in the constructor, so clients may connect before run()
+     * starts; a stale socket file at the path is replaced.
+     */
+    class PricingServer {
+    public:
+        struct Stats {
+            std::uint64_t connections = 0;
+            std::uint64_t batches = 0; // reads that produced responses
+            std::uint64_t requests = 0;
+            std::size_t cached_schedules = 0; // held by the engine's static data cache
+        };
+
+        PricingServer(std::string socket_path, const MarketPublisher &publisher);
+
+        ~PricingServer();
+
+        PricingServer(const PricingServer &) = delete;
+
+        PricingServer &operator=(const PricingServer &) = delete;
+
+        // Serves until stop(); call from one thread only.
+        void run();
+
+        // Thread-safe and async-signal-safe.
+        void stop();
+
+        [[nodiscard]] const std::string &socket_path() const { return socket_path_; }
+
+        [[nodiscard]] Stats stats() const;
+
+    private:
+        struct Connection {
+            int fd = -1;
+            std::vector<std::byte> in;
+            std::vector<std::byte> out;
+            std::size_t out_offset = 0;
+        };
+
+        void accept_connections();
+
+        // False when the connection is finished (EOF, error, lost framing or too much pending input)
+        bool read_and_process(Connection &connection);
+
+        bool write_pending(Connection &connection);
+
+        std::string socket_path_;
+        PricingEngine engine_;
+        int listen_fd_ = -1;
+        int wake_pipe_[2] = {-1, -1};
+        std::vector<Connection> connections_;
+
+        std::atomic<std::uint64_t> connection_count_{0};
+        std::atomic<std::uint64_t> batch_count_{0};
+        std::atomic<std::uint64_t> request_count_{0};
+    };
+}
+
+#endif //CURVEFORGE_IPC_PRICINGSERVER_H
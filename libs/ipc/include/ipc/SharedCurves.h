@@ -0,0 +1,129 @@
+//
+// Created by Francisco Nunez on 10.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_SHAREDCURVES_H
+#define CURVEFORGE_IPC_SHAREDCURVES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "curve/ICurve.h"
+
+namespace curve::ipc {
+    namespace detail {
+        struct SegmentHeader;
+        struct CurveSlot;
+    }
+
+    /**
+     * @brief Writes calibrated curves into a POSIX shared-memory segment for other processes.
+     *
+     * Each curve is stored flat: pillar day serials, year fractions and the per-segment
+     * interpolation coefficients, so a reader evaluates D() straight from the mapping. Every
+     * curve slot carries its own seqlock and version; republishing one curve never disturbs
+     * readers of another. A segment has exactly one publisher; create() replaces a stale
+     * segment of the same name and the destructor unlinks the name (existing mappings stay valid).
+     */
+    class SharedCurvePublisher {
+    public:
+        // `name` is a shm_open() name such as "/curveforge-eod"
+        static SharedCurvePublisher create(const std::string &name, std::size_t capacity = 256,
+                                           std::size_t max_pillars = 128);
+
+        SharedCurvePublisher(SharedCurvePublisher &&other) noexcept;
+
+        SharedCurvePublisher &operator=(SharedCurvePublisher &&) = delete;
+
+        SharedCurvePublisher(const SharedCurvePublisher &) = delete;
+
+        SharedCurvePublisher &operator=(const SharedCurvePublisher &) = delete;
+
+        ~SharedCurvePublisher();
+
+        /**
+         * Publishes (or replaces) the curve under `curve_id` and returns its new version.
+         * Throws std::length_error when the id is longer than 47 bytes, the curve has more than
+         * max_pillars pillars or the segment is full.
+         */
+        std::uint64_t publish(std::string_view curve_id, const ICurve &curve);
+
+        [[nodiscard]] std::size_t size() const;
+
+        [[nodiscard]] const std::string &name() const { return name_; }
+
+    private:
+        SharedCurvePublisher(std::string name, void *base, std::size_t bytes);
+
+        std::string name_;
+        void *base_ = nullptr;
+        std::size_t bytes_ = 0;
+        std::mutex publish_mutex_;
+    };
+
+    /**
+     * @brief Read-only handle to one curve of a shared segment.
+     *
+     * Reads are lock-free and copy nothing: D() looks up the bracketing pillars in the mapping and
+     * retries only if the publisher rewrote that curve meanwhile. Inside a pillar interval time is
+     * linear in calendar days, which reproduces ICurve exactly for ACT/360 and ACT/365F curves.
+     * Valid while the SharedCurveReader it came from is alive.
+     */
+    class SharedCurve {
+    public:
+        [[nodiscard]] double D(const time::Date &d) const;
+
+        // Simple forward rate over [t1, t2], consistent with one version of the curve
+        [[nodiscard]] double F(const time::Date &t1, const time::Date &t2) const;
+
+        // Version of the curve currently published; 0 never happens for a found curve
+        [[nodiscard]] std::uint64_t version() const;
+
+        [[nodiscard]] std::string_view id() const;
+
+    private:
+        friend class SharedCurveReader;
+
+        explicit SharedCurve(const detail::CurveSlot *slot, std::size_t max_pillars)
+            : slot_(slot), max_pillars_(max_pillars) {
+        }
+
+        const detail::CurveSlot *slot_;
+        std::size_t max_pillars_;
+    };
+
+    // Maps a segment created by SharedCurvePublisher read-only.
+    class SharedCurveReader {
+    public:
+        static SharedCurveReader open(const std::string &name);
+
+        SharedCurveReader(SharedCurveReader &&other) noexcept;
+
+        SharedCurveReader &operator=(SharedCurveReader &&) = delete;
+
+        SharedCurveReader(const SharedCurveReader &) = delete;
+
+        SharedCurveReader &operator=(const SharedCurveReader &) = delete;
+
+        ~SharedCurveReader();
+
+        // Curves published after the lookup are found by a later call.
+        [[nodiscard]] std::optional<SharedCurve> find(std::string_view curve_id) const;
+
+        [[nodiscard]] std::vector<std::string> curve_ids() const;
+
+    private:
+        SharedCurveReader(const void *base, std::size_t bytes) : base_(base), bytes_(bytes) {
+        }
+
+        const void *base_ = nullptr;
+        std::size_t bytes_ = 0;
+    };
+}
+
+#endif //CURVEFORGE_IPC_SHAREDCURVES_H
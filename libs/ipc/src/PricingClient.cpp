@@ -0,0 +1,220 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#include "ipc/PricingClient.h"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <utility>
+
+#include "Wire.h"
+
+namespace curve::ipc {
+    namespace {
+        using detail::FrameWriter;
+
+#ifdef MSG_NOSIGNAL
+        constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+        constexpr int kSendFlags = 0;
+#endif
+
+        [[noreturn]] void fail(const std::string &what) {
+            throw std::runtime_error("PricingClient: " + what + ": " + std::strerror(errno));
+        }
+
+        void write_option(FrameWriter &out, const OptionSpec &option) {
+            out.put(option.spot).put(option.strike).put_date(option.expiry).put(
+                static_cast<std::uint8_t>(option.is_call ? 1 : 0));
+        }
+    }
+
+    PricingClient PricingClient::connect(const std::string &socket_path) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("PricingClient: bad socket path '" + socket_path + "'");
+        }
+        std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) fail("socket");
+#ifdef SO_NOSIGPIPE
+        const int on = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        if (::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+            const int error = errno;
+            ::close(fd);
+            errno = error;
+            fail("connect " + socket_path);
+        }
+        return PricingClient(fd);
+    }
+
+    PricingClient::PricingClient(PricingClient &&other) noexcept
+        : fd_(std::exchange(other.fd_, -1)), next_id_(other.next_id_), pending_count_(other.pending_count_),
+          out_(std::move(other.out_)), in_(std::move(other.in_)) {
+    }
+
+    PricingClient &PricingClient::operator=(PricingClient &&other) noexcept {
+        if (this != &other) {
+            if (fd_ >= 0) ::close(fd_);
+            fd_ = std::exchange(other.fd_, -1);
+            next_id_ = other.next_id_;
+            pending_count_ = other.pending_count_;
+            out_ = std::move(other.out_);
+            in_ = std::move(other.in_);
+        }
+        return *this;
+    }
+
+    PricingClient::~PricingClient() {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    std::uint32_t PricingClient::add_discount_factor(std::string_view curve_id, const time::Date &date) {
+        FrameWriter out(out_, next_id_, static_cast<std::uint8_t>(Op::DISCOUNT_FACTOR));
+        out.put_string(curve_id).put_date(date);
+        out.finish();
+        ++pending_count_;
+        return next_id_++;
+    }
+
+    std::uint32_t PricingClient::add_forward_rate(std::string_view curve_id, const time::Date &start,
+                                                  const time::Date &end) {
+        FrameWriter out(out_, next_id_, static_cast<std::uint8_t>(Op::FORWARD_RATE));
+        out.put_string(curve_id).put_date(start).put_date(end);
+        out.finish();
+        ++pending_count_;
+        return next_id_++;
+    }
+
+    std::uint32_t PricingClient::add_swap_par_rate(std::string_view discount_curve, std::string_view forward_curve,
+                                                   const SwapSpec &swap) {
+        if (swap.fixed_months <= 0 || swap.fixed_months > 255 || swap.float_months <= 0 || swap.float_months > 255) {
+            throw std::invalid_argument("PricingClient: swap frequencies must be 1..255 months");
+        }
+        FrameWriter out(out_, next_id_, static_cast<std::uint8_t>(Op::SWAP_PAR_RATE));
+        out.put_string(discount_curve).put_string(forward_curve).put_date(swap.start).put_date(swap.end)
+                .put(static_cast<std::uint8_t>(swap.fixed_months)).put(static_cast<std::uint8_t>(swap.float_months))
+                .put(static_cast<std::uint8_t>(swap.day_count)).put(static_cast<std::uint8_t>(swap.calendar))
+                .put(static_cast<std::uint8_t>(swap.bdc));
+        out.finish();
+        ++pending_count_;
+        return next_id_++;
+    }
+
+    std::uint32_t PricingClient::add_option_price(std::string_view surface_id, std::string_view discount_curve,
+                                                  const OptionSpec &option) {
+        FrameWriter out(out_, next_id_, static_cast<std::uint8_t>(Op::OPTION_PRICE));
+        out.put_string(surface_id).put_string(discount_curve);
+        write_option(out, option);
+        out.finish();
+        ++pending_count_;
+        return next_id_++;
+    }
+
+    std::uint32_t PricingClient::add_implied_vol(std::string_view discount_curve, double price,
+                                                 const OptionSpec &option) {
+        FrameWriter out(out_, next_id_, static_cast<std::uint8_t>(Op::IMPLIED_VOL));
+        out.put_string(discount_curve).put(price);
+        write_option(out, option);
+        out.finish();
+        ++pending_count_;
+        return next_id_++;
+    }
+
+    std::uint32_t PricingClient::add_market_version() {
+        FrameWriter out(out_, next_id_, static_cast<std::uint8_t>(Op::MARKET_VERSION));
+        out.finish();
+        ++pending_count_;
+        return next_id_++;
+    }
+
+    std::vector<Reply> PricingClient::flush() {
+        std::size_t sent = 0;
+        while (sent < out_.size()) {
+            const auto n = ::send(fd_, out_.data() + sent, out_.size() - sent, kSendFlags);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                fail("send");
+            }
+            sent += static_cast<std::size_t>(n);
+        }
+        out_.clear();
+
+        std::vector<Reply> replies;
+        replies.reserve(pending_count_);
+        std::size_t offset = 0;
+        while (replies.size() < pending_count_) {
+            if (in_.size() - offset >= sizeof(FrameHeader)) {
+                FrameHeader header{};
+                std::memcpy(&header, in_.data() + offset, sizeof(header));
+                if (header.size < sizeof(FrameHeader) || header.size > kMaxFrameSize) {
+                    throw std::runtime_error("PricingClient: malformed response");
+                }
+                if (in_.size() - offset >= header.size) {
+                    detail::PayloadReader payload(in_.data() + offset + sizeof(FrameHeader),
+                                                  header.size - sizeof(FrameHeader));
+                    Reply reply;
+                    reply.request_id = header.request_id;
+                    reply.status = static_cast<Status>(header.code);
+                    if (reply.ok()) reply.value = payload.get<double>();
+                    else reply.error = payload.get_string();
+                    replies.push_back(std::move(reply));
+                    offset += header.size;
+                    continue;
+                }
+            }
+            const auto at = in_.size();
+            in_.resize(at + 64 * 1024);
+            const auto n = ::recv(fd_, in_.data() + at, 64 * 1024, 0);
+            in_.resize(at + (n > 0 ? static_cast<std::size_t>(n) : 0));
+            if (n == 0) throw std::runtime_error("PricingClient: server closed the connection");
+            if (n < 0 && errno != EINTR) fail("recv");
+        }
+        in_.erase(in_.begin(), in_.begin() + static_cast<std::ptrdiff_t>(offset));
+        pending_count_ = 0;
+        return replies;
+    }
+
+    template<typename Add>
+    double PricingClient::single(Add add) {
+        if (pending_count_ != 0) throw std::logic_error("PricingClient: flush() queued requests first");
+        add();
+        const auto replies = flush();
+        if (!replies.front().ok()) throw std::runtime_error("pricing service: " + replies.front().error);
+        return replies.front().value;
+    }
+
+    double PricingClient::discount_factor(std::string_view curve_id, const time::Date &date) {
+        return single([&] { add_discount_factor(curve_id, date); });
+    }
+
+    double PricingClient::forward_rate(std::string_view curve_id, const time::Date &start, const time::Date &end) {
+        return single([&] { add_forward_rate(curve_id, start, end); });
+    }
+
+    double PricingClient::swap_par_rate(std::string_view discount_curve, std::string_view forward_curve,
+                                        const SwapSpec &swap) {
+        return single([&] { add_swap_par_rate(discount_curve, forward_curve, swap); });
+    }
+
+    double PricingClient::option_price(std::string_view surface_id, std::string_view discount_curve,
+                                       const OptionSpec &option) {
+        return single([&] { add_option_price(surface_id, discount_curve, option); });
+    }
+
+    double PricingClient::implied_vol(std::string_view discount_curve, double price, const OptionSpec &option) {
+        return single([&] { add_implied_vol(discount_curve, price, option); });
+    }
+
+    std::uint64_t PricingClient::market_version() {
+        return static_cast<std::uint64_t>(single([&] { add_market_version(); }));
+    }
+}
@@ -0,0 +1,171 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#include "ipc/PricingEngine.h"
+
+#include <chrono>
+#include <cmath>
+#include <memory_resource>
+#include <optional>
+#include <string>
+
+#include "Wire.h"
+#include "analytical_pricers/BlackScholes.h"
+#include "tasks/ScratchArena.h"
+#include "time/scheduler.h"
+
+namespace curve::ipc {
+    namespace {
+        using detail::FrameWriter;
+        using detail::MalformedPayload;
+        using detail::PayloadReader;
+        using analytical_pricers::BlackScholes;
+
+        template<typename Map>
+        const auto &find(const Map &map, std::string_view id, const char *what) {
+            const auto it = map.find(id);
+            if (it == map.end()) throw std::invalid_argument(std::string("unknown ") + what + " " + std::string(id));
+            return *it->second;
+        }
+
+        // ACT/365F year fraction from the market date and the continuously compounded rate to `expiry`
+        std::pair<double, double> expiry_and_rate(const PricingMarket &market, const ICurve &discount,
+                                                  const time::Date &expiry) {
+            const double t = (std::chrono::sys_days{expiry} - std::chrono::sys_days{market.as_of}).count() / 365.0;
+            if (t <= 0.0) throw std::invalid_argument("option expiry not after the market date");
+            return {t, -std::log(discount.D(expiry)) / t};
+        }
+
+        OptionSpec read_option(PayloadReader &in) {
+            OptionSpec option;
+            option.spot = in.get<double>();
+            option.strike = in.get<double>();
+            option.expiry = in.get_date();
+            option.is_call = in.get<std::uint8_t>() != 0;
+            return option;
+        }
+    }
+
+    PricingEngine::PricingEngine(const MarketPublisher &publisher) : reader_(publisher.register_reader()) {
+    }
+
+    std::size_t PricingEngine::process(std::span<const std::byte> input, std::vector<std::byte> &output) {
+        std::optional<MarketPublisher::Guard> market; // acquired once per batch
+        std::size_t consumed = 0;
+        while (input.size() - consumed >= sizeof(FrameHeader)) {
+            FrameHeader header{};
+            std::memcpy(&header, input.data() + consumed, sizeof(header));
+            if (header.size < sizeof(FrameHeader) || header.size > kMaxFrameSize) {
+                throw ProtocolError("bad frame size " + std::to_string(header.size));
+            }
+            if (input.size() - consumed < header.size) break;
+            if (!market) market.emplace(reader_.acquire());
+
+            const auto *payload = input.data() + consumed + sizeof(FrameHeader);
+            const auto payload_size = header.size - sizeof(FrameHeader);
+            consumed += header.size;
+            ++request_count_;
+            try {
+                if (!*market) throw std::runtime_error("no market published");
+                const double value = evaluate(static_cast<Op>(header.code), payload, payload_size, **market);
+                FrameWriter out(output, header.request_id, static_cast<std::uint8_t>(Status::OK));
+                out.put(value);
+                out.finish();
+            } catch (const std::exception &e) {
+                FrameWriter out(output, header.request_id, static_cast<std::uint8_t>(Status::ERROR));
+                out.put_string(std::string_view(e.what()).substr(0, 1024));
+                out.finish();
+            }
+        }
+        return consumed;
+    }
+
+    double PricingEngine::evaluate(Op op, const std::byte *payload, std::size_t size, const PricingMarket &market) {
+        PayloadReader in(payload, size);
+        double value = 0.0;
+        switch (op) {
+            case Op::DISCOUNT_FACTOR: {
+                const auto &curve = find(market.curves, in.get_string(), "curve");
+                const auto date = in.get_date();
+                in.expect_end();
+                value = curve.D(date);
+                break;
+            }
+            case Op::FORWARD_RATE: {
+                const auto &curve = find(market.curves, in.get_string(), "curve");
+                const auto start = in.get_date();
+                const auto end = in.get_date();
+                in.expect_end();
+                value = curve.F(start, end);
+                break;
+            }
+            case Op::SWAP_PAR_RATE: {
+                // Same formula as FixFloatSwapPricer::price with equal notionals
+                const auto &discount = find(market.curves, in.get_string(), "curve");
+                const auto &forward = find(market.curves, in.get_string(), "curve");
+                SwapSpec swap;
+                swap.start = in.get_date();
+                swap.end = in.get_date();
+                swap.fixed_months = in.get<std::uint8_t>();
+                swap.float_months = in.get<std::uint8_t>();
+                swap.day_count = in.get_enum(time::DayCountConvention::THIRTY_365F);
+                swap.calendar = in.get_enum(time::FinancialCalendar::NSE);
+                swap.bdc = in.get_enum(time::BusinessDayConvention::MODIFIED_PRECEDING);
+                in.expect_end();
+                if (swap.fixed_months == 0 || swap.float_months == 0 || swap.end <= swap.start) {
+                    throw std::invalid_argument("bad swap schedule");
+                }
+                // Schedules are per request, on the thread's scratch arena: client-chosen dates must not
+                // accumulate in a cache for the lifetime of the daemon
+                const auto &dc = static_data_.day_count(swap.day_count);
+                const auto &calendar = static_data_.calendar(swap.calendar);
+                const tasks::ArenaScope scratch;
+                std::pmr::vector<time::AccruedPeriod> fixed(scratch.resource());
+                std::pmr::vector<time::AccruedPeriod> floating(scratch.resource());
+                time::Scheduler::generate_accruals(swap.start, swap.end, std::chrono::months{swap.fixed_months},
+                                                   swap.bdc, dc, calendar, fixed);
+                time::Scheduler::generate_accruals(swap.start, swap.end, std::chrono::months{swap.float_months},
+                                                   swap.bdc, dc, calendar, floating);
+                double annuity = 0.0;
+                for (const auto &p: fixed) annuity += p.accrual * discount.D(p.end_date);
+                double float_leg = 0.0;
+                for (const auto &p: floating) {
+                    float_leg += forward.F(p.start_date, p.end_date) * p.accrual * discount.D(p.end_date);
+                }
+                if (annuity == 0.0) throw std::runtime_error("zero annuity");
+                value = float_leg / annuity;
+                break;
+            }
+            case Op::OPTION_PRICE: {
+                const auto &surface = find(market.surfaces, in.get_string(), "surface");
+                const auto &discount = find(market.curves, in.get_string(), "curve");
+                const auto option = read_option(in);
+                in.expect_end();
+                const auto [t, r] = expiry_and_rate(market, discount, option.expiry);
+                const double vol = surface.get_volatility(option.strike, t, option.spot * std::exp(r * t));
+                value = option.is_call
+                            ? BlackScholes::call_price(option.spot, option.strike, r, vol, t)
+                            : BlackScholes::put_price(option.spot, option.strike, r, vol, t);
+                break;
+            }
+            case Op::IMPLIED_VOL: {
+                const auto &discount = find(market.curves, in.get_string(), "curve");
+                const double price = in.get<double>();
+                const auto option = read_option(in);
+                in.expect_end();
+                const auto [t, r] = expiry_and_rate(market, discount, option.expiry);
+                value = BlackScholes::implied_volatility_brent(price, option.spot, option.strike, r, t,
+                                                               option.is_call);
+                break;
+            }
+            case Op::MARKET_VERSION:
+                in.expect_end();
+                value = static_cast<double>(market.version);
+                break;
+            default:
+                throw MalformedPayload("unknown op " + std::to_string(static_cast<int>(op)));
+        }
+        return value;
+    }
+}
@@ -0,0 +1,98 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#include "ipc/PricingMarket.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "io/SurfaceBuilder.h"
+
+namespace curve::ipc {
+    std::shared_ptr<PricingMarket> PricingMarket::from_snapshot(const io::MappedSnapshot &snapshot,
+                                                                std::size_t threads) {
+        auto market = std::make_shared<PricingMarket>();
+        market->as_of = snapshot.header().as_of;
+        for (auto &[id, curve]: io::build_yield_curves(snapshot, threads)) {
+            market->curves.emplace(id, std::move(curve));
+        }
+        for (std::size_t i = 0; i < snapshot.vol_surface_count(); ++i) {
+            const auto view = snapshot.vol_surface(i);
+            market->surfaces.emplace(std::string(view.underlying_id()), io::build_vol_surface(view));
+        }
+        return market;
+    }
+
+    // ---- MarketPublisher ----
+
+    MarketPublisher::MarketPublisher(std::size_t max_readers)
+        : slots_(std::make_unique<Slot[]>(max_readers)), slot_count_(max_readers) {
+    }
+
+    MarketPublisher::Reader MarketPublisher::register_reader() const {
+        for (std::size_t i = 0; i < slot_count_; ++i) {
+            bool expected = false;
+            if (slots_[i].claimed.compare_exchange_strong(expected, true)) return Reader(this, i);
+        }
+        throw std::length_error("MarketPublisher: no free reader slot");
+    }
+
+    MarketPublisher::Reader::Reader(Reader &&other) noexcept : publisher_(other.publisher_), slot_(other.slot_) {
+        other.publisher_ = nullptr;
+    }
+
+    MarketPublisher::Reader::~Reader() {
+        if (publisher_) publisher_->slots_[slot_].claimed.store(false, std::memory_order_release);
+    }
+
+    MarketPublisher::Guard MarketPublisher::Reader::acquire() const {
+        auto &hazard = publisher_->slots_[slot_].hazard;
+        const auto &current = publisher_->current_;
+        const PricingMarket *market = current.load(std::memory_order_acquire);
+        while (true) {
+            // seq_cst store/load pair: either publish() sees the hazard or we see the new market
+            hazard.store(market);
+            const auto again = current.load();
+            if (again == market) break;
+            market = again;
+        }
+        return Guard(&hazard, market);
+    }
+
+    MarketPublisher::Guard::~Guard() {
+        if (hazard_) hazard_->store(nullptr, std::memory_order_release);
+    }
+
+    std::uint64_t MarketPublisher::publish(std::shared_ptr<PricingMarket> market) {
+        if (!market) throw std::invalid_argument("MarketPublisher: null market");
+        std::lock_guard lock(publish_mutex_);
+        market->version = ++version_;
+        if (owner_) retired_.push_back(std::move(owner_));
+        owner_ = std::move(market);
+        current_.store(owner_.get());
+        reclaim();
+        return version_;
+    }
+
+    void MarketPublisher::reclaim() {
+        std::vector<const PricingMarket *> guarded;
+        for (std::size_t i = 0; i < slot_count_; ++i) {
+            if (const auto *p = slots_[i].hazard.load()) guarded.push_back(p);
+        }
+        std::erase_if(retired_, [&](const std::shared_ptr<const PricingMarket> &m) {
+            return std::find(guarded.begin(), guarded.end(), m.get()) == guarded.end();
+        });
+    }
+
+    std::uint64_t MarketPublisher::version() const {
+        std::lock_guard lock(publish_mutex_);
+        return version_;
+    }
+
+    std::size_t MarketPublisher::retired_count() const {
+        std::lock_guard lock(publish_mutex_);
+        return retired_.size();
+    }
+}
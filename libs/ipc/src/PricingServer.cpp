@@ -0,0 +1,197 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#include "ipc/PricingServer.h"
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace curve::ipc {
+    namespace {
+        constexpr std::size_t kReadChunk = 64 * 1024;
+        constexpr std::size_t kReadsPerWakeup = 4; // then poll() again, so one busy client cannot starve the rest
+        constexpr std::size_t kMaxPendingOutput = 4u << 20; // stop reading a client that does not read
+        // Unprocessed input: at most one wakeup's reads on top of a partial frame
+        constexpr std::size_t kMaxPendingInput = kReadsPerWakeup * kReadChunk + kMaxFrameSize;
+
+#ifdef MSG_NOSIGNAL
+        constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+        constexpr int kSendFlags = 0; // SO_NOSIGPIPE is set on the socket instead
+#endif
+
+        [[noreturn]] void fail(const std::string &what) {
+            throw std::runtime_error("PricingServer: " + what + ": " + std::strerror(errno));
+        }
+
+        void set_non_blocking(int fd) {
+            const int flags = ::fcntl(fd, F_GETFL, 0);
+            if (flags < 0 || ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) fail("fcntl");
+        }
+
+        void set_no_sigpipe([[maybe_unused]] int fd) {
+#ifdef SO_NOSIGPIPE
+            const int on = 1;
+            ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+        }
+    }
+
+    PricingServer::PricingServer(std::string socket_path, const MarketPublisher &publisher)
+        : socket_path_(std::move(socket_path)), engine_(publisher) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (socket_path_.empty() || socket_path_.size() >= sizeof(address.sun_path)) {
+            throw std::invalid_argument("PricingServer: bad socket path '" + socket_path_ + "'");
+        }
+        std::memcpy(address.sun_path, socket_path_.c_str(), socket_path_.size() + 1);
+
+        if (::pipe(wake_pipe_) != 0) fail("pipe");
+        set_non_blocking(wake_pipe_[0]);
+        set_non_blocking(wake_pipe_[1]);
+
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd_ < 0) fail("socket");
+        ::unlink(socket_path_.c_str());
+        if (::bind(listen_fd_, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+            fail("bind " + socket_path_);
+        }
+        if (::listen(listen_fd_, 128) != 0) fail("listen");
+        set_non_blocking(listen_fd_);
+    }
+
+    PricingServer::~PricingServer() {
+        for (const auto &c: connections_) ::close(c.fd);
+        if (listen_fd_ >= 0) {
+            ::close(listen_fd_);
+            ::unlink(socket_path_.c_str());
+        }
+        for (const int fd: wake_pipe_) {
+            if (fd >= 0) ::close(fd);
+        }
+    }
+
+    void PricingServer::stop() {
+        const char byte = 1;
+        [[maybe_unused]] const auto written = ::write(wake_pipe_[1], &byte, 1);
+    }
+
+    PricingServer::Stats PricingServer::stats() const {
+        return {connection_count_.load(), batch_count_.load(), request_count_.load(), engine_.cached_schedule_count()};
+    }
+
+    void PricingServer::run() {
+        std::vector<pollfd> fds;
+        while (true) {
+            fds.clear();
+            fds.push_back({wake_pipe_[0], POLLIN, 0});
+            fds.push_back({listen_fd_, POLLIN, 0});
+            for (const auto &c: connections_) {
+                short events = 0;
+                if (c.out.size() - c.out_offset < kMaxPendingOutput) events |= POLLIN;
+                if (c.out_offset < c.out.size()) events |= POLLOUT;
+                fds.push_back({c.fd, events, 0});
+            }
+            if (::poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) continue;
+                fail("poll");
+            }
+            if (fds[0].revents & POLLIN) {
+                char drain[64];
+                while (::read(wake_pipe_[0], drain, sizeof(drain)) > 0) {
+                }
+                return;
+            }
+
+            // fds[2 + i] belongs to connections_[i]; accepted connections are appended after the scan
+            for (std::size_t i = connections_.size(); i-- > 0;) {
+                const auto revents = fds[2 + i].revents;
+                if (revents == 0) continue;
+                auto &c = connections_[i];
+                bool alive = (revents & (POLLERR | POLLNVAL)) == 0;
+                if (alive && (revents & (POLLIN | POLLHUP))) alive = read_and_process(c);
+                if (alive && (revents & POLLOUT)) alive = write_pending(c);
+                if (!alive) {
+                    ::close(c.fd);
+                    connections_[i] = std::move(connections_.back());
+                    connections_.pop_back();
+                }
+            }
+            if (fds[1].revents & POLLIN) accept_connections();
+        }
+    }
+
+    void PricingServer::accept_connections() {
+        while (true) {
+            const int fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) {
+                if (errno == EINTR) continue;
+                return; // EAGAIN, or a client that went away before being accepted
+            }
+            set_non_blocking(fd);
+            set_no_sigpipe(fd);
+            connections_.push_back({fd, {}, {}, 0});
+            ++connection_count_;
+        }
+    }
+
+    bool PricingServer::read_and_process(Connection &c) {
+        // Bytes still in the socket after kReadsPerWakeup reads keep it readable for the next poll()
+        std::array<std::byte, kReadChunk> chunk; // not zero-filled: only the bytes read are appended
+        bool eof = false;
+        for (std::size_t reads = 0; reads < kReadsPerWakeup;) {
+            const auto n = ::read(c.fd, chunk.data(), chunk.size());
+            if (n > 0) {
+                c.in.insert(c.in.end(), chunk.data(), chunk.data() + n);
+                if (static_cast<std::size_t>(n) < chunk.size()) break; // drained
+                ++reads;
+                continue;
+            }
+            if (n == 0) eof = true;
+            else if (errno == EINTR) continue;
+            else if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+            break;
+        }
+
+        const auto before = engine_.request_count();
+        try {
+            if (c.in.size() > kMaxPendingInput) {
+                throw ProtocolError("pending input exceeds " + std::to_string(kMaxPendingInput) + " bytes");
+            }
+            const auto consumed = engine_.process(c.in, c.out);
+            c.in.erase(c.in.begin(), c.in.begin() + static_cast<std::ptrdiff_t>(consumed));
+        } catch (const ProtocolError &) {
+            return false;
+        }
+        if (const auto answered = engine_.request_count() - before; answered > 0) {
+            ++batch_count_;
+            request_count_ += answered;
+        }
+        return write_pending(c) && !eof;
+    }
+
+    bool PricingServer::write_pending(Connection &c) {
+        while (c.out_offset < c.out.size()) {
+            const auto n = ::send(c.fd, c.out.data() + c.out_offset, c.out.size() - c.out_offset, kSendFlags);
+            if (n > 0) {
+                c.out_offset += static_cast<std::size_t>(n);
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return true; // POLLOUT resumes
+            return false;
+        }
+        c.out.clear();
+        c.out_offset = 0;
+        return true;
+    }
+}
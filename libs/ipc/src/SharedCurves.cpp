@@ -0,0 +1,366 @@
+//
+// Created by Francisco Nunez on 10.02.2026.
+//
+
+#include "ipc/SharedCurves.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+#include "Wire.h"
+
+namespace curve::ipc::detail {
+    constexpr char kSegmentMagic[8] = {'C', 'F', 'S', 'H', 'M', 'C', 'V', '\0'};
+    constexpr std::uint32_t kLayoutVersion = 1;
+    constexpr std::size_t kMaxIdLength = 47;
+
+    struct SegmentHeader {
+        char magic[8];
+        std::uint32_t layout_version;
+        std::uint32_t capacity;
+        std::uint32_t max_pillars;
+        std::uint32_t reserved;
+        std::uint64_t slot_size;
+        std::atomic<std::uint32_t> curve_count; // slots [0, curve_count) hold a published curve
+    };
+
+    // Per-pillar interpolation coefficients; `value` is the zero rate, D or ln D depending on the mode
+    struct Knot {
+        double t; // year fraction from the cob date
+        double t_slope; // per calendar day up to the next pillar
+        double value;
+        double value_slope;
+    };
+
+    // Fixed part of a curve slot, followed by int32 serials[max_pillars] and Knot knots[max_pillars].
+    // Everything but `id` is rewritten under `sequence` and read through relaxed atomic_refs.
+    struct alignas(64) CurveSlot {
+        std::atomic<std::uint64_t> sequence; // odd while the publisher writes
+        std::uint64_t version;
+        char id[kMaxIdLength + 1];
+        std::int32_t cob;
+        std::uint32_t pillar_count;
+        std::uint32_t mode;
+        double year_per_day;
+    };
+
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free && std::atomic<std::uint64_t>::is_always_lock_free,
+                  "shared-memory atomics must be address free");
+
+    std::size_t serials_offset() { return sizeof(CurveSlot); }
+
+    std::size_t knots_offset(std::size_t max_pillars) {
+        return (sizeof(CurveSlot) + max_pillars * sizeof(std::int32_t) + alignof(Knot) - 1) / alignof(Knot) *
+               alignof(Knot);
+    }
+
+    std::size_t slot_size(std::size_t max_pillars) {
+        return (knots_offset(max_pillars) + max_pillars * sizeof(Knot) + 63) / 64 * 64;
+    }
+
+    std::size_t slots_offset() { return (sizeof(SegmentHeader) + 63) / 64 * 64; }
+
+    template<typename T>
+    T load(const T &field) {
+        return std::atomic_ref<T>(const_cast<T &>(field)).load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    void store(T &field, T value) {
+        std::atomic_ref<T>(field).store(value, std::memory_order_relaxed);
+    }
+
+    const std::int32_t *serials_of(const CurveSlot *slot) {
+        return reinterpret_cast<const std::int32_t *>(reinterpret_cast<const std::byte *>(slot) + serials_offset());
+    }
+
+    const Knot *knots_of(const CurveSlot *slot, std::size_t max_pillars) {
+        return reinterpret_cast<const Knot *>(reinterpret_cast<const std::byte *>(slot) + knots_offset(max_pillars));
+    }
+
+    const CurveSlot *slot_at(const void *base, std::size_t index) {
+        const auto *header = static_cast<const SegmentHeader *>(base);
+        return reinterpret_cast<const CurveSlot *>(static_cast<const std::byte *>(base) + slots_offset() +
+                                                   index * header->slot_size);
+    }
+
+    CurveSlot *slot_at(void *base, std::size_t index) {
+        return const_cast<CurveSlot *>(slot_at(static_cast<const void *>(base), index));
+    }
+
+    // Runs `read` until it saw one consistent version of the slot
+    template<typename Read>
+    auto consistent_read(const CurveSlot *slot, Read read) {
+        while (true) {
+            const auto before = slot->sequence.load(std::memory_order_acquire);
+            if ((before & 1u) == 0) {
+                const auto result = read();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot->sequence.load(std::memory_order_relaxed) == before) return result;
+            }
+        }
+    }
+
+    // Discount factor at `serial` from the fields of one slot version; tolerates torn reads
+    double discount(const CurveSlot *slot, std::size_t max_pillars, std::int32_t serial) {
+        const auto n = std::clamp<std::size_t>(load(slot->pillar_count), 1, max_pillars);
+        const auto *serials = serials_of(slot);
+        const auto *knots = knots_of(slot, max_pillars);
+
+        const auto first = load(serials[0]);
+        const auto last = load(serials[n - 1]);
+        const auto s = std::clamp(serial, std::min(first, last), std::max(first, last));
+        std::size_t lo = 0, hi = n; // first serial greater than s
+        while (lo < hi) {
+            const auto mid = (lo + hi) / 2;
+            if (load(serials[mid]) <= s) lo = mid + 1;
+            else hi = mid;
+        }
+        const auto i = lo == 0 ? 0 : lo - 1;
+        const double ds = s - load(serials[i]);
+        const double value = load(knots[i].value) + load(knots[i].value_slope) * ds;
+        switch (static_cast<InterpolationMode>(load(slot->mode))) {
+            case InterpolationMode::LINEAR_DISCOUNT:
+                return value;
+            case InterpolationMode::LOG_LINEAR_DISCOUNT:
+                return std::exp(value);
+            case InterpolationMode::LINEAR_ZERO:
+                break;
+        }
+        return std::exp(-value * (load(knots[i].t) + load(knots[i].t_slope) * ds));
+    }
+
+    [[noreturn]] void fail(const std::string &what) {
+        throw std::runtime_error("SharedCurves: " + what + ": " + std::strerror(errno));
+    }
+}
+
+namespace curve::ipc {
+    using namespace detail;
+
+    SharedCurvePublisher SharedCurvePublisher::create(const std::string &name, std::size_t capacity,
+                                                      std::size_t max_pillars) {
+        if (capacity == 0 || capacity > UINT32_MAX || max_pillars == 0 || max_pillars > UINT32_MAX) {
+            throw std::invalid_argument("SharedCurvePublisher: capacity and max_pillars must be positive");
+        }
+        const auto bytes = slots_offset() + capacity * slot_size(max_pillars);
+
+        ::shm_unlink(name.c_str()); // a segment left behind by a publisher that died
+        const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+        if (fd < 0) fail("shm_open " + name);
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+            const int error = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            errno = error;
+            fail("ftruncate " + name);
+        }
+        void *base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            ::shm_unlink(name.c_str());
+            errno = error;
+            fail("mmap " + name);
+        }
+
+        // The mapping is zero filled; the magic is written last so readers never see a partial header
+        auto *header = new(base) SegmentHeader{};
+        header->layout_version = kLayoutVersion;
+        header->capacity = static_cast<std::uint32_t>(capacity);
+        header->max_pillars = static_cast<std::uint32_t>(max_pillars);
+        header->slot_size = slot_size(max_pillars);
+        for (std::size_t i = 0; i < capacity; ++i) new(slot_at(base, i)) CurveSlot{};
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(header->magic, kSegmentMagic, sizeof(kSegmentMagic));
+        return SharedCurvePublisher(name, base, bytes);
+    }
+
+    SharedCurvePublisher::SharedCurvePublisher(std::string name, void *base, std::size_t bytes)
+        : name_(std::move(name)), base_(base), bytes_(bytes) {
+    }
+
+    SharedCurvePublisher::SharedCurvePublisher(SharedCurvePublisher &&other) noexcept
+        : name_(std::move(other.name_)), base_(std::exchange(other.base_, nullptr)),
+          bytes_(std::exchange(other.bytes_, 0)) {
+    }
+
+    SharedCurvePublisher::~SharedCurvePublisher() {
+        if (base_ == nullptr) return;
+        ::munmap(base_, bytes_);
+        ::shm_unlink(name_.c_str());
+    }
+
+    std::size_t SharedCurvePublisher::size() const {
+        return static_cast<const SegmentHeader *>(base_)->curve_count.load(std::memory_order_acquire);
+    }
+
+    std::uint64_t SharedCurvePublisher::publish(std::string_view curve_id, const ICurve &curve) {
+        auto *header = static_cast<SegmentHeader *>(base_);
+        const auto &pillars = curve.pillars();
+        if (curve_id.empty() || curve_id.size() > kMaxIdLength) {
+            throw std::length_error("SharedCurvePublisher: curve id must be 1.." + std::to_string(kMaxIdLength) +
+                                    " bytes");
+        }
+        if (pillars.empty() || pillars.size() > header->max_pillars) {
+            throw std::length_error("SharedCurvePublisher: curve '" + std::string(curve_id) + "' has " +
+                                    std::to_string(pillars.size()) + " pillars, the segment holds 1.." +
+                                    std::to_string(header->max_pillars));
+        }
+
+        // Flat image of the curve, computed before the slot is touched
+        const auto n = pillars.size();
+        std::vector<std::int32_t> serials(n);
+        std::vector<Knot> knots(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            serials[i] = to_serial(pillars[i].get_time());
+            const double t = curve.year_fraction(pillars[i].get_time());
+            const double zero = pillars[i].get_value();
+            knots[i].t = t;
+            switch (curve.interpolation()) {
+                case InterpolationMode::LINEAR_ZERO: knots[i].value = zero;
+                    break;
+                case InterpolationMode::LINEAR_DISCOUNT: knots[i].value = std::exp(-zero * t);
+                    break;
+                case InterpolationMode::LOG_LINEAR_DISCOUNT: knots[i].value = -zero * t;
+                    break;
+            }
+        }
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            const double days = serials[i + 1] - serials[i];
+            if (days <= 0.0) continue;
+            knots[i].t_slope = (knots[i + 1].t - knots[i].t) / days;
+            knots[i].value_slope = (knots[i + 1].value - knots[i].value) / days;
+        }
+        const auto cob = to_serial(curve.cob());
+        const double span = serials.back() - cob;
+        const double year_per_day = span > 0.0 ? knots.back().t / span : 1.0 / 365.0;
+
+        std::lock_guard lock(publish_mutex_);
+        const auto count = header->curve_count.load(std::memory_order_relaxed);
+        std::size_t index = 0;
+        while (index < count && curve_id != slot_at(base_, index)->id) ++index;
+        if (index == header->capacity) {
+            throw std::length_error("SharedCurvePublisher: segment '" + name_ + "' is full");
+        }
+        auto *slot = slot_at(base_, index);
+        if (index == count) std::memcpy(slot->id, curve_id.data(), curve_id.size());
+
+        const auto sequence = slot->sequence.load(std::memory_order_relaxed);
+        slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        const auto version = load(slot->version) + 1;
+        store(slot->version, version);
+        store(slot->cob, cob);
+        store(slot->pillar_count, static_cast<std::uint32_t>(n));
+        store(slot->mode, static_cast<std::uint32_t>(curve.interpolation()));
+        store(slot->year_per_day, year_per_day);
+        auto *slot_serials = const_cast<std::int32_t *>(serials_of(slot));
+        auto *slot_knots = const_cast<Knot *>(knots_of(slot, header->max_pillars));
+        for (std::size_t i = 0; i < n; ++i) {
+            store(slot_serials[i], serials[i]);
+            store(slot_knots[i].t, knots[i].t);
+            store(slot_knots[i].t_slope, knots[i].t_slope);
+            store(slot_knots[i].value, knots[i].value);
+            store(slot_knots[i].value_slope, knots[i].value_slope);
+        }
+
+        slot->sequence.store(sequence + 2, std::memory_order_release);
+        if (index == count) header->curve_count.store(count + 1, std::memory_order_release);
+        return version;
+    }
+
+    double SharedCurve::D(const time::Date &d) const {
+        const auto serial = to_serial(d);
+        return consistent_read(slot_, [&] { return discount(slot_, max_pillars_, serial); });
+    }
+
+    double SharedCurve::F(const time::Date &t1, const time::Date &t2) const {
+        const auto s1 = to_serial(t1), s2 = to_serial(t2);
+        return consistent_read(slot_, [&] {
+            const double tau = (s2 - s1) * load(slot_->year_per_day);
+            return (discount(slot_, max_pillars_, s1) / discount(slot_, max_pillars_, s2) - 1.0) / tau;
+        });
+    }
+
+    std::uint64_t SharedCurve::version() const {
+        return consistent_read(slot_, [&] { return load(slot_->version); });
+    }
+
+    std::string_view SharedCurve::id() const { return slot_->id; }
+
+    SharedCurveReader SharedCurveReader::open(const std::string &name) {
+        const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0) fail("shm_open " + name);
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            const int error = errno;
+            ::close(fd);
+            errno = error;
+            fail("fstat " + name);
+        }
+        const auto bytes = static_cast<std::size_t>(info.st_size);
+        if (bytes < slots_offset()) {
+            ::close(fd);
+            throw std::runtime_error("SharedCurveReader: '" + name + "' is not a curve segment");
+        }
+        const void *base = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+        const int error = errno;
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            errno = error;
+            fail("mmap " + name);
+        }
+
+        const auto *header = static_cast<const SegmentHeader *>(base);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const bool valid = std::memcmp(header->magic, kSegmentMagic, sizeof(kSegmentMagic)) == 0 &&
+                           header->layout_version == kLayoutVersion && header->max_pillars > 0 &&
+                           header->slot_size == slot_size(header->max_pillars) &&
+                           bytes >= slots_offset() + header->capacity * header->slot_size;
+        if (!valid) {
+            ::munmap(const_cast<void *>(base), bytes);
+            throw std::runtime_error("SharedCurveReader: '" + name + "' is not a curve segment of layout " +
+                                     std::to_string(kLayoutVersion));
+        }
+        return SharedCurveReader(base, bytes);
+    }
+
+    SharedCurveReader::SharedCurveReader(SharedCurveReader &&other) noexcept
+        : base_(std::exchange(other.base_, nullptr)), bytes_(std::exchange(other.bytes_, 0)) {
+    }
+
+    SharedCurveReader::~SharedCurveReader() {
+        if (base_ != nullptr) ::munmap(const_cast<void *>(base_), bytes_);
+    }
+
+    std::optional<SharedCurve> SharedCurveReader::find(std::string_view curve_id) const {
+        const auto *header = static_cast<const SegmentHeader *>(base_);
+        const auto count = std::min(header->curve_count.load(std::memory_order_acquire), header->capacity);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto *slot = slot_at(base_, i);
+            if (curve_id == slot->id) return SharedCurve(slot, header->max_pillars);
+        }
+        return std::nullopt;
+    }
+
+    std::vector<std::string> SharedCurveReader::curve_ids() const {
+        const auto *header = static_cast<const SegmentHeader *>(base_);
+        const auto count = std::min(header->curve_count.load(std::memory_order_acquire), header->capacity);
+        std::vector<std::string> ids;
+        ids.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) ids.emplace_back(slot_at(base_, i)->id);
+        return ids;
+    }
+}
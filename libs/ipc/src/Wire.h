@@ -0,0 +1,129 @@
+//
+// Created by Francisco Nunez on 08.02.2026.
+//
+
+#ifndef CURVEFORGE_IPC_WIRE_H
+#define CURVEFORGE_IPC_WIRE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "ipc/PricingProtocol.h"
+
+// Frame encoding shared by the client and the server.
+namespace curve::ipc::detail {
+    using time::from_serial;
+    using time::to_serial;
+
+    // Appends one frame to `out`; finish() patches the size. An unfinished frame is removed again.
+    class FrameWriter {
+    public:
+        FrameWriter(std::vector<std::byte> &out, std::uint32_t request_id, std::uint8_t code)
+            : out_(out), start_(out.size()) {
+            const FrameHeader header{0, request_id, code, {}};
+            put(header);
+        }
+
+        FrameWriter(const FrameWriter &) = delete;
+
+        FrameWriter &operator=(const FrameWriter &) = delete;
+
+        ~FrameWriter() {
+            if (!finished_) out_.resize(start_);
+        }
+
+        template<typename T>
+        FrameWriter &put(const T &value) {
+            const auto at = out_.size();
+            out_.resize(at + sizeof(T));
+            std::memcpy(out_.data() + at, &value, sizeof(T));
+            return *this;
+        }
+
+        FrameWriter &put_string(std::string_view s) {
+            if (s.size() > std::numeric_limits<std::uint16_t>::max()) {
+                throw std::length_error("pricing protocol: string longer than 65535 bytes");
+            }
+            put(static_cast<std::uint16_t>(s.size()));
+            const auto at = out_.size();
+            out_.resize(at + s.size());
+            std::memcpy(out_.data() + at, s.data(), s.size());
+            return *this;
+        }
+
+        FrameWriter &put_date(const time::Date &d) { return put(to_serial(d)); }
+
+        void finish() {
+            const auto size = out_.size() - start_;
+            if (size > kMaxFrameSize) {
+                throw std::length_error("pricing protocol: frame exceeds kMaxFrameSize");
+            }
+            const auto size32 = static_cast<std::uint32_t>(size);
+            std::memcpy(out_.data() + start_, &size32, sizeof(size32));
+            finished_ = true;
+        }
+
+    private:
+        std::vector<std::byte> &out_;
+        std::size_t start_;
+        bool finished_ = false;
+    };
+
+    struct MalformedPayload : std::runtime_error {
+        using std::runtime_error::runtime_error;
+    };
+
+    // Reads the payload of one frame; running past its end throws MalformedPayload.
+    class PayloadReader {
+    public:
+        PayloadReader(const std::byte *data, std::size_t size) : p_(data), end_(data + size) {
+        }
+
+        template<typename T>
+        T get() {
+            need(sizeof(T));
+            T value;
+            std::memcpy(&value, p_, sizeof(T));
+            p_ += sizeof(T);
+            return value;
+        }
+
+        std::string_view get_string() {
+            const auto n = get<std::uint16_t>();
+            need(n);
+            const std::string_view s(reinterpret_cast<const char *>(p_), n);
+            p_ += n;
+            return s;
+        }
+
+        time::Date get_date() { return from_serial(get<std::int32_t>()); }
+
+        // Enum stored as u8, checked against its last enumerator
+        template<typename E>
+        E get_enum(E last) {
+            const auto raw = get<std::uint8_t>();
+            if (raw > static_cast<std::uint8_t>(last)) throw MalformedPayload("enum value out of range");
+            return static_cast<E>(raw);
+        }
+
+        void expect_end() const {
+            if (p_ != end_) throw MalformedPayload("trailing bytes");
+        }
+
+    private:
+        void need(std::size_t n) const {
+            if (static_cast<std::size_t>(end_ - p_) < n) throw MalformedPayload("payload too short");
+        }
+
+        const std::byte *p_;
+        const std::byte *end_;
+    };
+}
+
+#endif //CURVEFORGE_IPC_WIRE_H
@@ -0,0 +1,45 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_METRICS_HISTOGRAM_H
+#define CURVEFORGE_METRICS_HISTOGRAM_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Log-linear (HDR style) bucketing of 64-bit values: every power of two is split into
+// kSubBuckets equal buckets, so a bucket is at most 1/kSubBuckets (12.5%) wide relative to its values.
+namespace curve::metrics::histogram {
+    inline constexpr unsigned kSubBucketBits = 3;
+    inline constexpr std::size_t kSubBuckets = std::size_t{1} << kSubBucketBits;
+    inline constexpr std::size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    constexpr std::size_t bucket_of(std::uint64_t value) {
+        if (value < kSubBuckets) return static_cast<std::size_t>(value);
+        const auto exponent = static_cast<unsigned>(std::bit_width(value)) - 1;
+        return (exponent - kSubBucketBits + 1) * kSubBuckets +
+               static_cast<std::size_t>((value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1));
+    }
+
+    // Smallest value of a bucket
+    constexpr std::uint64_t lower_bound(std::size_t bucket) {
+        if (bucket < kSubBuckets) return bucket;
+        const auto exponent = static_cast<unsigned>(bucket / kSubBuckets) + kSubBucketBits - 1;
+        return (kSubBuckets + bucket % kSubBuckets) << (exponent - kSubBucketBits);
+    }
+
+    // Number of values in a bucket
+    constexpr std::uint64_t width(std::size_t bucket) {
+        if (bucket < kSubBuckets) return 1;
+        const auto exponent = static_cast<unsigned>(bucket / kSubBuckets) + kSubBucketBits - 1;
+        return std::uint64_t{1} << (exponent - kSubBucketBits);
+    }
+
+    static_assert(bucket_of(lower_bound(kBucketCount - 1)) == kBucketCount - 1);
+    static_assert(bucket_of(~std::uint64_t{0}) == kBucketCount - 1);
+    static_assert(bucket_of(lower_bound(100) + width(100) - 1) == 100 && bucket_of(lower_bound(100) + width(100)) == 101);
+}
+
+#endif //CURVEFORGE_METRICS_HISTOGRAM_H
@@ -0,0 +1,167 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_METRICS_METRICS_H
+#define CURVEFORGE_METRICS_METRICS_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CURVEFORGE_METRICS_RDTSC 1
+#elif defined(_M_X64)
+#include <intrin.h>
+#define CURVEFORGE_METRICS_RDTSC 1
+#endif
+
+// Set to 1 by the build with -DCURVEFORGE_ENABLE_METRICS=ON; the CURVEFORGE_* macros below are empty otherwise.
+#ifndef CURVEFORGE_METRICS
+#define CURVEFORGE_METRICS 0
+#endif
+
+namespace curve::metrics {
+    enum class ProbeKind {
+        TIMER, // durations of a scope, reported in nanoseconds
+        COUNTER, // sum of add() amounts
+        HISTOGRAM // distribution of recorded values, e.g. iteration counts
+    };
+
+    // Tick source of timers: rdtsc where available, steady_clock nanoseconds otherwise
+    inline std::uint64_t now_ticks() noexcept {
+#ifdef CURVEFORGE_METRICS_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    /**
+     * @brief One named metric site.
+     *
+     * Construction registers the name once (take a mutex); recording is lock-free: every thread
+     * writes its own cells with relaxed atomics and snapshot() sums them. Probes are meant to be
+     * statics; the first kMaxProbes names are tracked, later ones record nothing.
+     */
+    class Probe {
+    public:
+        static constexpr std::size_t kMaxProbes = 256;
+
+        Probe(std::string_view name, ProbeKind kind);
+
+        Probe(const Probe &) = delete;
+
+        Probe &operator=(const Probe &) = delete;
+
+        // COUNTER: adds `amount`; HISTOGRAM: records `amount` as one value. Never throws: if the
+        // thread's first sample cannot allocate its storage, the sample is dropped
+        void add(std::uint64_t amount = 1) const noexcept;
+
+        // TIMER: records the duration between two now_ticks() readings
+        void record_ticks(std::uint64_t start, std::uint64_t end) const noexcept;
+
+        [[nodiscard]] std::size_t id() const { return id_; }
+
+    private:
+        std::size_t id_;
+    };
+
+    // Times the enclosing scope into a TIMER probe
+    class ScopedTimer {
+    public:
+        explicit ScopedTimer(const Probe &probe) noexcept : probe_(probe), start_(now_ticks()) {
+        }
+
+        ScopedTimer(const ScopedTimer &) = delete;
+
+        ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+        ~ScopedTimer() { probe_.record_ticks(start_, now_ticks()); }
+
+    private:
+        const Probe &probe_;
+        std::uint64_t start_;
+    };
+
+    struct ProbeStats {
+        std::string name;
+        ProbeKind kind = ProbeKind::TIMER;
+        std::uint64_t count = 0; // timed scopes, recorded values or, for counters, add() calls
+        // Timers in nanoseconds, histograms in recorded units; counters only set `total`
+        double total = 0.0;
+        double mean = 0.0;
+        double max = 0.0;
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double p99 = 0.0;
+        double p999 = 0.0;
+        std::vector<std::pair<double, std::uint64_t> > buckets; // non-empty buckets: lower bound, count
+    };
+
+    struct MetricsSnapshot {
+        std::vector<ProbeStats> probes; // in registration order
+        double ticks_per_ns = 1.0;
+
+        [[nodiscard]] const ProbeStats *find(std::string_view name) const;
+    };
+
+    // Sums every thread's cells, including threads that already exited.
+    MetricsSnapshot snapshot();
+
+    // Zeroes all probes. Amounts recorded concurrently with the reset may be lost.
+    void reset();
+
+    /**
+     * Tracing keeps the most recent timer spans per thread (64K each) for write_chrome_trace().
+     * Off by default; it costs one extra store per timed scope while on.
+     */
+    void set_tracing(bool enabled);
+
+    [[nodiscard]] bool tracing();
+
+    void write_json(std::ostream &out, const MetricsSnapshot &snapshot);
+
+    // Chrome trace event format (chrome://tracing, Perfetto). Spans overwritten while
+    // exporting are skipped; export from a quiescent process for a complete trace.
+    void write_chrome_trace(std::ostream &out);
+}
+
+#if CURVEFORGE_METRICS
+#define CURVEFORGE_METRICS_CONCAT_(a, b) a##b
+#define CURVEFORGE_METRICS_CONCAT(a, b) CURVEFORGE_METRICS_CONCAT_(a, b)
+
+// Times the rest of the enclosing scope under `name`
+#define CURVEFORGE_TIME_SCOPE(name)                                                                              \
+    static const ::curve::metrics::Probe CURVEFORGE_METRICS_CONCAT(curveforge_probe_, __LINE__){                 \
+        name, ::curve::metrics::ProbeKind::TIMER};                                                               \
+    const ::curve::metrics::ScopedTimer CURVEFORGE_METRICS_CONCAT(curveforge_timer_, __LINE__) {                 \
+        CURVEFORGE_METRICS_CONCAT(curveforge_probe_, __LINE__)                                                   \
+    }
+
+#define CURVEFORGE_COUNT(name, amount)                                                                           \
+    do {                                                                                                         \
+        static const ::curve::metrics::Probe curveforge_probe_{name, ::curve::metrics::ProbeKind::COUNTER};      \
+        curveforge_probe_.add(amount);                                                                           \
+    } while (false)
+
+#define CURVEFORGE_RECORD_VALUE(name, value)                                                                     \
+    do {                                                                                                         \
+        static const ::curve::metrics::Probe curveforge_probe_{name, ::curve::metrics::ProbeKind::HISTOGRAM};    \
+        curveforge_probe_.add(value);                                                                            \
+    } while (false)
+#else
+// Compiled out: arguments are not evaluated
+#define CURVEFORGE_TIME_SCOPE(name) static_cast<void>(0)
+#define CURVEFORGE_COUNT(name, amount) static_cast<void>(0)
+#define CURVEFORGE_RECORD_VALUE(name, value) static_cast<void>(0)
+#endif
+
+#endif //CURVEFORGE_METRICS_METRICS_H
@@ -0,0 +1,169 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+#include "Registry.h"
+
+namespace curve::metrics {
+    namespace {
+        using namespace detail;
+
+        // Midpoint of the bucket holding the q-quantile, never above the largest value seen
+        double quantile(const Cell &cell, std::uint64_t count, double q) {
+            const auto rank = static_cast<std::uint64_t>(q * static_cast<double>(count - 1));
+            std::uint64_t seen = 0;
+            for (std::size_t b = 0; b < histogram::kBucketCount; ++b) {
+                seen += cell.buckets[b].load(std::memory_order_relaxed);
+                if (seen > rank) {
+                    const double mid = static_cast<double>(histogram::lower_bound(b)) +
+                                       static_cast<double>(histogram::width(b) - 1) / 2.0;
+                    return std::min(mid, static_cast<double>(cell.max.load(std::memory_order_relaxed)));
+                }
+            }
+            return static_cast<double>(cell.max.load(std::memory_order_relaxed));
+        }
+
+        const char *kind_name(ProbeKind kind) {
+            switch (kind) {
+                case ProbeKind::TIMER: return "timer";
+                case ProbeKind::COUNTER: return "counter";
+                case ProbeKind::HISTOGRAM: return "histogram";
+            }
+            return "unknown";
+        }
+
+        void write_string(std::ostream &out, std::string_view s) {
+            out << '"';
+            for (const char c: s) {
+                if (c == '"' || c == '\\') out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20) out << ' ';
+                else out << c;
+            }
+            out << '"';
+        }
+
+        // Emits the readable spans of one thread's ring, oldest first
+        void write_spans(std::ostream &out, const Registry &r, const ThreadBlock &block, double ticks_per_ns,
+                         bool &first) {
+            const auto *events = block.trace.load(std::memory_order_acquire);
+            if (events == nullptr) return;
+            const auto head = block.trace_head.load(std::memory_order_acquire);
+            const auto begin = head > kTraceCapacity ? head - kTraceCapacity : 0;
+            for (auto seq = begin; seq < head; ++seq) {
+                const auto &event = events[seq % kTraceCapacity];
+                if (event.sequence.load(std::memory_order_acquire) != seq) continue;
+                const auto probe = event.probe.load(std::memory_order_relaxed);
+                const auto start = event.start.load(std::memory_order_relaxed);
+                const auto duration = event.duration.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (event.sequence.load(std::memory_order_relaxed) != seq || probe >= r.probe_count) continue;
+
+                const double ts = static_cast<double>(start - std::min(start, r.origin_ticks)) / ticks_per_ns / 1000.0;
+                out << (first ? "\n" : ",\n") << "{\"name\":";
+                write_string(out, r.names[probe]);
+                out << ",\"cat\":\"curveforge\",\"ph\":\"X\",\"ts\":" << ts
+                        << ",\"dur\":" << static_cast<double>(duration) / ticks_per_ns / 1000.0
+                        << ",\"pid\":1,\"tid\":" << block.thread_index << '}';
+                first = false;
+            }
+        }
+    }
+
+    const ProbeStats *MetricsSnapshot::find(std::string_view name) const {
+        const auto it = std::find_if(probes.begin(), probes.end(), [&](const ProbeStats &p) { return p.name == name; });
+        return it == probes.end() ? nullptr : &*it;
+    }
+
+    MetricsSnapshot snapshot() {
+        auto &r = registry();
+        MetricsSnapshot result;
+        result.ticks_per_ns = r.ticks_per_ns();
+
+        std::lock_guard lock(r.mutex);
+        result.probes.reserve(r.probe_count);
+        for (std::size_t id = 0; id < r.probe_count; ++id) {
+            Cell sum;
+            add_cell(sum, *r.retired[id]);
+            for (const auto *block: r.live) {
+                if (const auto *cell = block->cells[id].load(std::memory_order_acquire)) add_cell(sum, *cell);
+            }
+
+            ProbeStats stats;
+            stats.name = r.names[id];
+            stats.kind = r.kinds[id];
+            stats.count = sum.count.load(std::memory_order_relaxed);
+            // Timers record ticks; everything reported for them is converted to nanoseconds
+            const double scale = stats.kind == ProbeKind::TIMER ? 1.0 / result.ticks_per_ns : 1.0;
+            stats.total = static_cast<double>(sum.total.load(std::memory_order_relaxed)) * scale;
+            if (stats.count > 0 && stats.kind != ProbeKind::COUNTER) {
+                stats.mean = stats.total / static_cast<double>(stats.count);
+                stats.max = static_cast<double>(sum.max.load(std::memory_order_relaxed)) * scale;
+                stats.p50 = quantile(sum, stats.count, 0.50) * scale;
+                stats.p90 = quantile(sum, stats.count, 0.90) * scale;
+                stats.p99 = quantile(sum, stats.count, 0.99) * scale;
+                stats.p999 = quantile(sum, stats.count, 0.999) * scale;
+                for (std::size_t b = 0; b < histogram::kBucketCount; ++b) {
+                    if (const auto n = sum.buckets[b].load(std::memory_order_relaxed)) {
+                        stats.buckets.emplace_back(static_cast<double>(histogram::lower_bound(b)) * scale, n);
+                    }
+                }
+            }
+            result.probes.push_back(std::move(stats));
+        }
+        return result;
+    }
+
+    void write_json(std::ostream &out, const MetricsSnapshot &snapshot) {
+        std::ostringstream json;
+        json << std::setprecision(10);
+#ifdef CURVEFORGE_METRICS_RDTSC
+        json << "{\n  \"clock\": \"rdtsc\",\n";
+#else
+        json << "{\n  \"clock\": \"steady_clock\",\n";
+#endif
+        json << "  \"ticks_per_ns\": " << snapshot.ticks_per_ns << ",\n  \"probes\": [";
+        bool first = true;
+        for (const auto &p: snapshot.probes) {
+            json << (first ? "\n" : ",\n") << "    {\"name\": ";
+            write_string(json, p.name);
+            json << ", \"kind\": \"" << kind_name(p.kind) << "\", \"unit\": \""
+                    << (p.kind == ProbeKind::TIMER ? "ns" : "1") << "\", \"count\": " << p.count
+                    << ", \"total\": " << p.total;
+            if (p.kind != ProbeKind::COUNTER) {
+                json << ", \"mean\": " << p.mean << ", \"max\": " << p.max << ", \"p50\": " << p.p50
+                        << ", \"p90\": " << p.p90 << ", \"p99\": " << p.p99 << ", \"p999\": " << p.p999
+                        << ", \"buckets\": [";
+                for (std::size_t i = 0; i < p.buckets.size(); ++i) {
+                    json << (i == 0 ? "" : ", ") << '[' << p.buckets[i].first << ", " << p.buckets[i].second << ']';
+                }
+                json << ']';
+            }
+            json << '}';
+            first = false;
+        }
+        json << (first ? "]\n}\n" : "\n  ]\n}\n");
+        out << json.str();
+    }
+
+    void write_chrome_trace(std::ostream &out) {
+        auto &r = registry();
+        const double ticks_per_ns = r.ticks_per_ns();
+
+        std::ostringstream json;
+        json << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+        bool first = true;
+        {
+            std::lock_guard lock(r.mutex);
+            for (const auto &block: r.retired_traces) write_spans(json, r, *block, ticks_per_ns, first);
+            for (const auto *block: r.live) write_spans(json, r, *block, ticks_per_ns, first);
+        }
+        json << "\n],\"displayTimeUnit\":\"ns\"}\n";
+        out << json.str();
+    }
+}
@@ -0,0 +1,209 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include "Registry.h"
+
+namespace curve::metrics::detail {
+    namespace {
+        std::atomic<bool> g_tracing{false};
+
+        // Owner-thread update: no read-modify-write instruction needed
+        void bump(std::atomic<std::uint64_t> &field, std::uint64_t amount) {
+            field.store(field.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+
+        void raise_to(std::atomic<std::uint64_t> &field, std::uint64_t value) {
+            if (value > field.load(std::memory_order_relaxed)) field.store(value, std::memory_order_relaxed);
+        }
+
+        // Detaches the thread's block when the thread exits
+        struct ThreadHandle {
+            ThreadBlock *block = nullptr;
+
+            ~ThreadHandle() {
+                if (block != nullptr) registry().retire(block);
+            }
+        };
+
+        thread_local ThreadHandle t_handle;
+
+        // The thread's block, attached on first use; null if that failed (retried on the next sample).
+        // Probes record from noexcept paths and destructors, so an allocation failure drops the sample
+        ThreadBlock *local_block() noexcept {
+            if (t_handle.block == nullptr) {
+                try {
+                    t_handle.block = registry().attach();
+                } catch (...) {
+                    return nullptr;
+                }
+            }
+            return t_handle.block;
+        }
+
+        Cell *local_cell(std::size_t id) noexcept {
+            auto *block = local_block();
+            if (block == nullptr) return nullptr;
+            auto &slot = block->cells[id];
+            auto *cell = slot.load(std::memory_order_relaxed);
+            if (cell == nullptr) {
+                cell = new(std::nothrow) Cell;
+                if (cell == nullptr) return nullptr;
+                slot.store(cell, std::memory_order_release);
+            }
+            return cell;
+        }
+
+        void trace(std::size_t id, std::uint64_t start, std::uint64_t duration) noexcept {
+            auto *block = local_block();
+            if (block == nullptr) return;
+            auto *events = block->trace.load(std::memory_order_relaxed);
+            if (events == nullptr) {
+                events = new(std::nothrow) TraceEvent[kTraceCapacity];
+                if (events == nullptr) return;
+                block->trace.store(events, std::memory_order_release);
+            }
+            const auto head = block->trace_head.load(std::memory_order_relaxed);
+            auto &event = events[head % kTraceCapacity];
+            event.sequence.store(kNoSequence, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            event.probe.store(static_cast<std::uint32_t>(id), std::memory_order_relaxed);
+            event.start.store(start, std::memory_order_relaxed);
+            event.duration.store(duration, std::memory_order_relaxed);
+            event.sequence.store(head, std::memory_order_release);
+            block->trace_head.store(head + 1, std::memory_order_release);
+        }
+    }
+
+    void add_cell(Cell &into, const Cell &from) {
+        into.count.fetch_add(from.count.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        into.total.fetch_add(from.total.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        raise_to(into.max, from.max.load(std::memory_order_relaxed));
+        for (std::size_t b = 0; b < histogram::kBucketCount; ++b) {
+            if (const auto n = from.buckets[b].load(std::memory_order_relaxed)) {
+                into.buckets[b].fetch_add(n, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    ThreadBlock::~ThreadBlock() {
+        for (auto &cell: cells) delete cell.load(std::memory_order_relaxed);
+        delete[] trace.load(std::memory_order_relaxed);
+    }
+
+    Registry &registry() {
+        static auto *instance = new Registry; // never destroyed: threads may exit after static destruction
+        return *instance;
+    }
+
+    Registry::Registry()
+        : origin_ticks(now_ticks()), origin_time(std::chrono::steady_clock::now()) {
+    }
+
+    std::size_t Registry::register_probe(std::string_view name, ProbeKind kind) {
+        std::lock_guard lock(mutex);
+        for (std::size_t id = 0; id < probe_count; ++id) {
+            if (names[id] == name) return id;
+        }
+        if (probe_count == Probe::kMaxProbes) return Probe::kMaxProbes;
+        names[probe_count] = std::string(name);
+        kinds[probe_count] = kind;
+        retired[probe_count] = std::make_unique<Cell>();
+        return probe_count++;
+    }
+
+    ThreadBlock *Registry::attach() {
+        auto block = std::make_unique<ThreadBlock>();
+        std::lock_guard lock(mutex);
+        block->thread_index = next_thread_index++;
+        live.push_back(block.get());
+        return block.release();
+    }
+
+    void Registry::retire(ThreadBlock *block) {
+        std::unique_ptr<ThreadBlock> owned(block);
+        std::lock_guard lock(mutex);
+        live.erase(std::remove(live.begin(), live.end(), block), live.end());
+        for (std::size_t id = 0; id < probe_count; ++id) {
+            if (const auto *cell = block->cells[id].load(std::memory_order_acquire)) add_cell(*retired[id], *cell);
+        }
+        if (block->trace.load(std::memory_order_relaxed) != nullptr) {
+            retired_traces.push_back(std::move(owned));
+            if (retired_traces.size() > kMaxRetiredTraces) retired_traces.erase(retired_traces.begin());
+        }
+    }
+
+    double Registry::ticks_per_ns() const {
+#ifdef CURVEFORGE_METRICS_RDTSC
+        // Needs a few milliseconds of history for a stable ratio
+        auto elapsed = std::chrono::steady_clock::now() - origin_time;
+        while (elapsed < std::chrono::milliseconds(20)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20) - elapsed);
+            elapsed = std::chrono::steady_clock::now() - origin_time;
+        }
+        const auto ticks = now_ticks() - origin_ticks;
+        return static_cast<double>(ticks) /
+               static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+#else
+        return 1.0;
+#endif
+    }
+
+    bool tracing_enabled() { return g_tracing.load(std::memory_order_relaxed); }
+
+    void set_tracing_enabled(bool enabled) { g_tracing.store(enabled, std::memory_order_relaxed); }
+}
+
+namespace curve::metrics {
+    using namespace detail;
+
+    Probe::Probe(std::string_view name, ProbeKind kind) : id_(registry().register_probe(name, kind)) {
+    }
+
+    void Probe::add(std::uint64_t amount) const noexcept {
+        if (id_ >= kMaxProbes) return;
+        auto *cell = local_cell(id_);
+        if (cell == nullptr) return;
+        bump(cell->count, 1);
+        bump(cell->total, amount);
+        raise_to(cell->max, amount);
+        bump(cell->buckets[histogram::bucket_of(amount)], 1);
+    }
+
+    void Probe::record_ticks(std::uint64_t start, std::uint64_t end) const noexcept {
+        if (id_ >= kMaxProbes) return;
+        const auto duration = end > start ? end - start : 0;
+        add(duration);
+        if (tracing_enabled()) trace(id_, start, duration);
+    }
+
+    void reset() {
+        auto &r = registry();
+        std::lock_guard lock(r.mutex);
+        const auto zero = [](Cell &cell) {
+            cell.count.store(0, std::memory_order_relaxed);
+            cell.total.store(0, std::memory_order_relaxed);
+            cell.max.store(0, std::memory_order_relaxed);
+            for (auto &b: cell.buckets) b.store(0, std::memory_order_relaxed);
+        };
+        for (std::size_t id = 0; id < r.probe_count; ++id) {
+            zero(*r.retired[id]);
+            for (auto *block: r.live) {
+                if (auto *cell = block->cells[id].load(std::memory_order_acquire)) zero(*cell);
+            }
+        }
+    }
+
+    void set_tracing(bool enabled) { set_tracing_enabled(enabled); }
+
+    bool tracing() { return tracing_enabled(); }
+}
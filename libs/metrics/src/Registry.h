@@ -0,0 +1,91 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_METRICS_REGISTRY_H
+#define CURVEFORGE_METRICS_REGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "metrics/Histogram.h"
+#include "metrics/Metrics.h"
+
+namespace curve::metrics::detail {
+    inline constexpr std::size_t kTraceCapacity = 1 << 16;
+    inline constexpr std::size_t kMaxRetiredTraces = 64;
+    inline constexpr std::uint64_t kNoSequence = std::numeric_limits<std::uint64_t>::max();
+
+    // Per-thread totals of one probe; only the owning thread writes them
+    struct Cell {
+        std::atomic<std::uint64_t> count{0};
+        std::atomic<std::uint64_t> total{0};
+        std::atomic<std::uint64_t> max{0};
+        std::array<std::atomic<std::uint64_t>, histogram::kBucketCount> buckets{};
+    };
+
+    // One timed span; `sequence` tells an exporter whether the slot was rewritten while read
+    struct TraceEvent {
+        std::atomic<std::uint64_t> sequence{kNoSequence};
+        std::atomic<std::uint64_t> start{0};
+        std::atomic<std::uint64_t> duration{0};
+        std::atomic<std::uint32_t> probe{0};
+    };
+
+    struct ThreadBlock {
+        std::uint32_t thread_index = 0;
+        std::array<std::atomic<Cell *>, Probe::kMaxProbes> cells{};
+        std::atomic<TraceEvent *> trace{nullptr}; // ring of kTraceCapacity, allocated on first span
+        std::atomic<std::uint64_t> trace_head{0};
+
+        ThreadBlock() = default;
+
+        ThreadBlock(const ThreadBlock &) = delete;
+
+        ThreadBlock &operator=(const ThreadBlock &) = delete;
+
+        ~ThreadBlock();
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::array<std::string, Probe::kMaxProbes> names;
+        std::array<ProbeKind, Probe::kMaxProbes> kinds{};
+        std::size_t probe_count = 0;
+        std::vector<ThreadBlock *> live;
+        std::array<std::unique_ptr<Cell>, Probe::kMaxProbes> retired; // totals of exited threads
+        std::vector<std::unique_ptr<ThreadBlock> > retired_traces; // exited threads that recorded spans
+        std::uint32_t next_thread_index = 1;
+        std::uint64_t origin_ticks;
+        std::chrono::steady_clock::time_point origin_time;
+
+        Registry();
+
+        std::size_t register_probe(std::string_view name, ProbeKind kind);
+
+        ThreadBlock *attach();
+
+        void retire(ThreadBlock *block);
+
+        [[nodiscard]] double ticks_per_ns() const;
+    };
+
+    Registry &registry();
+
+    void add_cell(Cell &into, const Cell &from);
+
+    bool tracing_enabled();
+
+    void set_tracing_enabled(bool enabled);
+}
+
+#endif //CURVEFORGE_METRICS_REGISTRY_H
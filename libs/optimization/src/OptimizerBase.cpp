@@ -124,10 +124,6 @@ namespace {
             double minf = 0.0;
             nlopt::result result = opt.optimize(x, minf);
 
-            std::cout << "Result code: " << static_cast<int>(result) << "\n";
-            std::cout << "x = " << x[0] << ", y = " << x[1] << "\n";
-            std::cout << "f(x) = " << minf << "\n";
-
             // Build optimal parameters vector (name them x0, x1, ...)
             std::vector<std::pair<std::string, double> > optimal_params;
             for (size_t i = 0; i < x.size(); ++i) {
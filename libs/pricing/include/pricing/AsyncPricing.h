@@ -0,0 +1,39 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_ASYNCPRICING_H
+#define CURVEFORGE_ASYNCPRICING_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "IPricer.h"
+#include "greeks.h"
+#include "tasks/Cancellation.h"
+#include "tasks/Task.h"
+
+namespace curve::pricing {
+    /**
+     * Awaitable counterparts of IPricer::price / compute, run on the shared task pool.
+     *
+     * The pricer and instruments are held by reference and must outlive the returned tasks;
+     * the market data is shared. A cancelled token makes the task throw
+     * tasks::OperationCancelled before pricing (and, for portfolios, between instruments).
+     */
+    tasks::Task<double> price_async(const IPricer &pricer, const instruments::Instrument &instrument,
+                                    std::shared_ptr<market::MarketData> md, tasks::CancellationToken token = {});
+
+    tasks::Task<Greeks> compute_async(const IPricer &pricer, const instruments::Instrument &instrument,
+                                      std::shared_ptr<market::MarketData> md, tasks::CancellationToken token = {});
+
+    // price() of every instrument, in order; chunks of chunk_size instruments run concurrently
+    tasks::Task<std::vector<double> > price_all_async(const IPricer &pricer,
+                                                      std::vector<const instruments::Instrument *> instruments,
+                                                      std::shared_ptr<market::MarketData> md,
+                                                      tasks::CancellationToken token = {},
+                                                      std::size_t chunk_size = 256);
+}
+
+#endif //CURVEFORGE_ASYNCPRICING_H
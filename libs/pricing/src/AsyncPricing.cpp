@@ -0,0 +1,56 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "pricing/AsyncPricing.h"
+
+#include <algorithm>
+
+namespace curve::pricing {
+    namespace {
+        tasks::Task<std::vector<double> > price_chunk(const IPricer &pricer,
+                                                      const std::vector<const instruments::Instrument *> &instruments,
+                                                      std::size_t begin, std::size_t end,
+                                                      const std::shared_ptr<market::MarketData> &md,
+                                                      const tasks::CancellationToken &token) {
+            std::vector<double> prices;
+            prices.reserve(end - begin);
+            for (std::size_t i = begin; i < end; ++i) {
+                token.throw_if_cancelled();
+                prices.push_back(pricer.price(*instruments[i], md));
+            }
+            co_return prices;
+        }
+    }
+
+    tasks::Task<double> price_async(const IPricer &pricer, const instruments::Instrument &instrument,
+                                    std::shared_ptr<market::MarketData> md, tasks::CancellationToken token) {
+        co_await tasks::schedule(token);
+        co_return pricer.price(instrument, md);
+    }
+
+    tasks::Task<Greeks> compute_async(const IPricer &pricer, const instruments::Instrument &instrument,
+                                      std::shared_ptr<market::MarketData> md, tasks::CancellationToken token) {
+        co_await tasks::schedule(token);
+        co_return pricer.compute(instrument, md);
+    }
+
+    tasks::Task<std::vector<double> > price_all_async(const IPricer &pricer,
+                                                      std::vector<const instruments::Instrument *> instruments,
+                                                      std::shared_ptr<market::MarketData> md,
+                                                      tasks::CancellationToken token, std::size_t chunk_size) {
+        chunk_size = std::max<std::size_t>(1, chunk_size);
+        // The chunks borrow instruments, md and token from this frame, which outlives them
+        std::vector<tasks::Task<std::vector<double> > > chunks;
+        for (std::size_t begin = 0; begin < instruments.size(); begin += chunk_size) {
+            chunks.push_back(price_chunk(pricer, instruments, begin, std::min(instruments.size(), begin + chunk_size),
+                                         md, token));
+        }
+        const auto parts = co_await tasks::when_all(std::move(chunks));
+
+        std::vector<double> prices;
+        prices.reserve(instruments.size());
+        for (const auto &part: parts) prices.insert(prices.end(), part.begin(), part.end());
+        co_return prices;
+    }
+}
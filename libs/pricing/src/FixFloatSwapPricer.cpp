@@ -3,6 +3,7 @@
 //
 #include "pricing/FixFloatSwapPricer.h"
 #include "instruments/FixFloatSwap.h"
+#include "metrics/Metrics.h"
 #include <typeinfo>
 
 
@@ -26,6 +27,7 @@ namespace curve::pricing {
 
     double FixFloatSwapPricer::price(const Instrument &instrument,
                                      std::shared_ptr<market::MarketData> md) const {
+        CURVEFORGE_TIME_SCOPE("pricing.fix_float_swap");
         const FixFloatSwap *swap = dynamic_cast<const FixFloatSwap *>(&instrument);
         if (swap == nullptr) { throw std::runtime_error("Instrument is not a FixFloatSwap."); }
 
@@ -4,6 +4,7 @@
 
 #include "pricing/XCSwapPricer.h"
 #include "instruments/XCSwap.h"
+#include "metrics/Metrics.h"
 
 
 namespace curve::pricing {
@@ -23,6 +24,7 @@ namespace curve::pricing {
 
     double XCSwapPricer::price(const instruments::Instrument &instrument,
                                std::shared_ptr<market::MarketData> md) const {
+        CURVEFORGE_TIME_SCOPE("pricing.xc_swap");
         const instruments::XCSwap *swap = dynamic_cast<const instruments::XCSwap *>(&instrument);
         if (swap == nullptr) { throw std::runtime_error("Instrument is not an XCSwap."); }
 
@@ -0,0 +1,68 @@
+// CrossMovingAverageBacktest.h
+// Evaluates a whole (short_period, long_period) grid of CrossMovingAverage strategies
+// in a single pass over the price series.
+
+#ifndef CURVEFORGE_SIGNAL_CROSSMOVINGAVERAGEBACKTEST_H
+#define CURVEFORGE_SIGNAL_CROSSMOVINGAVERAGEBACKTEST_H
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace forge {
+    namespace signal {
+        struct CmaConfig {
+            std::size_t short_period;
+            std::size_t long_period;
+        };
+
+        // Per-configuration result. The strategy is long one unit while short EMA > long EMA,
+        // short one unit while short EMA < long EMA and flat when they are equal; the position
+        // decided at bar t earns price[t+1] - price[t].
+        struct CmaBacktestSummary {
+            CmaConfig config;
+            double pnl; // total PnL in price units
+            double hit_rate; // winning trades / closed trades (0 when no trade was closed)
+            std::size_t trades; // number of closed trades (position changes away from non-flat)
+            std::size_t winning_trades;
+            double max_drawdown; // largest peak-to-trough drop of the cumulative PnL
+        };
+
+        // CrossMovingAverageBacktest: state is kept as structure-of-arrays (one lane per
+        // configuration) so the EMA recursions of all configurations are updated by one
+        // vectorisable loop per bar. Configurations are sharded over up to num_threads tasks of
+        // the shared task scheduler, each shard streaming through the price series once.
+        // Usage:
+        //   CrossMovingAverageBacktest bt(CrossMovingAverageBacktest::make_grid({2,5,10}, {20,50}), 4);
+        //   auto summaries = bt.run(prices);
+        //   CrossMovingAverageBacktest::write_summary_csv(std::cout, summaries);
+        class CrossMovingAverageBacktest {
+        public:
+            explicit CrossMovingAverageBacktest(std::vector<CmaConfig> grid, std::size_t num_threads = 1);
+
+            // Cartesian product of periods keeping only short < long.
+            static std::vector<CmaConfig> make_grid(const std::vector<std::size_t> &short_periods,
+                                                    const std::vector<std::size_t> &long_periods);
+
+            // Run every configuration over prices. Results are in grid order.
+            [[nodiscard]] std::vector<CmaBacktestSummary> run(const std::vector<double> &prices) const;
+
+            // CSV with header short_period,long_period,pnl,hit_rate,trades,winning_trades,max_drawdown
+            static void write_summary_csv(std::ostream &os, const std::vector<CmaBacktestSummary> &summaries);
+
+            // Per-bar trace of one configuration in the sample,short,long,diff layout read by plot_cma.py
+            static void write_trace_csv(std::ostream &os, const std::vector<double> &prices, const CmaConfig &config);
+
+            [[nodiscard]] const std::vector<CmaConfig> &grid() const noexcept { return grid_; }
+
+        private:
+            void run_shard(const std::vector<double> &prices, std::size_t first, std::size_t last,
+                           std::vector<CmaBacktestSummary> &out) const;
+
+            std::vector<CmaConfig> grid_;
+            std::size_t num_threads_;
+        };
+    } // namespace signal
+} // namespace forge
+
+#endif // CURVEFORGE_SIGNAL_CROSSMOVINGAVERAGEBACKTEST_H
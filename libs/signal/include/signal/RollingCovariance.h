@@ -0,0 +1,97 @@
+// RollingCovariance.h
+// Incremental rolling covariance / correlation matrices for many series.
+// Each bar costs O(N^2) (rank-1 add/remove updates of the co-moment matrix) instead
+// of the O(N^2 * w) full recomputation. A full refresh from the stored window is only
+// needed for periodic drift correction.
+
+#ifndef CURVEFORGE_SIGNAL_ROLLINGCOVARIANCE_H
+#define CURVEFORGE_SIGNAL_ROLLINGCOVARIANCE_H
+
+#include <cstddef>
+#include <Eigen/Dense>
+
+namespace forge {
+    namespace signal {
+        // RollingCovariance: maintains the covariance of N return series either over a
+        // trailing window of w bars (rank-1 add of the new bar and rank-1 removal of the
+        // oldest bar) or as an exponentially weighted moving covariance (EWMA).
+        // Usage:
+        //   RollingCovariance cov(n_series, window);
+        //   cov.update(returns);              // one bar, Eigen vector of size n_series
+        //   Eigen::MatrixXd c = cov.covariance();
+        //   Eigen::MatrixXd r = cov.correlation();
+        // For large N the update is split in column blocks processed in parallel.
+        class RollingCovariance {
+        public:
+            enum class Mode {
+                WINDOW, // equally weighted trailing window
+                EWMA // exponentially weighted, decay lambda in (0, 1)
+            };
+
+            // Trailing window covariance. window must be >= 2.
+            // refresh_interval: number of updates between automatic full refreshes (0 disables).
+            // num_threads: blocks updated concurrently on the shared task scheduler (1 -> serial).
+            // block_size: number of matrix columns handled by one parallel block.
+            RollingCovariance(std::size_t n_series, std::size_t window, std::size_t refresh_interval = 0,
+                              std::size_t num_threads = 1, std::size_t block_size = 128);
+
+            // EWMA covariance with decay lambda (0 < lambda < 1), e.g. 0.94 for RiskMetrics daily.
+            static RollingCovariance ewma(std::size_t n_series, double lambda, std::size_t num_threads = 1,
+                                          std::size_t block_size = 128);
+
+            // Reset to empty state.
+            void reset();
+
+            // Push one bar (one observation per series).
+            void update(const Eigen::Ref<const Eigen::VectorXd> &x);
+
+            // Recompute mean and co-moments from the stored window (drift correction).
+            // No-op in EWMA mode, which keeps no window.
+            void refresh();
+
+            // Sample covariance (divides by n-1 in WINDOW mode). Requires ready().
+            [[nodiscard]] Eigen::MatrixXd covariance() const;
+
+            // Correlation matrix derived from covariance(). Zero-variance series get 0 off-diagonal.
+            [[nodiscard]] Eigen::MatrixXd correlation() const;
+
+            // Current mean vector.
+            [[nodiscard]] const Eigen::VectorXd &mean() const noexcept { return mean_; }
+
+            // Number of observations currently contributing (window fill or total EWMA updates).
+            [[nodiscard]] std::size_t count() const noexcept { return count_; }
+
+            // Whether at least two observations are available.
+            [[nodiscard]] bool ready() const noexcept { return count_ >= 2; }
+
+            [[nodiscard]] std::size_t size() const noexcept { return n_; }
+            [[nodiscard]] Mode mode() const noexcept { return mode_; }
+
+        private:
+            RollingCovariance(Mode mode, std::size_t n_series, std::size_t window, double lambda,
+                              std::size_t refresh_interval, std::size_t num_threads, std::size_t block_size);
+
+            // comoment_ += a * u u^T - b * v v^T, split in column blocks across tasks.
+            void blocked_update(const Eigen::VectorXd &u, double a, const Eigen::VectorXd &v, double b,
+                                double scale);
+
+            Mode mode_;
+            std::size_t n_;
+            std::size_t window_;
+            double lambda_;
+            std::size_t refresh_interval_;
+            std::size_t num_threads_;
+            std::size_t block_size_;
+
+            std::size_t count_ = 0;
+            std::size_t head_ = 0; // ring buffer slot of the next bar
+            std::size_t since_refresh_ = 0;
+
+            Eigen::VectorXd mean_;
+            Eigen::MatrixXd comoment_; // sum of (x - mean)(x - mean)^T, or EWMA covariance
+            Eigen::MatrixXd buffer_; // n x window ring buffer (WINDOW mode only)
+        };
+    } // namespace signal
+} // namespace forge
+
+#endif // CURVEFORGE_SIGNAL_ROLLINGCOVARIANCE_H
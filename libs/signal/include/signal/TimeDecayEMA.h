@@ -0,0 +1,133 @@
+// TimeDecayEMA.h
+// Exponential moving averages for irregularly spaced samples (market ticks).
+// The smoothing factor is derived from the elapsed time between samples:
+//   alpha = 1 - exp(-dt / tau)
+// so no resampling to a regular grid is needed.
+
+#ifndef CURVEFORGE_SIGNAL_TIMEDECAYEMA_H
+#define CURVEFORGE_SIGNAL_TIMEDECAYEMA_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "time/instant.h"
+
+namespace forge {
+    namespace signal {
+        // Polynomial exp approximation (range reduction by ln2 and a degree 7 polynomial).
+        // Relative error below 1e-8 on [-700, 700]; returns 0 below that range.
+        double fast_exp(double x) noexcept;
+
+        // How the decay factor exp(-dt/tau) is evaluated.
+        enum class DecayMethod {
+            EXACT, // std::exp every update
+            FAST_EXP, // fast_exp approximation
+            TABLE // precomputed decay per millisecond bucket, fast_exp beyond the table
+        };
+
+        // DecayTable: exp(-k/tau) for k = 0 .. size-1 milliseconds. Immutable, can be shared
+        // between many EMAs with the same time constant.
+        class DecayTable {
+        public:
+            DecayTable(std::chrono::milliseconds tau, std::size_t size = 4096);
+
+            // Decay factor for a gap of dt_ms milliseconds (dt_ms >= 0).
+            [[nodiscard]] double decay(std::int64_t dt_ms) const noexcept {
+                if (static_cast<std::uint64_t>(dt_ms) < table_.size()) return table_[static_cast<std::size_t>(dt_ms)];
+                return fast_exp(-static_cast<double>(dt_ms) * inv_tau_ms_);
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept { return table_.size(); }
+
+        private:
+            double inv_tau_ms_;
+            std::vector<double> table_;
+        };
+
+        // TimeDecayEMA: EMA over (Instant, value) pairs with time constant tau.
+        // Formula: EMA_n = alpha_n * x_n + (1 - alpha_n) * EMA_{n-1}, alpha_n = 1 - exp(-(t_n - t_{n-1}) / tau)
+        // EXACT and FAST_EXP use the elapsed time to the clock's resolution. TABLE looks up whole
+        // milliseconds and carries the sub-millisecond remainder into the next gap, so a burst of
+        // sub-millisecond ticks still decays by the total time it spans. Timestamps must be non-decreasing.
+        class TimeDecayEMA {
+        public:
+            explicit TimeDecayEMA(std::chrono::milliseconds tau, DecayMethod method = DecayMethod::TABLE);
+
+            // Share a precomputed table between EMAs with the same tau.
+            TimeDecayEMA(std::chrono::milliseconds tau, std::shared_ptr<const DecayTable> table);
+
+            // tau from the half-life: tau = half_life / ln 2.
+            static TimeDecayEMA from_half_life(std::chrono::milliseconds half_life,
+                                               DecayMethod method = DecayMethod::TABLE);
+
+            void reset() noexcept {
+                value_.reset();
+                last_time_.reset();
+                carry_ = {};
+            }
+
+            // Update with a sample observed at t and return the updated EMA value.
+            // The first sample seeds the average.
+            double update(const curve::time::Instant &t, double sample);
+
+            double operator()(const curve::time::Instant &t, double sample) { return update(t, sample); }
+
+            // Batch update over timestamped arrays (same length). out receives the EMA after each sample.
+            void update_batch(const std::vector<curve::time::Instant> &times, const std::vector<double> &samples,
+                              std::vector<double> &out);
+
+            [[nodiscard]] std::optional<double> value() const noexcept { return value_; }
+            [[nodiscard]] bool has_value() const noexcept { return value_.has_value(); }
+            [[nodiscard]] std::optional<curve::time::Instant> last_time() const noexcept { return last_time_; }
+            [[nodiscard]] std::chrono::milliseconds tau() const noexcept { return tau_; }
+
+        private:
+            // Decay over `elapsed` (>= 0) plus the TABLE remainder `carry`, which is updated
+            [[nodiscard]] double decay(curve::time::Instant::duration elapsed,
+                                       curve::time::Instant::duration &carry) const noexcept;
+
+            std::chrono::milliseconds tau_;
+            double inv_tau_ms_;
+            DecayMethod method_;
+            std::shared_ptr<const DecayTable> table_;
+            std::optional<double> value_;
+            std::optional<curve::time::Instant> last_time_;
+            curve::time::Instant::duration carry_{}; // TABLE: time since last_time_ - the last gap not yet decayed
+        };
+
+        // TimeDecayCrossMovingAverage: short and long TimeDecayEMA, update returns short - long,
+        // mirroring CrossMovingAverage for irregular ticks.
+        class TimeDecayCrossMovingAverage {
+        public:
+            TimeDecayCrossMovingAverage(std::chrono::milliseconds short_tau, std::chrono::milliseconds long_tau,
+                                        DecayMethod method = DecayMethod::TABLE);
+
+            void reset() noexcept {
+                short_.reset();
+                long_.reset();
+                last_diff_.reset();
+            }
+
+            double update(const curve::time::Instant &t, double sample);
+
+            // Batch update; out receives short - long after each sample.
+            void update_batch(const std::vector<curve::time::Instant> &times, const std::vector<double> &samples,
+                              std::vector<double> &out);
+
+            [[nodiscard]] std::optional<double> short_value() const noexcept { return short_.value(); }
+            [[nodiscard]] std::optional<double> long_value() const noexcept { return long_.value(); }
+            [[nodiscard]] std::optional<double> last_difference() const noexcept { return last_diff_; }
+            [[nodiscard]] bool ready() const noexcept { return short_.has_value() && long_.has_value(); }
+
+        private:
+            TimeDecayEMA short_;
+            TimeDecayEMA long_;
+            std::optional<double> last_diff_;
+        };
+    } // namespace signal
+} // namespace forge
+
+#endif // CURVEFORGE_SIGNAL_TIMEDECAYEMA_H
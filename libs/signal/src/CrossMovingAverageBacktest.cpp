@@ -0,0 +1,135 @@
+// CrossMovingAverageBacktest.cpp
+// Implementation of the grid backtester declared in CrossMovingAverageBacktest.h
+
+#include "signal/CrossMovingAverageBacktest.h"
+#include "signal/CrossMovingAverage.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+
+#include "tasks/Parallel.h"
+
+namespace forge {
+    namespace signal {
+        namespace {
+            double alpha_from_period(std::size_t period) {
+                if (period < 1) throw std::invalid_argument("CMA period must be >= 1.");
+                return 2.0 / (static_cast<double>(period) + 1.0);
+            }
+        }
+
+        CrossMovingAverageBacktest::CrossMovingAverageBacktest(std::vector<CmaConfig> grid, std::size_t num_threads)
+            : grid_(std::move(grid)), num_threads_(std::max<std::size_t>(1, num_threads)) {
+            for (const auto &c: grid_) {
+                alpha_from_period(c.short_period);
+                alpha_from_period(c.long_period);
+            }
+        }
+
+        std::vector<CmaConfig> CrossMovingAverageBacktest::make_grid(const std::vector<std::size_t> &short_periods,
+                                                                     const std::vector<std::size_t> &long_periods) {
+            std::vector<CmaConfig> grid;
+            grid.reserve(short_periods.size() * long_periods.size());
+            for (auto s: short_periods) {
+                for (auto l: long_periods) {
+                    if (s < l) grid.push_back({s, l});
+                }
+            }
+            return grid;
+        }
+
+        void CrossMovingAverageBacktest::run_shard(const std::vector<double> &prices, std::size_t first,
+                                                   std::size_t last, std::vector<CmaBacktestSummary> &out) const {
+            const std::size_t k = last - first;
+            if (k == 0 || prices.empty()) return;
+
+            // Structure-of-arrays state, one lane per configuration.
+            std::vector<double> a_s(k), a_l(k), ema_s(k), ema_l(k);
+            std::vector<double> pos(k, 0.0), pnl(k, 0.0), trade_pnl(k, 0.0), peak(k, 0.0), max_dd(k, 0.0);
+            std::vector<std::size_t> trades(k, 0), wins(k, 0);
+            for (std::size_t j = 0; j < k; ++j) {
+                a_s[j] = alpha_from_period(grid_[first + j].short_period);
+                a_l[j] = alpha_from_period(grid_[first + j].long_period);
+                ema_s[j] = prices.front();
+                ema_l[j] = prices.front();
+            }
+
+            double prev = prices.front();
+            for (std::size_t t = 1; t < prices.size(); ++t) {
+                const double p = prices[t];
+                const double dp = p - prev;
+                prev = p;
+
+                // Mark-to-market the positions decided on the previous bar, then update the EMAs.
+                // Branch-free so the compiler can vectorise across lanes.
+                for (std::size_t j = 0; j < k; ++j) {
+                    const double gain = pos[j] * dp;
+                    pnl[j] += gain;
+                    trade_pnl[j] += gain;
+                    peak[j] = std::max(peak[j], pnl[j]);
+                    max_dd[j] = std::max(max_dd[j], peak[j] - pnl[j]);
+                    ema_s[j] = a_s[j] * p + (1.0 - a_s[j]) * ema_s[j];
+                    ema_l[j] = a_l[j] * p + (1.0 - a_l[j]) * ema_l[j];
+                }
+
+                // New target positions; close trades whose position changed.
+                for (std::size_t j = 0; j < k; ++j) {
+                    const double diff = ema_s[j] - ema_l[j];
+                    const double target = diff > 0.0 ? 1.0 : (diff < 0.0 ? -1.0 : 0.0);
+                    if (target != pos[j]) {
+                        if (pos[j] != 0.0) {
+                            ++trades[j];
+                            if (trade_pnl[j] > 0.0) ++wins[j];
+                        }
+                        trade_pnl[j] = 0.0;
+                        pos[j] = target;
+                    }
+                }
+            }
+
+            for (std::size_t j = 0; j < k; ++j) {
+                const double hit = trades[j] > 0 ? static_cast<double>(wins[j]) / static_cast<double>(trades[j]) : 0.0;
+                out[first + j] = CmaBacktestSummary{grid_[first + j], pnl[j], hit, trades[j], wins[j], max_dd[j]};
+            }
+        }
+
+        std::vector<CmaBacktestSummary> CrossMovingAverageBacktest::run(const std::vector<double> &prices) const {
+            std::vector<CmaBacktestSummary> out(grid_.size());
+            const std::size_t shards = std::min(num_threads_, grid_.size());
+            if (shards <= 1) {
+                run_shard(prices, 0, grid_.size(), out);
+                return out;
+            }
+
+            // Contiguous shards keep each thread's lanes in its own cache lines.
+            const std::size_t per_shard = (grid_.size() + shards - 1) / shards;
+            curve::tasks::parallel_for_bounded(shards, shards, [&](std::size_t shard) {
+                const std::size_t first = shard * per_shard;
+                if (first < grid_.size()) run_shard(prices, first, std::min(grid_.size(), first + per_shard), out);
+            });
+            return out;
+        }
+
+        void CrossMovingAverageBacktest::write_summary_csv(std::ostream &os,
+                                                           const std::vector<CmaBacktestSummary> &summaries) {
+            os << "short_period,long_period,pnl,hit_rate,trades,winning_trades,max_drawdown\n";
+            os << std::fixed << std::setprecision(12);
+            for (const auto &s: summaries) {
+                os << s.config.short_period << ',' << s.config.long_period << ',' << s.pnl << ',' << s.hit_rate << ','
+                        << s.trades << ',' << s.winning_trades << ',' << s.max_drawdown << '\n';
+            }
+        }
+
+        void CrossMovingAverageBacktest::write_trace_csv(std::ostream &os, const std::vector<double> &prices,
+                                                         const CmaConfig &config) {
+            CrossMovingAverage cma(config.short_period, config.long_period);
+            os << "sample,short,long,diff\n";
+            os << std::fixed << std::setprecision(12);
+            for (double x: prices) {
+                const double diff = cma.update(x);
+                os << x << ',' << *cma.short_value() << ',' << *cma.long_value() << ',' << diff << '\n';
+            }
+        }
+    } // namespace signal
+} // namespace forge
@@ -0,0 +1,156 @@
+// RollingCovariance.cpp
+// Implementation of the incremental rolling covariance declared in RollingCovariance.h
+
+#include "signal/RollingCovariance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "tasks/Parallel.h"
+
+namespace forge {
+    namespace signal {
+        RollingCovariance::RollingCovariance(std::size_t n_series, std::size_t window, std::size_t refresh_interval,
+                                             std::size_t num_threads, std::size_t block_size)
+            : RollingCovariance(Mode::WINDOW, n_series, window, 0.0, refresh_interval, num_threads, block_size) {
+        }
+
+        RollingCovariance RollingCovariance::ewma(std::size_t n_series, double lambda, std::size_t num_threads,
+                                                  std::size_t block_size) {
+            if (!(lambda > 0.0 && lambda < 1.0)) {
+                throw std::invalid_argument("EWMA lambda must be in (0, 1).");
+            }
+            return RollingCovariance(Mode::EWMA, n_series, 0, lambda, 0, num_threads, block_size);
+        }
+
+        RollingCovariance::RollingCovariance(Mode mode, std::size_t n_series, std::size_t window, double lambda,
+                                             std::size_t refresh_interval, std::size_t num_threads,
+                                             std::size_t block_size)
+            : mode_(mode), n_(n_series), window_(window), lambda_(lambda), refresh_interval_(refresh_interval),
+              num_threads_(std::max<std::size_t>(1, num_threads)), block_size_(std::max<std::size_t>(1, block_size)) {
+            if (n_ == 0) {
+                throw std::invalid_argument("RollingCovariance needs at least one series.");
+            }
+            if (mode_ == Mode::WINDOW && window_ < 2) {
+                throw std::invalid_argument("RollingCovariance window must be >= 2.");
+            }
+            reset();
+        }
+
+        void RollingCovariance::reset() {
+            count_ = 0;
+            head_ = 0;
+            since_refresh_ = 0;
+            mean_ = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(n_));
+            comoment_ = Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(n_), static_cast<Eigen::Index>(n_));
+            if (mode_ == Mode::WINDOW) {
+                buffer_ = Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(n_), static_cast<Eigen::Index>(window_));
+            }
+        }
+
+        void RollingCovariance::blocked_update(const Eigen::VectorXd &u, double a, const Eigen::VectorXd &v,
+                                               double b, double scale) {
+            const auto n = static_cast<Eigen::Index>(n_);
+            const auto bs = static_cast<Eigen::Index>(block_size_);
+            const Eigen::Index num_blocks = (n + bs - 1) / bs;
+
+            // One pass over a block of columns: C[:, j0:j1] = scale * C + a u u^T - b v v^T
+            auto run_block = [&](Eigen::Index blk) {
+                const Eigen::Index j0 = blk * bs;
+                const Eigen::Index cols = std::min(bs, n - j0);
+                auto block = comoment_.middleCols(j0, cols);
+                if (scale != 1.0) block *= scale;
+                block.noalias() += (a * u) * u.segment(j0, cols).transpose();
+                if (b != 0.0) block.noalias() -= (b * v) * v.segment(j0, cols).transpose();
+            };
+
+            const auto threads = static_cast<Eigen::Index>(std::min<std::size_t>(num_threads_, num_blocks));
+            if (threads <= 1) {
+                for (Eigen::Index blk = 0; blk < num_blocks; ++blk) run_block(blk);
+                return;
+            }
+
+            // Column blocks are disjoint, so tasks never write the same memory.
+            curve::tasks::parallel_for_bounded(static_cast<std::size_t>(num_blocks), static_cast<std::size_t>(threads),
+                                               [&](std::size_t blk) { run_block(static_cast<Eigen::Index>(blk)); });
+        }
+
+        void RollingCovariance::update(const Eigen::Ref<const Eigen::VectorXd> &x) {
+            if (static_cast<std::size_t>(x.size()) != n_) {
+                throw std::invalid_argument("RollingCovariance::update: sample size does not match series count.");
+            }
+
+            if (mode_ == Mode::EWMA) {
+                if (count_ == 0) {
+                    mean_ = x;
+                    ++count_;
+                    return;
+                }
+                // West/Finch incremental EWMA: S = lambda * (S + (1 - lambda) d d^T), d = x - mean_old
+                const Eigen::VectorXd d = x - mean_;
+                mean_.noalias() += (1.0 - lambda_) * d;
+                blocked_update(d, lambda_ * (1.0 - lambda_), d, 0.0, lambda_);
+                ++count_;
+                return;
+            }
+
+            const auto slot = static_cast<Eigen::Index>(head_);
+            if (count_ < window_) {
+                // Growing phase: rank-1 add (Welford). C += (n-1)/n * d d^T
+                ++count_;
+                const double n = static_cast<double>(count_);
+                const Eigen::VectorXd d = x - mean_;
+                mean_.noalias() += d / n;
+                if (count_ > 1) blocked_update(d, (n - 1.0) / n, d, 0.0, 1.0);
+            } else {
+                // Full window: remove the oldest bar then add the new one, fused in one pass.
+                const double n = static_cast<double>(window_);
+                const Eigen::VectorXd dy = buffer_.col(slot) - mean_;
+                const Eigen::VectorXd m1 = mean_ - dy / (n - 1.0);
+                const Eigen::VectorXd dx = x - m1;
+                mean_ = m1 + dx / n;
+                blocked_update(dx, (n - 1.0) / n, dy, n / (n - 1.0), 1.0);
+            }
+            buffer_.col(slot) = x;
+            head_ = (head_ + 1) % window_;
+
+            if (refresh_interval_ > 0 && ++since_refresh_ >= refresh_interval_) {
+                refresh();
+            }
+        }
+
+        void RollingCovariance::refresh() {
+            since_refresh_ = 0;
+            if (mode_ == Mode::EWMA || count_ == 0) {
+                return;
+            }
+            // Valid columns are the first count_ slots while filling, the whole buffer once full.
+            const auto m = static_cast<Eigen::Index>(count_);
+            const auto samples = buffer_.leftCols(m);
+            mean_ = samples.rowwise().mean();
+            const Eigen::MatrixXd centered = samples.colwise() - mean_;
+            comoment_.noalias() = centered * centered.transpose();
+        }
+
+        Eigen::MatrixXd RollingCovariance::covariance() const {
+            if (!ready()) {
+                throw std::runtime_error("RollingCovariance needs at least two observations.");
+            }
+            if (mode_ == Mode::EWMA) {
+                return comoment_;
+            }
+            return comoment_ / static_cast<double>(count_ - 1);
+        }
+
+        Eigen::MatrixXd RollingCovariance::correlation() const {
+            Eigen::MatrixXd c = covariance();
+            const Eigen::VectorXd sd = c.diagonal().cwiseMax(0.0).cwiseSqrt();
+            const Eigen::VectorXd inv = sd.unaryExpr([](double s) { return s > 0.0 ? 1.0 / s : 0.0; });
+            c = inv.asDiagonal() * c * inv.asDiagonal();
+            for (Eigen::Index i = 0; i < c.rows(); ++i) c(i, i) = sd(i) > 0.0 ? 1.0 : 0.0;
+            return c;
+        }
+    } // namespace signal
+} // namespace forge
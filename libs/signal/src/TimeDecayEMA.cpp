@@ -0,0 +1,146 @@
+// TimeDecayEMA.cpp
+// Implementations for the irregular-timestamp EMA family declared in TimeDecayEMA.h
+
+#include "signal/TimeDecayEMA.h"
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+namespace forge {
+    namespace signal {
+        double fast_exp(double x) noexcept {
+            if (x < -708.0) return 0.0;
+            if (x > 709.0) return std::numeric_limits<double>::infinity();
+
+            // x = k ln2 + r, |r| <= ln2 / 2 ; ln2 split in hi/lo parts to keep r accurate
+            constexpr double LN2_HI = 6.93147180369123816490e-01;
+            constexpr double LN2_LO = 1.90821492927058770002e-10;
+            const double k = std::nearbyint(x * std::numbers::log2e);
+            const double r = (x - k * LN2_HI) - k * LN2_LO;
+
+            // Taylor polynomial of degree 7 in Horner form
+            const double p = 1.0 + r * (1.0 + r * (1.0 / 2.0 + r * (1.0 / 6.0 + r * (1.0 / 24.0 + r * (
+                                                                 1.0 / 120.0 + r * (1.0 / 720.0 + r / 5040.0))))));
+
+            // 2^k assembled directly in the exponent bits
+            const auto bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(k) + 1023) << 52;
+            return p * std::bit_cast<double>(bits);
+        }
+
+        DecayTable::DecayTable(std::chrono::milliseconds tau, std::size_t size) {
+            if (tau.count() <= 0) throw std::invalid_argument("DecayTable tau must be positive.");
+            inv_tau_ms_ = 1.0 / static_cast<double>(tau.count());
+            table_.resize(std::max<std::size_t>(1, size));
+            for (std::size_t k = 0; k < table_.size(); ++k) {
+                table_[k] = std::exp(-static_cast<double>(k) * inv_tau_ms_);
+            }
+        }
+
+        TimeDecayEMA::TimeDecayEMA(std::chrono::milliseconds tau, DecayMethod method)
+            : tau_(tau), inv_tau_ms_(0.0), method_(method) {
+            if (tau_.count() <= 0) throw std::invalid_argument("TimeDecayEMA tau must be positive.");
+            inv_tau_ms_ = 1.0 / static_cast<double>(tau_.count());
+            if (method_ == DecayMethod::TABLE) table_ = std::make_shared<const DecayTable>(tau_);
+        }
+
+        TimeDecayEMA::TimeDecayEMA(std::chrono::milliseconds tau, std::shared_ptr<const DecayTable> table)
+            : tau_(tau), inv_tau_ms_(0.0), method_(DecayMethod::TABLE), table_(std::move(table)) {
+            if (tau_.count() <= 0) throw std::invalid_argument("TimeDecayEMA tau must be positive.");
+            if (!table_) throw std::invalid_argument("TimeDecayEMA needs a decay table.");
+            inv_tau_ms_ = 1.0 / static_cast<double>(tau_.count());
+        }
+
+        TimeDecayEMA TimeDecayEMA::from_half_life(std::chrono::milliseconds half_life, DecayMethod method) {
+            const auto tau_ms = static_cast<double>(half_life.count()) / std::numbers::ln2;
+            return TimeDecayEMA(std::chrono::milliseconds(static_cast<std::int64_t>(std::llround(tau_ms))), method);
+        }
+
+        double TimeDecayEMA::decay(curve::time::Instant::duration elapsed,
+                                   curve::time::Instant::duration &carry) const noexcept {
+            switch (method_) {
+                case DecayMethod::TABLE: {
+                    const auto total = elapsed + carry;
+                    const auto whole = std::chrono::floor<std::chrono::milliseconds>(total);
+                    carry = total - whole;
+                    return table_->decay(whole.count());
+                }
+                case DecayMethod::FAST_EXP:
+                    return fast_exp(-std::chrono::duration<double, std::milli>(elapsed).count() * inv_tau_ms_);
+                case DecayMethod::EXACT:
+                default:
+                    return std::exp(-std::chrono::duration<double, std::milli>(elapsed).count() * inv_tau_ms_);
+            }
+        }
+
+        double TimeDecayEMA::update(const curve::time::Instant &t, double sample) {
+            if (!value_.has_value()) {
+                value_ = sample;
+                last_time_ = t;
+                carry_ = {};
+                return sample;
+            }
+            if (t < *last_time_) throw std::invalid_argument("TimeDecayEMA: timestamps must be non-decreasing.");
+            const double d = decay(t - *last_time_, carry_);
+            value_ = sample + d * (*value_ - sample); // alpha * x + (1 - alpha) * ema with alpha = 1 - d
+            last_time_ = t;
+            return *value_;
+        }
+
+        void TimeDecayEMA::update_batch(const std::vector<curve::time::Instant> &times,
+                                        const std::vector<double> &samples, std::vector<double> &out) {
+            if (times.size() != samples.size()) {
+                throw std::invalid_argument("TimeDecayEMA::update_batch: times and samples differ in size.");
+            }
+            out.resize(samples.size());
+            if (samples.empty()) return;
+
+            std::size_t i = 0;
+            if (!value_.has_value()) {
+                out[0] = update(times[0], samples[0]);
+                i = 1;
+            }
+            // Keep the state in registers for the whole batch.
+            double v = *value_;
+            auto last = *last_time_;
+            auto carry = carry_;
+            for (; i < samples.size(); ++i) {
+                if (times[i] < last) {
+                    value_ = v;
+                    last_time_ = last;
+                    carry_ = carry;
+                    throw std::invalid_argument("TimeDecayEMA: timestamps must be non-decreasing.");
+                }
+                v = samples[i] + decay(times[i] - last, carry) * (v - samples[i]);
+                last = times[i];
+                out[i] = v;
+            }
+            value_ = v;
+            last_time_ = last;
+            carry_ = carry;
+        }
+
+        TimeDecayCrossMovingAverage::TimeDecayCrossMovingAverage(std::chrono::milliseconds short_tau,
+                                                                 std::chrono::milliseconds long_tau,
+                                                                 DecayMethod method)
+            : short_(short_tau, method), long_(long_tau, method) {
+        }
+
+        double TimeDecayCrossMovingAverage::update(const curve::time::Instant &t, double sample) {
+            const double diff = short_.update(t, sample) - long_.update(t, sample);
+            last_diff_ = diff;
+            return diff;
+        }
+
+        void TimeDecayCrossMovingAverage::update_batch(const std::vector<curve::time::Instant> &times,
+                                                       const std::vector<double> &samples, std::vector<double> &out) {
+            std::vector<double> long_values;
+            short_.update_batch(times, samples, out);
+            long_.update_batch(times, samples, long_values);
+            for (std::size_t i = 0; i < out.size(); ++i) out[i] -= long_values[i];
+            if (!out.empty()) last_diff_ = out.back();
+        }
+    } // namespace signal
+} // namespace forge
@@ -0,0 +1,125 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_SYNTHETIC_GENERATORS_H
+#define CURVEFORGE_SYNTHETIC_GENERATORS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "io/PortfolioRecords.h"
+#include "io/SnapshotRecords.h"
+#include "time/date.hpp"
+
+/**
+ * Deterministic synthetic portfolios and markets for load tests and benchmarks.
+ *
+ * Everything is a pure function of the seed (and, for trades, of the trade index), so a 1M trade
+ * book can be streamed without holding it and regenerated bit for bit on another machine.
+ * Output is plain io records, ready for the XML writers, the binary snapshot and the quote history.
+ */
+namespace curve::synthetic {
+    // Market conventions and rate levels of one currency
+    struct CurrencyProfile {
+        std::string_view currency;
+        std::string_view calendar; // io::calendar_of() code
+        std::string_view ois_index;
+        std::string_view ibor_index;
+        std::string_view float_tenor; // of the generated swaps and the projection curve
+        double short_rate; // zero rate level at the short end
+        double long_rate; // and at 30Y
+        double weight; // share of generated trades
+    };
+
+    // Currencies known to instruments::StaticDataCache::conventions()
+    std::span<const CurrencyProfile> currency_profiles();
+
+    const CurrencyProfile &currency_profile(std::string_view currency);
+
+    struct MarketOptions {
+        std::uint64_t seed = 1;
+        time::Date as_of{std::chrono::year{2026}, std::chrono::February, std::chrono::day{10}};
+        std::vector<std::string> currencies; // empty: all profiles
+        std::size_t underlyings = 20; // vol surfaces and option chains
+    };
+
+    // One OIS (OIS_ZERO) and one IBOR projection (ZERO_RATE) curve per currency
+    std::vector<io::YieldCurveRecord> generate_yield_curves(const MarketOptions &options);
+
+    struct OptionQuoteRecord {
+        std::string expiry; // tenor, e.g. "6M"
+        double maturity = 0.0; // years
+        double strike = 0.0;
+        bool is_call = true;
+        double volatility = 0.0; // from the generating smile
+        double price = 0.0; // Black-Scholes at that volatility
+    };
+
+    struct OptionChain {
+        std::string underlying_id;
+        double spot = 0.0;
+        double rate = 0.0;
+        std::vector<OptionQuoteRecord> options;
+    };
+
+    /**
+     * Equity-like option chains: a term structure of ATM vols with a skewed, convex smile in
+     * log-moneyness. The matching surfaces carry the same vols at the same (expiry, strike) grid.
+     */
+    std::vector<OptionChain> generate_option_chains(const MarketOptions &options);
+
+    std::vector<io::VolSurfaceRecord> vol_surfaces(const std::vector<OptionChain> &chains, const time::Date &as_of);
+
+    // Option chains as BID/ASK PRICE quotes; instrument ids look like "EQ0003-6M-C-105"
+    io::QuoteSetRecord option_quote_set(const std::vector<OptionChain> &chains, const time::Date &as_of);
+
+    // Curves, surfaces, a par swap quote set and the option chains quote set
+    io::SnapshotData generate_snapshot(const MarketOptions &options);
+
+    struct QuoteHistoryOptions {
+        std::size_t days = 20; // business days (weekends skipped) ending at MarketOptions::as_of
+        std::size_t ticks_per_day = 50; // quotes per instrument and day
+    };
+
+    /**
+     * Intraday par swap quotes ("EUR-SWAP-5Y", ...) following a random walk, one quote set per
+     * day, handed to `sink` in date order (e.g. QuoteHistoryWriter::append). Returns the number
+     * of quotes produced.
+     */
+    std::size_t generate_quote_history(const MarketOptions &market, const QuoteHistoryOptions &options,
+                                       const std::function<void(const io::QuoteSetRecord &)> &sink);
+
+    struct PortfolioOptions {
+        std::uint64_t seed = 1;
+        time::Date as_of{std::chrono::year{2026}, std::chrono::February, std::chrono::day{10}};
+        std::vector<std::string> currencies; // empty: all profiles, drawn by weight
+        double forward_start_share = 0.2;
+    };
+
+    /**
+     * Vanilla IRSwap trades as portfolio.xsd records: cashflows hold the unadjusted float payment
+     * dates, which is what PortfolioLoader rebuilds the legs from. trade(i) depends only on the
+     * options and i.
+     */
+    class SwapGenerator {
+    public:
+        explicit SwapGenerator(PortfolioOptions options);
+
+        [[nodiscard]] io::TradeRecord trade(std::size_t i) const;
+
+        [[nodiscard]] std::vector<io::TradeRecord> trades(std::size_t count) const;
+
+    private:
+        PortfolioOptions options_;
+        std::vector<const CurrencyProfile *> profiles_;
+        std::vector<double> weights_;
+    };
+}
+
+#endif //CURVEFORGE_SYNTHETIC_GENERATORS_H
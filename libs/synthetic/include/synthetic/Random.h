@@ -0,0 +1,106 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_SYNTHETIC_RANDOM_H
+#define CURVEFORGE_SYNTHETIC_RANDOM_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace curve::synthetic {
+    /**
+     * @brief Seeded xoshiro256** generator with its own distributions.
+     *
+     * std:: distributions are implementation defined, so datasets built on them differ between
+     * standard libraries; everything here is specified bit for bit. Independent streams come from
+     * stream(seed, domain, index): trade i of a book is the same whatever the book size or the
+     * order of generation.
+     */
+    class Rng {
+    public:
+        explicit Rng(std::uint64_t seed) noexcept {
+            for (auto &s: state_) s = splitmix(seed);
+        }
+
+        static Rng stream(std::uint64_t seed, std::string_view domain, std::uint64_t index = 0) noexcept {
+            std::uint64_t h = 0xcbf29ce484222325ull; // FNV-1a of the domain name
+            for (const char c: domain) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+            std::uint64_t mix = seed ^ h;
+            mix = splitmix(mix) ^ index;
+            return Rng(splitmix(mix));
+        }
+
+        std::uint64_t next() noexcept {
+            const auto result = rotl(state_[1] * 5, 7) * 9;
+            const auto t = state_[1] << 17;
+            state_[2] ^= state_[0];
+            state_[3] ^= state_[1];
+            state_[1] ^= state_[2];
+            state_[0] ^= state_[3];
+            state_[2] ^= t;
+            state_[3] = rotl(state_[3], 45);
+            return result;
+        }
+
+        // [0, 1) with 53 random bits
+        double uniform() noexcept { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+        double uniform(double lo, double hi) noexcept { return lo + (hi - lo) * uniform(); }
+
+        // [0, n), n > 0
+        std::size_t index(std::size_t n) noexcept {
+            const auto i = static_cast<std::size_t>(uniform() * static_cast<double>(n));
+            return i < n ? i : n - 1;
+        }
+
+        bool chance(double p) noexcept { return uniform() < p; }
+
+        // Standard normal (Box-Muller, one draw per call)
+        double normal() noexcept {
+            const double u1 = 1.0 - uniform(); // (0, 1]
+            const double u2 = uniform();
+            return std::sqrt(-2.0 * std::log(u1)) * std::cos(2.0 * std::numbers::pi * u2);
+        }
+
+        double normal(double mean, double sd) noexcept { return mean + sd * normal(); }
+
+        // Index drawn with the given non-negative weights
+        std::size_t weighted(std::span<const double> weights) noexcept {
+            double total = 0.0;
+            for (const double w: weights) total += w;
+            double x = uniform() * total;
+            for (std::size_t i = 0; i + 1 < weights.size(); ++i) {
+                if (x < weights[i]) return i;
+                x -= weights[i];
+            }
+            return weights.size() - 1;
+        }
+
+    private:
+        static std::uint64_t splitmix(std::uint64_t &x) noexcept {
+            std::uint64_t z = x += 0x9e3779b97f4a7c15ull;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            return z ^ (z >> 31);
+        }
+
+        static std::uint64_t rotl(std::uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+
+        std::uint64_t state_[4];
+    };
+
+    // Decimal n, left-padded with zeros to at least `width` digits: generated ids sort like their index
+    inline std::string zero_padded(std::size_t n, std::size_t width) {
+        auto digits = std::to_string(n);
+        if (digits.size() < width) digits.insert(0, width - digits.size(), '0');
+        return digits;
+    }
+}
+
+#endif //CURVEFORGE_SYNTHETIC_RANDOM_H
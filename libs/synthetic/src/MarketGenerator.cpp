@@ -0,0 +1,335 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "synthetic/Generators.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+#include "analytical_pricers/BlackScholes.h"
+#include "synthetic/Random.h"
+
+namespace curve::synthetic {
+    namespace {
+        using namespace std::chrono;
+
+        constexpr std::array<CurrencyProfile, 9> kProfiles{
+            {
+                {"EUR", "EURONEXT", "ESTR", "EURIBOR", "6M", 0.0200, 0.0260, 0.28},
+                {"USD", "NYSE", "SOFR", "TERM-SOFR", "3M", 0.0430, 0.0410, 0.30},
+                {"GBP", "LSE", "SONIA", "TERM-SONIA", "6M", 0.0450, 0.0430, 0.12},
+                {"JPY", "TSE", "TONA", "TIBOR", "6M", 0.0040, 0.0180, 0.10},
+                {"HKD", "HKEX", "HONIA", "HIBOR", "3M", 0.0400, 0.0360, 0.04},
+                {"CNY", "SSE", "CNYOIS", "SHIBOR", "3M", 0.0160, 0.0210, 0.04},
+                {"AUD", "ASX", "AONIA", "BBSW", "6M", 0.0410, 0.0440, 0.05},
+                {"CAD", "TSX", "CORRA", "TERM-CORRA", "3M", 0.0280, 0.0330, 0.04},
+                {"INR", "NSE", "MIBOR-OIS", "MIBOR", "6M", 0.0650, 0.0680, 0.03},
+            }
+        };
+
+        struct Tenor {
+            std::string_view label;
+            double years;
+        };
+
+        constexpr std::array<Tenor, 12> kCurveTenors{
+            {
+                {"1M", 1.0 / 12}, {"3M", 0.25}, {"6M", 0.5}, {"1Y", 1}, {"2Y", 2}, {"3Y", 3}, {"5Y", 5}, {"7Y", 7},
+                {"10Y", 10}, {"15Y", 15}, {"20Y", 20}, {"30Y", 30}
+            }
+        };
+        constexpr std::array<std::string_view, 5> kSwapQuoteTenors{"1Y", "2Y", "5Y", "10Y", "30Y"};
+        constexpr std::array<Tenor, 5> kOptionExpiries{{{"1M", 1.0 / 12}, {"3M", 0.25}, {"6M", 0.5}, {"1Y", 1}, {"2Y", 2}}};
+        constexpr std::array<double, 9> kMoneyness{0.7, 0.8, 0.9, 0.95, 1.0, 1.05, 1.1, 1.2, 1.3};
+
+        std::vector<const CurrencyProfile *> selected(const std::vector<std::string> &currencies) {
+            std::vector<const CurrencyProfile *> profiles;
+            if (currencies.empty()) {
+                for (const auto &p: kProfiles) profiles.push_back(&p);
+            } else {
+                for (const auto &c: currencies) profiles.push_back(&currency_profile(c));
+            }
+            return profiles;
+        }
+
+        // Nelson-Siegel zero curve
+        struct ZeroCurveShape {
+            double beta0, beta1, beta2, tau;
+
+            [[nodiscard]] double operator()(double t) const {
+                const double x = t / tau;
+                const double loading = (1.0 - std::exp(-x)) / x;
+                return beta0 + beta1 * loading + beta2 * (loading - std::exp(-x));
+            }
+        };
+
+        ZeroCurveShape zero_shape(std::uint64_t seed, const CurrencyProfile &p) {
+            auto rng = Rng::stream(seed, "curve." + std::string(p.currency));
+            return {
+                p.long_rate + rng.normal(0.0, 0.002), p.short_rate - p.long_rate + rng.normal(0.0, 0.002),
+                rng.normal(0.0, 0.01), rng.uniform(1.0, 3.0)
+            };
+        }
+
+        double basis_spread(std::uint64_t seed, const CurrencyProfile &p) {
+            return Rng::stream(seed, "basis." + std::string(p.currency)).uniform(0.0008, 0.0030);
+        }
+
+        // Rounds to a multiple of step; decimal steps divide by an exact power of ten so the
+        // result prints as the short decimal it stands for
+        double round_to(double x, double step) {
+            if (step >= 1.0) return std::round(x / step) * step;
+            const double scale = std::round(1.0 / step);
+            return std::round(x * scale) / scale;
+        }
+
+        time::Instant at_time_utc(const time::Date &d, hours h, minutes m = minutes{0}) {
+            return time::Instant{sys_days(d)} + h + m;
+        }
+
+        io::YieldCurveRecord curve_record(const CurrencyProfile &p, const time::Date &as_of, std::string id,
+                                          std::string_view type, std::string_view index) {
+            io::YieldCurveRecord c;
+            c.curve_id = std::move(id);
+            c.currency = p.currency;
+            c.as_of = as_of;
+            c.curve_type = type;
+            c.day_count = "ACT_365F";
+            c.compounding = "CONTINUOUS";
+            c.interpolation = "LINEAR_ZERO";
+            c.reference_index = index;
+            c.calendar_name = p.calendar;
+            c.business_day_convention = "MODIFIED_FOLLOWING";
+            return c;
+        }
+
+        // Par swap proxies per currency and quoted tenor: projection zero rate at that tenor
+        std::vector<std::pair<std::string, double> > swap_levels(const MarketOptions &options,
+                                                                 const CurrencyProfile &p) {
+            const auto shape = zero_shape(options.seed, p);
+            const double basis = basis_spread(options.seed, p);
+            std::vector<std::pair<std::string, double> > levels;
+            for (const auto tenor: kSwapQuoteTenors) {
+                const auto it = std::find_if(kCurveTenors.begin(), kCurveTenors.end(),
+                                             [&](const Tenor &t) { return t.label == tenor; });
+                levels.emplace_back(std::string(p.currency) + "-SWAP-" + std::string(tenor),
+                                    shape(it->years) + basis);
+            }
+            return levels;
+        }
+
+        std::string format_strike(double strike) {
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "%g", strike);
+            return buf;
+        }
+    }
+
+    std::span<const CurrencyProfile> currency_profiles() { return kProfiles; }
+
+    const CurrencyProfile &currency_profile(std::string_view currency) {
+        for (const auto &p: kProfiles) {
+            if (p.currency == currency) return p;
+        }
+        throw std::invalid_argument("No synthetic profile for currency " + std::string(currency));
+    }
+
+    std::vector<io::YieldCurveRecord> generate_yield_curves(const MarketOptions &options) {
+        std::vector<io::YieldCurveRecord> curves;
+        for (const auto *p: selected(options.currencies)) {
+            const auto shape = zero_shape(options.seed, *p);
+            const double basis = basis_spread(options.seed, *p);
+            auto ois = curve_record(*p, options.as_of, std::string(p->currency) + "-" + std::string(p->ois_index),
+                                    "OIS_ZERO", p->ois_index);
+            auto ibor = curve_record(*p, options.as_of,
+                                     std::string(p->currency) + "-" + std::string(p->ibor_index) + "-" +
+                                     std::string(p->float_tenor), "ZERO_RATE", p->ibor_index);
+            for (const auto &[label, years]: kCurveTenors) {
+                const double zero = shape(years);
+                // Projection basis widens slightly with maturity
+                ois.points.push_back({std::string(label), std::nullopt, round_to(zero, 1e-7)});
+                ibor.points.push_back({
+                    std::string(label), std::nullopt, round_to(zero + basis * (1.0 + 0.01 * years), 1e-7)
+                });
+            }
+            curves.push_back(std::move(ois));
+            curves.push_back(std::move(ibor));
+        }
+        return curves;
+    }
+
+    std::vector<OptionChain> generate_option_chains(const MarketOptions &options) {
+        using analytical_pricers::BlackScholes;
+        std::vector<OptionChain> chains;
+        chains.reserve(options.underlyings);
+        for (std::size_t u = 0; u < options.underlyings; ++u) {
+            auto rng = Rng::stream(options.seed, "underlying", u);
+            OptionChain chain;
+            chain.underlying_id = "EQ" + zero_padded(u, 4);
+            chain.spot = round_to(std::clamp(100.0 * std::exp(rng.normal(0.0, 0.6)), 5.0, 2000.0), 0.01);
+            chain.rate = round_to(rng.uniform(0.01, 0.045), 1e-5);
+            const double atm_short = rng.uniform(0.15, 0.45);
+            const double atm_long = atm_short * rng.uniform(0.7, 1.0);
+            const double skew = -rng.uniform(0.05, 0.25);
+            const double convexity = rng.uniform(0.05, 0.4);
+            const double tick = chain.spot < 50.0 ? 0.5 : chain.spot < 200.0 ? 1.0 : 5.0;
+
+            for (const auto &[expiry, T]: kOptionExpiries) {
+                const double forward = chain.spot * std::exp(chain.rate * T);
+                const double atm = atm_long + (atm_short - atm_long) * std::exp(-T / 0.5);
+                double last_strike = 0.0;
+                for (const double m: kMoneyness) {
+                    const double strike = round_to(chain.spot * m, tick);
+                    if (strike <= last_strike) continue;
+                    last_strike = strike;
+                    const double k = std::log(strike / forward);
+                    const double vol = round_to(std::max(0.05, atm + skew * k / std::pow(T, 0.25) +
+                                                               convexity * k * k / std::sqrt(T)), 1e-6);
+                    for (const bool is_call: {true, false}) {
+                        const double price = is_call
+                                                 ? BlackScholes::call_price(chain.spot, strike, chain.rate, vol, T)
+                                                 : BlackScholes::put_price(chain.spot, strike, chain.rate, vol, T);
+                        chain.options.push_back({std::string(expiry), T, strike, is_call, vol, price});
+                    }
+                }
+            }
+            chains.push_back(std::move(chain));
+        }
+        return chains;
+    }
+
+    std::vector<io::VolSurfaceRecord> vol_surfaces(const std::vector<OptionChain> &chains, const time::Date &as_of) {
+        std::vector<io::VolSurfaceRecord> surfaces;
+        surfaces.reserve(chains.size());
+        for (const auto &chain: chains) {
+            io::VolSurfaceRecord s;
+            s.header = {chain.underlying_id, as_of, "BLACK", "ABSOLUTE_STRIKE", "", "LINEAR", "LINEAR"};
+            for (const auto &o: chain.options) {
+                if (!o.is_call) continue; // calls and puts share the vol
+                s.points.push_back({
+                    o.expiry, o.strike, o.volatility, chain.spot * std::exp(chain.rate * o.maturity),
+                    o.volatility * o.volatility * o.maturity
+                });
+            }
+            surfaces.push_back(std::move(s));
+        }
+        return surfaces;
+    }
+
+    io::QuoteSetRecord option_quote_set(const std::vector<OptionChain> &chains, const time::Date &as_of) {
+        io::QuoteSetRecord set;
+        set.header = {as_of, at_time_utc(as_of, hours{17}, minutes{30}), "SYNTH-OPTIONS", "BASE"};
+        for (const auto &chain: chains) {
+            for (const auto &o: chain.options) {
+                io::InstrumentQuoteRecord instrument;
+                instrument.instrument_id = chain.underlying_id + "-" + o.expiry + (o.is_call ? "-C-" : "-P-") +
+                                           format_strike(o.strike);
+                const double half_spread = std::max(0.005, 0.01 * o.price);
+                for (const auto &[side, value]: {
+                         std::pair{"BID", std::max(0.0, o.price - half_spread)}, std::pair{"ASK", o.price + half_spread}
+                     }) {
+                    io::QuoteRecord q;
+                    q.value = round_to(value, 1e-4);
+                    q.side = side;
+                    q.value_type = "PRICE";
+                    q.currency = "USD";
+                    q.timestamp = set.header.snapshot_time;
+                    q.quality = "INDICATIVE";
+                    q.source = "SYNTH";
+                    instrument.quotes.push_back(std::move(q));
+                }
+                set.instruments.push_back(std::move(instrument));
+            }
+        }
+        return set;
+    }
+
+    io::SnapshotData generate_snapshot(const MarketOptions &options) {
+        io::SnapshotData data;
+        data.header.as_of = options.as_of;
+        data.header.snapshot_time = at_time_utc(options.as_of, hours{17}, minutes{30});
+        data.header.scenario_name = "BASE";
+        data.header.source = "SYNTH";
+        data.header.snapshot_id = "SYNTH-" + std::to_string(options.seed);
+        data.yield_curves = generate_yield_curves(options);
+
+        const auto chains = generate_option_chains(options);
+        data.vol_surfaces = vol_surfaces(chains, options.as_of);
+
+        io::QuoteSetRecord swaps;
+        swaps.header = {options.as_of, data.header.snapshot_time, "SYNTH-RATES", "BASE"};
+        for (const auto *p: selected(options.currencies)) {
+            for (auto &[id, level]: swap_levels(options, *p)) {
+                io::QuoteRecord q;
+                q.value = round_to(level, 1e-6);
+                q.side = "MID";
+                q.value_type = "RATE";
+                q.currency = p->currency;
+                q.timestamp = data.header.snapshot_time;
+                q.quality = "FIRM";
+                q.source = "SYNTH";
+                swaps.instruments.push_back({std::move(id), {std::move(q)}});
+            }
+        }
+        data.quote_sets.push_back(std::move(swaps));
+        if (!chains.empty()) data.quote_sets.push_back(option_quote_set(chains, options.as_of));
+        return data;
+    }
+
+    std::size_t generate_quote_history(const MarketOptions &market, const QuoteHistoryOptions &options,
+                                       const std::function<void(const io::QuoteSetRecord &)> &sink) {
+        struct Walk {
+            std::string id;
+            std::string_view currency;
+            double level;
+        };
+        std::vector<Walk> walks;
+        for (const auto *p: selected(market.currencies)) {
+            for (auto &[id, level]: swap_levels(market, *p)) walks.push_back({std::move(id), p->currency, level});
+        }
+
+        // Business days ending at as_of, oldest first
+        std::vector<time::Date> days;
+        for (auto d = sys_days(market.as_of); days.size() < options.days; d -= std::chrono::days{1}) {
+            const weekday wd{d};
+            if (wd != Saturday && wd != Sunday) days.emplace_back(d);
+        }
+        std::reverse(days.begin(), days.end());
+
+        auto rng = Rng::stream(market.seed, "quote-history");
+        const double tick_vol = 0.0005 / std::sqrt(static_cast<double>(std::max<std::size_t>(options.ticks_per_day, 1)));
+        const auto session = duration_cast<milliseconds>(hours{9});
+        std::size_t produced = 0;
+        for (const auto &day: days) {
+            io::QuoteSetRecord set;
+            set.header = {day, at_time_utc(day, hours{17}, minutes{30}), "SYNTH-RATES", "BASE"};
+            const auto open = at_time_utc(day, hours{8});
+            for (auto &walk: walks) {
+                io::InstrumentQuoteRecord instrument{walk.id, {}};
+                instrument.quotes.reserve(options.ticks_per_day);
+                for (std::size_t j = 0; j < options.ticks_per_day; ++j) {
+                    walk.level += rng.normal(0.0, tick_vol);
+                    const auto offset = session * static_cast<long long>(j) / static_cast<long long>(options.ticks_per_day) +
+                                        milliseconds(static_cast<long long>(rng.index(1000)));
+                    io::QuoteRecord q;
+                    q.value = round_to(walk.level, 1e-7);
+                    q.side = "MID";
+                    q.value_type = "RATE";
+                    q.currency = walk.currency;
+                    q.timestamp = open + offset;
+                    q.quality = "FIRM";
+                    q.source = "SYNTH";
+                    instrument.quotes.push_back(std::move(q));
+                }
+                produced += instrument.quotes.size();
+                set.instruments.push_back(std::move(instrument));
+            }
+            sink(set);
+        }
+        return produced;
+    }
+}
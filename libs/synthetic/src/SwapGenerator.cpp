@@ -0,0 +1,84 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+#include "synthetic/Generators.h"
+#include "synthetic/Random.h"
+#include "time/date_modifier.hpp"
+
+namespace curve::synthetic {
+    namespace {
+        using namespace std::chrono;
+
+        constexpr std::array<int, 12> kTenorYears{1, 2, 3, 4, 5, 7, 10, 12, 15, 20, 25, 30};
+        constexpr std::array<double, 12> kTenorWeights{5, 10, 8, 5, 14, 9, 16, 4, 8, 6, 3, 6};
+
+        int tenor_months(std::string_view tenor) {
+            if (tenor.size() < 2) throw std::invalid_argument("Bad tenor " + std::string(tenor));
+            const int n = std::stoi(std::string(tenor.substr(0, tenor.size() - 1)));
+            switch (tenor.back()) {
+                case 'M': return n;
+                case 'Y': return 12 * n;
+                default: throw std::invalid_argument("Bad tenor " + std::string(tenor));
+            }
+        }
+    }
+
+    SwapGenerator::SwapGenerator(PortfolioOptions options) : options_(std::move(options)) {
+        if (options_.currencies.empty()) {
+            for (const auto &p: currency_profiles()) profiles_.push_back(&p);
+        } else {
+            for (const auto &c: options_.currencies) profiles_.push_back(&currency_profile(c));
+        }
+        for (const auto *p: profiles_) weights_.push_back(p->weight);
+    }
+
+    io::TradeRecord SwapGenerator::trade(std::size_t i) const {
+        auto rng = Rng::stream(options_.seed, "swap", i);
+        const auto &profile = *profiles_[rng.weighted(weights_)];
+        const int years = kTenorYears[rng.weighted(kTenorWeights)];
+        const int float_months = tenor_months(profile.float_tenor);
+
+        // Spot start two days out; some trades start up to two years forward
+        auto start = time::Date{sys_days(options_.as_of) + days{2}};
+        int forward_months = 0;
+        if (rng.chance(options_.forward_start_share)) {
+            forward_months = 1 + static_cast<int>(rng.index(24));
+            start = time::DateModifier::add_months(start, months{forward_months});
+        }
+
+        io::TradeRecord trade;
+        trade.type = "IRSwap";
+        trade.id = "SWP" + zero_padded(i, 7);
+        trade.name = "IRS " + std::string(profile.currency) + " " + std::to_string(years) + "Y";
+        trade.asset_class = "IR";
+        trade.currency = profile.currency;
+        trade.float_index = profile.ibor_index;
+        trade.float_tenor = profile.float_tenor;
+        trade.pay_fixed = rng.chance(0.5);
+        trade.notional = std::max(1e5, std::round(std::exp(rng.normal(std::log(2.5e7), 1.0)) / 1e5) * 1e5);
+
+        // Off-market by a few tens of basis points around the currency's par level
+        const double horizon = years + forward_months / 12.0;
+        const double par = profile.short_rate + (profile.long_rate - profile.short_rate) * (1.0 - std::exp(-horizon / 5.0));
+        trade.fixed_rate = std::round((par + rng.normal(0.0, 0.0035)) * 1e5) / 1e5;
+
+        const int periods = years * 12 / float_months;
+        trade.cashflows.reserve(static_cast<std::size_t>(periods));
+        for (int k = 1; k <= periods; ++k) {
+            trade.cashflows.push_back({time::DateModifier::add_months(start, months{k * float_months}), 0.0});
+        }
+        return trade;
+    }
+
+    std::vector<io::TradeRecord> SwapGenerator::trades(std::size_t count) const {
+        std::vector<io::TradeRecord> result;
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) result.push_back(trade(i));
+        return result;
+    }
+}
@@ -0,0 +1,91 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_CANCELLATION_H
+#define CURVEFORGE_TASKS_CANCELLATION_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace curve::tasks {
+    // Thrown by cancellation checkpoints; the work it unwinds was superseded, not wrong
+    class OperationCancelled : public std::runtime_error {
+    public:
+        OperationCancelled() : std::runtime_error("operation cancelled") {
+        }
+    };
+
+    /**
+     * @brief Read side of a cancellation flag, cheap to copy into every task of a job.
+     *
+     * Cancellation is cooperative: long-running work calls throw_if_cancelled() (or awaits
+     * schedule(token)) at its checkpoints. A default-constructed token is never cancelled.
+     */
+    class CancellationToken {
+    public:
+        CancellationToken() = default;
+
+        [[nodiscard]] bool is_cancelled() const noexcept {
+            return flag_ && flag_->load(std::memory_order_relaxed);
+        }
+
+        void throw_if_cancelled() const {
+            if (is_cancelled()) throw OperationCancelled();
+        }
+
+    private:
+        friend class CancellationSource;
+
+        explicit CancellationToken(std::shared_ptr<const std::atomic<bool> > flag) : flag_(std::move(flag)) {
+        }
+
+        std::shared_ptr<const std::atomic<bool> > flag_;
+    };
+
+    class CancellationSource {
+    public:
+        CancellationSource() : flag_(std::make_shared<std::atomic<bool> >(false)) {
+        }
+
+        [[nodiscard]] CancellationToken token() const { return CancellationToken(flag_); }
+
+        void cancel() noexcept { flag_->store(true, std::memory_order_relaxed); }
+
+        [[nodiscard]] bool is_cancelled() const noexcept { return flag_->load(std::memory_order_relaxed); }
+
+    private:
+        std::shared_ptr<std::atomic<bool> > flag_;
+    };
+
+    /**
+     * @brief Latest-wins cancellation: next() cancels the token it handed out before.
+     *
+     * Meant for work derived from a market snapshot: take a token with next() when a snapshot
+     * arrives and pass it to that snapshot's calibration and pricing; the next snapshot's
+     * next() makes all of it stop at its next checkpoint instead of finishing late.
+     */
+    class CancellationSequence {
+    public:
+        CancellationToken next() {
+            std::lock_guard lock(mutex_);
+            current_.cancel();
+            current_ = CancellationSource();
+            return current_.token();
+        }
+
+        // Cancels the latest token without handing out a new one
+        void cancel() {
+            std::lock_guard lock(mutex_);
+            current_.cancel();
+        }
+
+    private:
+        std::mutex mutex_;
+        CancellationSource current_;
+    };
+}
+
+#endif //CURVEFORGE_TASKS_CANCELLATION_H
@@ -0,0 +1,113 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_PARALLEL_H
+#define CURVEFORGE_TASKS_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "tasks/TaskGroup.h"
+
+namespace curve::tasks {
+    namespace detail {
+        // Hands the upper halves of [begin, end) to thieves and keeps splitting the lower one
+        template<typename Body>
+        void split_range(TaskGroup &group, std::size_t begin, std::size_t end, std::size_t grain, const Body &body) {
+            while (end - begin > grain) {
+                const std::size_t mid = begin + (end - begin) / 2;
+                group.run([&group, mid, end, grain, &body] { split_range(group, mid, end, grain, body); });
+                end = mid;
+            }
+            if (!group.is_cancelled()) body(begin, end);
+        }
+    }
+
+    /**
+     * @brief Calls body(b, e) on disjoint subranges, of at most `grain` indices, covering [begin, end).
+     *
+     * The range is split recursively, so idle threads steal large halves first. Runs on the
+     * calling thread alone when the range fits one grain or the scheduler has no workers. The
+     * first exception cancels the remaining subranges and is rethrown.
+     */
+    template<typename Body>
+    void parallel_for_range(std::size_t begin, std::size_t end, const Body &body, std::size_t grain = 1) {
+        if (begin >= end) return;
+        grain = std::max<std::size_t>(1, grain);
+        auto &scheduler = Scheduler::current();
+        if (end - begin <= grain || scheduler.concurrency() == 1) {
+            body(begin, end);
+            return;
+        }
+        TaskGroup group(scheduler);
+        group.run([&] { detail::split_range(group, begin, end, grain, body); });
+        group.wait();
+    }
+
+    // body(i) for every i in [begin, end), see parallel_for_range()
+    template<typename Body>
+    void parallel_for(std::size_t begin, std::size_t end, const Body &body, std::size_t grain = 1) {
+        parallel_for_range(begin, end, [&body](std::size_t b, std::size_t e) {
+            for (std::size_t i = b; i < e; ++i) body(i);
+        }, grain);
+    }
+
+    /**
+     * @brief body(i) for every i < count, from at most `max_concurrency` tasks claiming indices in order.
+     *
+     * Meant for a few coarse, uneven work items (curves, portfolio chunks) where callers bound
+     * the parallelism: max_concurrency <= 1 runs everything on the calling thread. The first
+     * exception stops the hand-out of further indices and is rethrown.
+     */
+    template<typename Body>
+    void parallel_for_bounded(Scheduler &scheduler, std::size_t count, std::size_t max_concurrency, const Body &body) {
+        const std::size_t lanes = std::min({count, max_concurrency, scheduler.concurrency()});
+        if (lanes <= 1) {
+            for (std::size_t i = 0; i < count; ++i) body(i);
+            return;
+        }
+        std::atomic<std::size_t> next{0};
+        TaskGroup group(scheduler);
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            group.run([&] {
+                for (std::size_t i = next++; i < count && !group.is_cancelled(); i = next++) body(i);
+            });
+        }
+        group.wait();
+    }
+
+    // parallel_for_bounded() on Scheduler::current()
+    template<typename Body>
+    void parallel_for_bounded(std::size_t count, std::size_t max_concurrency, const Body &body) {
+        parallel_for_bounded(Scheduler::current(), count, max_concurrency, body);
+    }
+
+    /**
+     * @brief Folds [begin, end) with reduce(b, e, identity) per chunk and combine() across chunks.
+     *
+     * Chunks have `grain` indices (0: about 1/256 of the range) and their partial results are
+     * combined left to right on the calling thread, so the result depends on the range and the
+     * grain only, never on the thread count or on which thread ran what.
+     */
+    template<typename T, typename Reduce, typename Combine>
+    T parallel_reduce(std::size_t begin, std::size_t end, T identity, const Reduce &reduce, const Combine &combine,
+                      std::size_t grain = 0) {
+        if (begin >= end) return identity;
+        const std::size_t n = end - begin;
+        if (grain == 0) grain = (n + 255) / 256;
+        const std::size_t chunks = (n + grain - 1) / grain;
+        std::vector<T> partials(chunks, identity);
+        parallel_for(0, chunks, [&](std::size_t c) {
+            const std::size_t b = begin + c * grain;
+            partials[c] = reduce(b, std::min(end, b + grain), identity);
+        });
+        T result = std::move(identity);
+        for (auto &p: partials) result = combine(std::move(result), std::move(p));
+        return result;
+    }
+}
+
+#endif //CURVEFORGE_TASKS_PARALLEL_H
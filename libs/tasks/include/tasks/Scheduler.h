@@ -0,0 +1,86 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_SCHEDULER_H
+#define CURVEFORGE_TASKS_SCHEDULER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace curve::tasks {
+    struct SchedulerOptions {
+        // Threads running tasks, a waiting caller included: threads - 1 workers are started
+        std::size_t threads = std::max(1u, std::thread::hardware_concurrency());
+        // Worker i is pinned to cpus[i % cpus.size()] (Linux only); empty leaves placement to the OS
+        std::vector<int> cpus;
+    };
+
+    namespace detail {
+        // A unit of work; execute() runs it and destroys it
+        class Runnable {
+        public:
+            virtual ~Runnable() = default;
+
+            virtual void execute() noexcept = 0;
+        };
+
+        class SchedulerState;
+    }
+
+    /**
+     * @brief Work-stealing thread pool.
+     *
+     * Every worker owns a Chase-Lev deque: tasks spawned on a worker go to the bottom of its own
+     * deque and are popped back LIFO (hot in cache), idle workers steal the oldest task from the
+     * top of a random victim. Tasks spawned from other threads go through a shared injection
+     * queue. Threads waiting on a TaskGroup run queued tasks meanwhile, which is what makes
+     * nested parallelism safe: a worker blocked in an inner wait keeps executing work instead of
+     * holding its core idle.
+     *
+     * Libraries use Scheduler::current(): the pool of the calling worker, else global(). The
+     * global pool is sized by configure(), once, before its first use.
+     */
+    class Scheduler {
+    public:
+        explicit Scheduler(SchedulerOptions options = {});
+
+        // Joins the workers; every TaskGroup on this scheduler must have been waited for
+        ~Scheduler();
+
+        Scheduler(const Scheduler &) = delete;
+
+        Scheduler &operator=(const Scheduler &) = delete;
+
+        // Threads that run tasks concurrently: the workers plus one waiting caller
+        [[nodiscard]] std::size_t concurrency() const;
+
+        // Index of the calling thread among this scheduler's workers, or concurrency() - 1 elsewhere
+        [[nodiscard]] std::size_t thread_index() const;
+
+        // Process-wide scheduler, created with default options (or configure()'s) on first use
+        static Scheduler &global();
+
+        // Sets the global scheduler's options; throws std::logic_error once global() has been used
+        static void configure(SchedulerOptions options);
+
+        // The scheduler of the calling worker thread, global() on any other thread
+        static Scheduler &current();
+
+        // Takes ownership of a task and queues it: on the calling worker's deque, or the injection
+        // queue from other threads. TaskGroup and the coroutine awaitables build on this.
+        void spawn(detail::Runnable *task);
+
+        // Runs one queued task on the calling thread if any can be found; false when every queue
+        // looked empty. For threads waiting on results the pool is still computing.
+        bool run_one();
+
+    private:
+        std::unique_ptr<detail::SchedulerState> state_;
+    };
+}
+
+#endif //CURVEFORGE_TASKS_SCHEDULER_H
@@ -0,0 +1,119 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_SCRATCH_ARENA_H
+#define CURVEFORGE_TASKS_SCRATCH_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace curve::tasks {
+    struct ArenaStats {
+        std::uint64_t allocations = 0; // served by the arena
+        std::uint64_t bytes = 0; // requested from the arena
+        std::uint64_t upstream_allocations = 0; // heap blocks taken when the retained buffer ran out
+        std::uint64_t upstream_bytes = 0;
+        std::uint64_t resets = 0;
+        std::size_t high_water = 0; // most bytes requested between two resets
+    };
+
+    /**
+     * @brief Monotonic std::pmr arena for short-lived scratch data, one per thread.
+     *
+     * Allocation bumps a pointer in a retained buffer and deallocation does nothing; reset()
+     * frees everything at once. When a cycle overflowed into heap blocks, reset() grows the
+     * retained buffer to the high-water mark, so a steady workload stops touching the global
+     * allocator, and threads never contend on it, after its first few cycles.
+     *
+     * Use it through ArenaScope, which resets the calling thread's arena when the outermost
+     * scope on that thread ends. Memory from the arena must not outlive that scope nor be
+     * handed to another thread.
+     */
+    class ScratchArena final : public std::pmr::memory_resource {
+    public:
+        static constexpr std::size_t kDefaultCapacity = 16 * 1024;
+
+        explicit ScratchArena(std::size_t capacity = kDefaultCapacity);
+
+        ~ScratchArena() override;
+
+        ScratchArena(const ScratchArena &) = delete;
+
+        ScratchArena &operator=(const ScratchArena &) = delete;
+
+        // Releases everything allocated since the last reset
+        void reset() noexcept;
+
+        // Bytes of the retained buffer
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+        [[nodiscard]] const ArenaStats &stats() const noexcept { return stats_; }
+
+        // The calling thread's arena
+        static ScratchArena &local();
+
+        // Statistics of every arena in the process, folded in at each reset and destruction
+        static ArenaStats totals() noexcept;
+
+    private:
+        friend class ArenaScope;
+
+        class Upstream final : public std::pmr::memory_resource {
+        public:
+            explicit Upstream(ArenaStats &stats) : stats_(stats) {
+            }
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override;
+
+            bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+
+            ArenaStats &stats_;
+        };
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        void do_deallocate(void *, std::size_t, std::size_t) override {
+        }
+
+        bool do_is_equal(const memory_resource &other) const noexcept override { return this == &other; }
+
+        void report() noexcept;
+
+        ArenaStats stats_;
+        ArenaStats reported_; // part of stats_ already in totals()
+        Upstream upstream_{stats_};
+        std::size_t capacity_;
+        std::unique_ptr<std::byte[]> buffer_;
+        std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+        std::size_t in_use_ = 0;
+        int scopes_ = 0;
+    };
+
+    // Scratch allocations of the enclosed code; nested scopes share the outermost one's cycle
+    class ArenaScope {
+    public:
+        ArenaScope() : arena_(ScratchArena::local()) { ++arena_.scopes_; }
+
+        ~ArenaScope() {
+            if (--arena_.scopes_ == 0) arena_.reset();
+        }
+
+        ArenaScope(const ArenaScope &) = delete;
+
+        ArenaScope &operator=(const ArenaScope &) = delete;
+
+        [[nodiscard]] std::pmr::memory_resource *resource() const { return &arena_; }
+
+    private:
+        ScratchArena &arena_;
+    };
+}
+
+#endif //CURVEFORGE_TASKS_SCRATCH_ARENA_H
@@ -0,0 +1,347 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_TASK_H
+#define CURVEFORGE_TASKS_TASK_H
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "tasks/Cancellation.h"
+#include "tasks/Scheduler.h"
+
+namespace curve::tasks {
+    template<typename T = void>
+    class Task;
+
+    namespace detail {
+        struct PromiseBase {
+            struct FinalAwaiter {
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                // Symmetric transfer to whoever awaited the task, without growing the stack
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept {
+                    return h.promise().continuation;
+                }
+
+                void await_resume() const noexcept {
+                }
+            };
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            FinalAwaiter final_suspend() noexcept { return {}; }
+
+            void unhandled_exception() noexcept { error = std::current_exception(); }
+
+            void rethrow_if_failed() const {
+                if (error) std::rethrow_exception(error);
+            }
+
+            std::coroutine_handle<> continuation = std::noop_coroutine();
+            std::exception_ptr error;
+        };
+
+        template<typename T>
+        struct Promise : PromiseBase {
+            Task<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U &&value) { this->value.emplace(std::forward<U>(value)); }
+
+            T result() {
+                rethrow_if_failed();
+                return std::move(*value);
+            }
+
+            std::optional<T> value;
+        };
+
+        template<>
+        struct Promise<void> : PromiseBase {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {
+            }
+
+            void result() const { rethrow_if_failed(); }
+        };
+
+        // Resumes a suspended coroutine on a pool thread
+        class ResumeOnPool final : public Runnable {
+        public:
+            explicit ResumeOnPool(std::coroutine_handle<> handle) : handle_(handle) {
+            }
+
+            void execute() noexcept override {
+                const auto handle = handle_;
+                delete this;
+                handle.resume();
+            }
+
+        private:
+            std::coroutine_handle<> handle_;
+        };
+
+        // Eagerly started, self-destroying coroutine: the glue of when_all() and sync_wait()
+        struct Detached {
+            struct promise_type {
+                Detached get_return_object() noexcept { return {}; }
+
+                std::suspend_never initial_suspend() noexcept { return {}; }
+
+                std::suspend_never final_suspend() noexcept { return {}; }
+
+                void return_void() noexcept {
+                }
+
+                void unhandled_exception() noexcept { std::terminate(); }
+            };
+        };
+    }
+
+    /**
+     * @brief Lazily started coroutine producing a T (or an exception).
+     *
+     * Nothing runs until the task is co_awaited; it then runs on the awaiting thread up to its
+     * first hop onto the pool (co_await schedule()), and its continuation resumes wherever it
+     * finishes. A Task is move-only and owns its coroutine frame. Arguments taken by reference
+     * must outlive the task, as with every other view in the library.
+     */
+    template<typename T>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = detail::Promise<T>;
+        using value_type = T;
+
+        Task() noexcept = default;
+
+        explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {
+        }
+
+        Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {})) {
+        }
+
+        Task &operator=(Task &&other) noexcept {
+            if (this != &other) {
+                if (handle_) handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        ~Task() {
+            if (handle_) handle_.destroy();
+        }
+
+        [[nodiscard]] bool valid() const noexcept { return static_cast<bool>(handle_); }
+
+        auto operator co_await() && noexcept {
+            struct Awaiter {
+                std::coroutine_handle<promise_type> handle;
+
+                [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                T await_resume() { return handle.promise().result(); }
+            };
+            return Awaiter{handle_};
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle_;
+    };
+
+    namespace detail {
+        template<typename T>
+        Task<T> Promise<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<Promise>::from_promise(*this));
+        }
+
+        inline Task<void> Promise<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<Promise>::from_promise(*this));
+        }
+    }
+
+    // co_await schedule(): continue on a pool thread; throws OperationCancelled there if the token
+    // was cancelled meanwhile, so superseded work stops before it starts
+    class ScheduleAwaiter {
+    public:
+        ScheduleAwaiter(Scheduler &scheduler, CancellationToken token) : scheduler_(scheduler),
+                                                                          token_(std::move(token)) {
+        }
+
+        [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle) { scheduler_.spawn(new detail::ResumeOnPool(handle)); }
+
+        void await_resume() const { token_.throw_if_cancelled(); }
+
+    private:
+        Scheduler &scheduler_;
+        CancellationToken token_;
+    };
+
+    inline ScheduleAwaiter schedule(Scheduler &scheduler, CancellationToken token = {}) {
+        return {scheduler, std::move(token)};
+    }
+
+    inline ScheduleAwaiter schedule(CancellationToken token = {}) {
+        return {Scheduler::current(), std::move(token)};
+    }
+
+    // Runs f() on the pool, e.g. to overlap a blocking load with calibration and pricing
+    template<typename F>
+    Task<std::invoke_result_t<F &> > run_async(F f, CancellationToken token = {}) {
+        co_await schedule(token);
+        co_return f();
+    }
+
+    namespace detail {
+        template<typename T>
+        using Slot = std::optional<std::conditional_t<std::is_void_v<T>, std::monostate, T> >;
+
+        struct WhenAllCounter {
+            explicit WhenAllCounter(std::size_t children) : remaining(children + 1) {
+            }
+
+            // One child done; the last one resumes the parent
+            void arrive() noexcept {
+                if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) parent.resume();
+            }
+
+            std::atomic<std::size_t> remaining;
+            std::coroutine_handle<> parent;
+        };
+
+        template<typename T>
+        Detached when_all_child(Scheduler &scheduler, Task<T> &task, Slot<T> &slot, std::exception_ptr &error,
+                                WhenAllCounter &counter) {
+            co_await schedule(scheduler);
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await std::move(task);
+                    slot.emplace();
+                } else {
+                    slot.emplace(co_await std::move(task));
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            counter.arrive();
+        }
+
+        template<typename Start>
+        struct StartAll {
+            WhenAllCounter &counter;
+            Start start;
+
+            [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+            // The counter holds one extra count for the parent until every child was launched
+            bool await_suspend(std::coroutine_handle<> parent) {
+                counter.parent = parent;
+                start();
+                return counter.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            void await_resume() const noexcept {
+            }
+        };
+
+        template<typename T>
+        Task<std::vector<Slot<T> > > when_all_slots(std::vector<Task<T> > tasks, Scheduler &scheduler) {
+            std::vector<Slot<T> > slots(tasks.size());
+            std::vector<std::exception_ptr> errors(tasks.size());
+            WhenAllCounter counter(tasks.size());
+            const auto start = [&] {
+                for (std::size_t i = 0; i < tasks.size(); ++i) {
+                    when_all_child(scheduler, tasks[i], slots[i], errors[i], counter);
+                }
+            };
+            co_await StartAll<decltype(start)>{counter, start};
+            for (const auto &e: errors) {
+                if (e) std::rethrow_exception(e);
+            }
+            co_return slots;
+        }
+
+        template<typename T>
+        Detached sync_wait_child(Task<T> &task, Slot<T> &slot, std::exception_ptr &error, std::atomic<bool> &done) {
+            try {
+                if constexpr (std::is_void_v<T>) {
+                    co_await std::move(task);
+                    slot.emplace();
+                } else {
+                    slot.emplace(co_await std::move(task));
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            // Last touch of the waiter's state: it may return as soon as it sees the flag
+            done.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Runs every task concurrently on the pool and resumes with their results, in order.
+     *
+     * All tasks run to completion; the first (lowest index) exception is then rethrown. Pass a
+     * CancellationToken into the tasks to drop the rest early when one fails or work goes stale.
+     */
+    template<typename T>
+    Task<std::vector<T> > when_all(std::vector<Task<T> > tasks, Scheduler &scheduler = Scheduler::current()) {
+        auto slots = co_await detail::when_all_slots(std::move(tasks), scheduler);
+        std::vector<T> results;
+        results.reserve(slots.size());
+        for (auto &slot: slots) results.push_back(std::move(*slot));
+        co_return results;
+    }
+
+    inline Task<void> when_all(std::vector<Task<void> > tasks, Scheduler &scheduler = Scheduler::current()) {
+        co_await detail::when_all_slots(std::move(tasks), scheduler);
+    }
+
+    /**
+     * @brief Blocks until the task finished and returns its result, running pool tasks meanwhile.
+     *
+     * The bridge from synchronous callers (main, tests, the blocking IPricer interface) into
+     * coroutine code; safe on pool threads too, since the wait keeps executing queued work.
+     */
+    template<typename T>
+    T sync_wait(Task<T> task, Scheduler &scheduler = Scheduler::current()) {
+        detail::Slot<T> slot;
+        std::exception_ptr error;
+        std::atomic<bool> done{false};
+        detail::sync_wait_child(task, slot, error, done);
+        constexpr unsigned kSpins = 64;
+        for (unsigned idle = 0; !done.load(std::memory_order_acquire);) {
+            if (scheduler.run_one()) {
+                idle = 0;
+            } else if (++idle < kSpins) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+        if (error) std::rethrow_exception(error);
+        if constexpr (!std::is_void_v<T>) return std::move(*slot);
+    }
+}
+
+#endif //CURVEFORGE_TASKS_TASK_H
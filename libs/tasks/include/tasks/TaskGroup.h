@@ -0,0 +1,111 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_TASK_GROUP_H
+#define CURVEFORGE_TASKS_TASK_GROUP_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+#include "tasks/Scheduler.h"
+
+namespace curve::tasks {
+    /**
+     * @brief A set of tasks run on a Scheduler and waited for together.
+     *
+     * wait() returns once every task run() so far has finished, executing queued tasks on the
+     * calling thread meanwhile, and rethrows the first exception a task threw. A throwing task
+     * cancels the group: tasks that have not started yet are skipped, running ones can poll
+     * is_cancelled(). Cancellation reaches groups created inside the group's tasks too, so
+     * cancelling an outer job also stops the nested work it started.
+     *
+     * The destructor waits (discarding any exception); wait() leaves the group ready for reuse.
+     */
+    class TaskGroup {
+    public:
+        explicit TaskGroup(Scheduler &scheduler = Scheduler::current());
+
+        ~TaskGroup();
+
+        TaskGroup(const TaskGroup &) = delete;
+
+        TaskGroup &operator=(const TaskGroup &) = delete;
+
+        template<typename F>
+        void run(F &&f) {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            std::unique_ptr<detail::Runnable> task;
+            try {
+                task = std::make_unique<Job<std::decay_t<F> > >(this, std::forward<F>(f));
+            } catch (...) {
+                finish_one();
+                throw;
+            }
+            scheduler_.spawn(task.release());
+        }
+
+        void wait();
+
+        void cancel() noexcept;
+
+        // True once this group, or the group whose task created it, has been cancelled
+        [[nodiscard]] bool is_cancelled() const noexcept;
+
+        [[nodiscard]] Scheduler &scheduler() const { return scheduler_; }
+
+    private:
+        template<typename F>
+        class Job final : public detail::Runnable {
+        public:
+            template<typename G>
+            Job(TaskGroup *group, G &&fn) : group_(group), fn_(std::forward<G>(fn)) {
+            }
+
+            void execute() noexcept override {
+                TaskGroup *group = group_;
+                if (!group->is_cancelled()) {
+                    const TaskGroup *outer = group->enter();
+                    try {
+                        fn_();
+                    } catch (...) {
+                        group->fail(std::current_exception());
+                    }
+                    leave(outer);
+                }
+                // The functor goes before the group can see its last task finish
+                delete this;
+                group->finish_one();
+            }
+
+        private:
+            TaskGroup *group_;
+            F fn_;
+        };
+
+        // Marks this group as the one running on the calling thread; returns the previous one
+        const TaskGroup *enter() const noexcept;
+
+        static void leave(const TaskGroup *outer) noexcept;
+
+        void fail(std::exception_ptr error) noexcept;
+
+        void finish_one() noexcept;
+
+        Scheduler &scheduler_;
+        const TaskGroup *parent_;
+        std::atomic<std::size_t> pending_{0};
+        std::atomic<bool> cancelled_{false};
+        std::mutex mutex_;
+        std::condition_variable done_;
+        std::exception_ptr error_;
+    };
+}
+
+#endif //CURVEFORGE_TASKS_TASK_GROUP_H
@@ -0,0 +1,32 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_TOPOLOGY_H
+#define CURVEFORGE_TASKS_TOPOLOGY_H
+
+#include <string>
+#include <vector>
+
+namespace curve::tasks {
+    struct NumaNode {
+        int id = 0;
+        std::vector<int> cpus; // online cpus of the node, ascending; empty when unknown
+    };
+
+    /**
+     * @brief NUMA nodes that have cpus, from /sys/devices/system/node (Linux).
+     *
+     * Returns a single node 0 without cpus (no pinning) where the topology cannot be read, so
+     * callers can always shard by node.
+     */
+    std::vector<NumaNode> numa_nodes();
+
+    // Parses a kernel cpu list such as "0-3,8,10-11"; throws std::invalid_argument on malformed input
+    std::vector<int> parse_cpu_list(const std::string &list);
+
+    // Restricts the calling thread to `cpus` (Linux only, best effort); an empty list does nothing
+    void pin_current_thread(const std::vector<int> &cpus);
+}
+
+#endif //CURVEFORGE_TASKS_TOPOLOGY_H
@@ -0,0 +1,180 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "tasks/Scheduler.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "SchedulerState.h"
+#include "metrics/Metrics.h"
+#include "tasks/Topology.h"
+
+namespace curve::tasks {
+    namespace {
+        // The scheduler whose worker is the calling thread, and the worker's index
+        thread_local Scheduler *tls_scheduler = nullptr;
+        thread_local std::size_t tls_index = 0;
+
+        std::mutex global_mutex;
+        std::atomic<Scheduler *> global_scheduler{nullptr};
+
+        std::size_t next_random() {
+            thread_local std::uint64_t state = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<std::uintptr_t>(&state);
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<std::size_t>(state);
+        }
+    }
+
+    namespace detail {
+        Runnable *SchedulerState::find(std::size_t self) {
+            if (self != kNotAWorker) {
+                if (Runnable *task = workers[self]->deque.pop()) return task;
+            }
+            if (injected_.load(std::memory_order_acquire) > 0) {
+                std::lock_guard lock(injection_mutex_);
+                if (!injection_.empty()) {
+                    Runnable *task = injection_.front();
+                    injection_.pop_front();
+                    injected_.fetch_sub(1, std::memory_order_relaxed);
+                    return task;
+                }
+            }
+            const std::size_t n = workers.size();
+            if (n == 0) return nullptr;
+            const std::size_t start = next_random() % n;
+            for (std::size_t k = 0; k < n; ++k) {
+                const std::size_t victim = (start + k) % n;
+                if (victim == self) continue;
+                if (Runnable *task = workers[victim]->deque.steal()) {
+                    CURVEFORGE_COUNT("tasks.steals", 1);
+                    return task;
+                }
+            }
+            return nullptr;
+        }
+
+        void SchedulerState::inject(Runnable *task) {
+            std::lock_guard lock(injection_mutex_);
+            injection_.push_back(task);
+            injected_.fetch_add(1, std::memory_order_release);
+        }
+
+        void SchedulerState::notify() {
+            epoch_.fetch_add(1, std::memory_order_seq_cst);
+            if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+                std::lock_guard lock(sleep_mutex_);
+                wake_.notify_one();
+            }
+        }
+
+        void SchedulerState::stop() {
+            stopping.store(true, std::memory_order_release);
+            std::lock_guard lock(sleep_mutex_);
+            wake_.notify_all();
+        }
+
+        void SchedulerState::worker_loop(std::size_t self) {
+            constexpr int kSpins = 64;
+            while (!stopping.load(std::memory_order_acquire)) {
+                const std::uint64_t seen = epoch_.load(std::memory_order_seq_cst);
+                Runnable *task = find(self);
+                for (int spin = 0; !task && spin < kSpins; ++spin) {
+                    std::this_thread::yield();
+                    task = find(self);
+                }
+                if (task) {
+                    task->execute();
+                    continue;
+                }
+                std::unique_lock lock(sleep_mutex_);
+                sleepers_.fetch_add(1, std::memory_order_seq_cst);
+                wake_.wait(lock, [&] {
+                    return stopping.load(std::memory_order_acquire) || epoch_.load(std::memory_order_seq_cst) != seen;
+                });
+                sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    Scheduler::Scheduler(SchedulerOptions options) : state_(std::make_unique<detail::SchedulerState>()) {
+        for (const int cpu: options.cpus) {
+            if (cpu < 0 || cpu >= 1024) throw std::invalid_argument("Scheduler: bad cpu " + std::to_string(cpu));
+        }
+        const std::size_t workers = std::max<std::size_t>(1, options.threads) - 1;
+        state_->concurrency = workers + 1;
+        // Every deque exists before the first worker starts stealing
+        state_->workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; ++i) {
+            state_->workers.push_back(std::make_unique<detail::SchedulerState::Worker>());
+        }
+        try {
+            for (std::size_t i = 0; i < workers; ++i) {
+                const int cpu = options.cpus.empty() ? -1 : options.cpus[i % options.cpus.size()];
+                state_->workers[i]->thread = std::thread([this, i, cpu] {
+                    tls_scheduler = this;
+                    tls_index = i;
+                    if (cpu >= 0) pin_current_thread({cpu});
+                    state_->worker_loop(i);
+                });
+            }
+        } catch (...) {
+            state_->stop();
+            for (auto &w: state_->workers) {
+                if (w->thread.joinable()) w->thread.join();
+            }
+            throw;
+        }
+    }
+
+    Scheduler::~Scheduler() {
+        state_->stop();
+        for (auto &w: state_->workers) w->thread.join();
+        // Anything still queued belongs to a group nobody waited for; run it rather than leak it
+        while (detail::Runnable *task = state_->find(detail::SchedulerState::kNotAWorker)) task->execute();
+    }
+
+    std::size_t Scheduler::concurrency() const { return state_->concurrency; }
+
+    std::size_t Scheduler::thread_index() const {
+        return tls_scheduler == this ? tls_index : state_->concurrency - 1;
+    }
+
+    Scheduler &Scheduler::global() {
+        if (Scheduler *s = global_scheduler.load(std::memory_order_acquire)) return *s;
+        std::lock_guard lock(global_mutex);
+        if (!global_scheduler.load(std::memory_order_relaxed)) {
+            // Never destroyed: tasks may still run while other statics are torn down
+            global_scheduler.store(new Scheduler(), std::memory_order_release);
+        }
+        return *global_scheduler.load(std::memory_order_relaxed);
+    }
+
+    void Scheduler::configure(SchedulerOptions options) {
+        std::lock_guard lock(global_mutex);
+        if (global_scheduler.load(std::memory_order_relaxed)) {
+            throw std::logic_error("Scheduler::configure: the global scheduler is already in use");
+        }
+        global_scheduler.store(new Scheduler(std::move(options)), std::memory_order_release);
+    }
+
+    Scheduler &Scheduler::current() {
+        return tls_scheduler ? *tls_scheduler : global();
+    }
+
+    void Scheduler::spawn(detail::Runnable *task) {
+        if (tls_scheduler == this) state_->workers[tls_index]->deque.push(task);
+        else state_->inject(task);
+        state_->notify();
+    }
+
+    bool Scheduler::run_one() {
+        detail::Runnable *task = state_->find(tls_scheduler == this ? tls_index : detail::SchedulerState::kNotAWorker);
+        if (!task) return false;
+        task->execute();
+        return true;
+    }
+}
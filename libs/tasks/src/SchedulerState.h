@@ -0,0 +1,62 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_SCHEDULER_STATE_H
+#define CURVEFORGE_TASKS_SCHEDULER_STATE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "WorkStealingDeque.h"
+
+namespace curve::tasks::detail {
+    class SchedulerState {
+    public:
+        static constexpr std::size_t kNotAWorker = std::numeric_limits<std::size_t>::max();
+
+        struct Worker {
+            WorkStealingDeque deque;
+            std::thread thread;
+        };
+
+        // Own deque first, then the injection queue, then a steal from a random victim
+        Runnable *find(std::size_t self);
+
+        void inject(Runnable *task);
+
+        // Wakes one sleeping worker after new work was queued
+        void notify();
+
+        // Makes every worker leave worker_loop() once its current task is done
+        void stop();
+
+        void worker_loop(std::size_t self);
+
+        std::size_t concurrency = 1;
+        std::vector<std::unique_ptr<Worker> > workers;
+        std::atomic<bool> stopping{false};
+
+    private:
+        std::mutex injection_mutex_;
+        std::deque<Runnable *> injection_;
+        std::atomic<std::size_t> injected_{0};
+
+        // Sleeping protocol: workers sleep only while epoch_ still has the value read before their
+        // last unsuccessful search; notify() bumps it before checking for sleepers.
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        std::atomic<std::uint64_t> epoch_{0};
+        std::atomic<std::size_t> sleepers_{0};
+    };
+}
+
+#endif //CURVEFORGE_TASKS_SCHEDULER_STATE_H
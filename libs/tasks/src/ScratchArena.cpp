@@ -0,0 +1,104 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "tasks/ScratchArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+
+#include "metrics/Metrics.h"
+
+namespace curve::tasks {
+    namespace {
+        struct Totals {
+            std::atomic<std::uint64_t> allocations{0};
+            std::atomic<std::uint64_t> bytes{0};
+            std::atomic<std::uint64_t> upstream_allocations{0};
+            std::atomic<std::uint64_t> upstream_bytes{0};
+            std::atomic<std::uint64_t> resets{0};
+            std::atomic<std::size_t> high_water{0};
+        };
+
+        Totals totals_;
+    }
+
+    void *ScratchArena::Upstream::do_allocate(std::size_t bytes, std::size_t alignment) {
+        CURVEFORGE_COUNT("arena.upstream_allocations", 1);
+        void *p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        ++stats_.upstream_allocations;
+        stats_.upstream_bytes += bytes;
+        return p;
+    }
+
+    void ScratchArena::Upstream::do_deallocate(void *p, std::size_t bytes, std::size_t alignment) {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    ScratchArena::ScratchArena(std::size_t capacity)
+        : capacity_(std::max<std::size_t>(capacity, 64)), buffer_(new std::byte[capacity_]) {
+        monotonic_.emplace(buffer_.get(), capacity_, &upstream_);
+    }
+
+    ScratchArena::~ScratchArena() {
+        monotonic_.reset();
+        report();
+    }
+
+    void ScratchArena::reset() noexcept {
+        monotonic_->release();
+        if (in_use_ > capacity_) {
+            // This cycle spilled into heap blocks: retain one buffer that fits it next time
+            try {
+                const auto grown = std::bit_ceil(in_use_);
+                buffer_.reset(new std::byte[grown]);
+                capacity_ = grown;
+            } catch (const std::bad_alloc &) {
+                // Keep the current buffer; the next cycle spills again
+            }
+            monotonic_.emplace(buffer_.get(), capacity_, &upstream_);
+        }
+        in_use_ = 0;
+        ++stats_.resets;
+        report();
+    }
+
+    ScratchArena &ScratchArena::local() {
+        thread_local ScratchArena arena;
+        return arena;
+    }
+
+    ArenaStats ScratchArena::totals() noexcept {
+        return {
+            totals_.allocations.load(std::memory_order_relaxed), totals_.bytes.load(std::memory_order_relaxed),
+            totals_.upstream_allocations.load(std::memory_order_relaxed),
+            totals_.upstream_bytes.load(std::memory_order_relaxed), totals_.resets.load(std::memory_order_relaxed),
+            totals_.high_water.load(std::memory_order_relaxed)
+        };
+    }
+
+    void *ScratchArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+        void *p = monotonic_->allocate(bytes, alignment);
+        ++stats_.allocations;
+        stats_.bytes += bytes;
+        in_use_ += bytes;
+        stats_.high_water = std::max(stats_.high_water, in_use_);
+        return p;
+    }
+
+    void ScratchArena::report() noexcept {
+        totals_.allocations.fetch_add(stats_.allocations - reported_.allocations, std::memory_order_relaxed);
+        totals_.bytes.fetch_add(stats_.bytes - reported_.bytes, std::memory_order_relaxed);
+        totals_.upstream_allocations.fetch_add(stats_.upstream_allocations - reported_.upstream_allocations,
+                                               std::memory_order_relaxed);
+        totals_.upstream_bytes.fetch_add(stats_.upstream_bytes - reported_.upstream_bytes,
+                                         std::memory_order_relaxed);
+        totals_.resets.fetch_add(stats_.resets - reported_.resets, std::memory_order_relaxed);
+        auto high = totals_.high_water.load(std::memory_order_relaxed);
+        while (high < stats_.high_water &&
+               !totals_.high_water.compare_exchange_weak(high, stats_.high_water, std::memory_order_relaxed)) {
+        }
+        reported_ = stats_;
+    }
+}
@@ -0,0 +1,93 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "tasks/TaskGroup.h"
+
+#include <chrono>
+#include <thread>
+
+namespace curve::tasks {
+    namespace {
+        // Group of the task running on this thread, the parent of groups created inside it
+        thread_local const TaskGroup *tls_group = nullptr;
+    }
+
+    TaskGroup::TaskGroup(Scheduler &scheduler) : scheduler_(scheduler), parent_(tls_group) {
+    }
+
+    TaskGroup::~TaskGroup() {
+        try {
+            wait();
+        } catch (...) {
+        }
+    }
+
+    void TaskGroup::wait() {
+        constexpr unsigned kSpins = 64;
+        unsigned idle = 0;
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            if (scheduler_.run_one()) {
+                idle = 0;
+                continue;
+            }
+            // Our tasks are running elsewhere: spin briefly, then doze but look for work again soon
+            if (++idle < kSpins) {
+                std::this_thread::yield();
+                continue;
+            }
+            std::unique_lock lock(mutex_);
+            done_.wait_for(lock, std::chrono::microseconds(100),
+                           [&] { return pending_.load(std::memory_order_acquire) == 0; });
+        }
+        std::exception_ptr error;
+        {
+            // Also waits for the last finish_one() to let go of the mutex
+            std::lock_guard lock(mutex_);
+            error = std::exchange(error_, nullptr);
+        }
+        cancelled_.store(false, std::memory_order_relaxed);
+        if (error) std::rethrow_exception(error);
+    }
+
+    void TaskGroup::cancel() noexcept {
+        cancelled_.store(true, std::memory_order_relaxed);
+    }
+
+    bool TaskGroup::is_cancelled() const noexcept {
+        for (const TaskGroup *g = this; g; g = g->parent_) {
+            if (g->cancelled_.load(std::memory_order_relaxed)) return true;
+        }
+        return false;
+    }
+
+    const TaskGroup *TaskGroup::enter() const noexcept {
+        return std::exchange(tls_group, this);
+    }
+
+    void TaskGroup::leave(const TaskGroup *outer) noexcept {
+        tls_group = outer;
+    }
+
+    void TaskGroup::fail(std::exception_ptr error) noexcept {
+        {
+            std::lock_guard lock(mutex_);
+            if (!error_) error_ = std::move(error);
+        }
+        cancel();
+    }
+
+    void TaskGroup::finish_one() noexcept {
+        std::size_t pending = pending_.load(std::memory_order_relaxed);
+        while (pending > 1) {
+            if (pending_.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel,
+                                               std::memory_order_relaxed)) {
+                return;
+            }
+        }
+        // Possibly the last one: decrement under the mutex, which wait() takes before returning,
+        // so the group cannot be destroyed while we still touch it
+        std::lock_guard lock(mutex_);
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) done_.notify_all();
+    }
+}
@@ -0,0 +1,83 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "tasks/Topology.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace curve::tasks {
+    namespace {
+        int parse_cpu(const std::string &text, const std::string &list) {
+            if (text.empty() || !std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+                throw std::invalid_argument("bad cpu list '" + list + "'");
+            }
+            return std::stoi(text);
+        }
+    }
+
+    std::vector<int> parse_cpu_list(const std::string &list) {
+        std::vector<int> cpus;
+        std::stringstream in(list);
+        std::string range;
+        while (std::getline(in, range, ',')) {
+            range.erase(std::remove_if(range.begin(), range.end(), [](char c) { return c == ' ' || c == '\n'; }),
+                        range.end());
+            if (range.empty()) continue;
+            const auto dash = range.find('-');
+            const int first = parse_cpu(range.substr(0, dash), list);
+            const int last = dash == std::string::npos ? first : parse_cpu(range.substr(dash + 1), list);
+            if (last < first) throw std::invalid_argument("bad cpu list '" + list + "'");
+            for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+        }
+        std::sort(cpus.begin(), cpus.end());
+        cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+        return cpus;
+    }
+
+    std::vector<NumaNode> numa_nodes() {
+        namespace fs = std::filesystem;
+        std::vector<NumaNode> nodes;
+        std::error_code ec;
+        for (const auto &entry: fs::directory_iterator("/sys/devices/system/node", ec)) {
+            const auto name = entry.path().filename().string();
+            if (name.rfind("node", 0) != 0 || name.size() == 4) continue;
+            std::ifstream file(entry.path() / "cpulist");
+            std::string list;
+            if (!file || !std::getline(file, list)) continue;
+            try {
+                NumaNode node{parse_cpu(name.substr(4), name), parse_cpu_list(list)};
+                if (!node.cpus.empty()) nodes.push_back(std::move(node));
+            } catch (const std::invalid_argument &) {
+                // Not a node directory after all
+            }
+        }
+        if (nodes.empty()) nodes.push_back({});
+        std::sort(nodes.begin(), nodes.end(), [](const NumaNode &a, const NumaNode &b) { return a.id < b.id; });
+        return nodes;
+    }
+
+    void pin_current_thread(const std::vector<int> &cpus) {
+#ifdef __linux__
+        if (cpus.empty()) return;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const int cpu: cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        // Best effort: cpus outside the process' cgroup leave the thread where it is
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        static_cast<void>(cpus);
+#endif
+    }
+}
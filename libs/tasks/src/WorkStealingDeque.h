@@ -0,0 +1,118 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TASKS_WORK_STEALING_DEQUE_H
+#define CURVEFORGE_TASKS_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "tasks/Scheduler.h"
+
+namespace curve::tasks::detail {
+    /**
+     * @brief Chase-Lev deque of tasks (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013 orderings).
+     *
+     * The owning worker pushes and pops at the bottom; any thread steals from the top. The ring
+     * grows by doubling on the owner's side; replaced rings stay alive until the deque dies
+     * because a concurrent thief may still be reading from one.
+     */
+    class WorkStealingDeque {
+    public:
+        explicit WorkStealingDeque(std::size_t capacity = 256) {
+            rings_.push_back(std::make_unique<Ring>(capacity));
+            ring_.store(rings_.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque &) = delete;
+
+        WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+        // Owner only
+        void push(Runnable *task) {
+            const std::int64_t b = bottom_.load(std::memory_order_relaxed);
+            const std::int64_t t = top_.load(std::memory_order_acquire);
+            Ring *ring = ring_.load(std::memory_order_relaxed);
+            if (b - t > static_cast<std::int64_t>(ring->mask)) ring = grow(ring, t, b);
+            ring->put(b, task);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only: the most recently pushed task, or nullptr
+        Runnable *pop() {
+            const std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            Ring *ring = ring_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = top_.load(std::memory_order_relaxed);
+            if (t > b) {
+                bottom_.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Runnable *task = ring->get(b);
+            if (t == b) {
+                // Last task: race the thieves for it
+                if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    task = nullptr;
+                }
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        // Any thread: the oldest task, or nullptr when empty or another thread won the race
+        Runnable *steal() {
+            std::int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t b = bottom_.load(std::memory_order_acquire);
+            if (t >= b) return nullptr;
+            Runnable *task = ring_.load(std::memory_order_acquire)->get(t);
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return task;
+        }
+
+        [[nodiscard]] bool looks_empty() const {
+            return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct Ring {
+            explicit Ring(std::size_t capacity) : mask(capacity - 1), slots(new std::atomic<Runnable *>[capacity]) {
+            }
+
+            [[nodiscard]] Runnable *get(std::int64_t i) const {
+                return slots[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, Runnable *task) {
+                slots[static_cast<std::size_t>(i) & mask].store(task, std::memory_order_relaxed);
+            }
+
+            std::size_t mask;
+            std::unique_ptr<std::atomic<Runnable *>[]> slots;
+        };
+
+        Ring *grow(Ring *ring, std::int64_t t, std::int64_t b) {
+            auto bigger = std::make_unique<Ring>(2 * (ring->mask + 1));
+            for (std::int64_t i = t; i < b; ++i) bigger->put(i, ring->get(i));
+            ring = bigger.get();
+            rings_.push_back(std::move(bigger));
+            ring_.store(ring, std::memory_order_release);
+            return ring;
+        }
+
+        alignas(64) std::atomic<std::int64_t> top_{0};
+        alignas(64) std::atomic<std::int64_t> bottom_{0};
+        alignas(64) std::atomic<Ring *> ring_{nullptr};
+        std::vector<std::unique_ptr<Ring> > rings_;
+    };
+}
+
+#endif //CURVEFORGE_TASKS_WORK_STEALING_DEQUE_H
@@ -1,10 +1,20 @@
 #ifndef TIME_DATE_HPP
 #define TIME_DATE_HPP
 #include <chrono>
+#include <cstdint>
 
 namespace curve::time {
     using Date = std::chrono::year_month_day;
 
+    // Days since 1970-01-01, the integer date of compact curves and binary formats
+    inline std::int32_t to_serial(const Date &d) {
+        return static_cast<std::int32_t>(std::chrono::sys_days(d).time_since_epoch().count());
+    }
+
+    inline Date from_serial(std::int32_t serial) {
+        return Date{std::chrono::sys_days{std::chrono::days{serial}}};
+    }
+
     inline std::string to_string(std::chrono::year_month_day ymd) {
         // %F -> YYYY-MM-DD; need a time_point (sys_days) for chrono formatting
         return std::format("{:%F}", std::chrono::sys_days{ymd});
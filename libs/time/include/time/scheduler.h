@@ -4,6 +4,9 @@
 
 #ifndef CURVEFORGE_SCHEDULER_H
 #define CURVEFORGE_SCHEDULER_H
+#include <memory_resource>
+#include <vector>
+
 #include "calendars.hpp"
 #include "date_modifier.hpp"
 #include "time/date.hpp"
@@ -24,11 +27,18 @@ namespace curve {
                                                      calendar(calendar) {
             }
 
+            Schedule(std::vector<AccruedPeriod> &&accruals, const std::chrono::months &freq_monhts,
+                     const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
+                     const CalendarBase &calendar) : accruals(std::move(accruals)), freq_monhts(freq_monhts),
+                                                     bdc(bdc), dc(dc), calendar(calendar) {
+            }
+
             const std::chrono::months &freq_monhts;
             const BusinessDayConvention &bdc;
             const DayCountConventionBase &dc;
             const CalendarBase &calendar;
-            const std::vector<AccruedPeriod> accruals;
+            // Not const, so a generated schedule moves into shared storage (legs hold const Schedules)
+            std::vector<AccruedPeriod> accruals;
         };
 
         class Scheduler {
@@ -37,6 +47,19 @@ namespace curve {
                                               const std::chrono::months &freq_monhts,
                                               const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
                                               const CalendarBase &calendar);
+
+            // Same, with the working storage taken from `scratch` (e.g. a tasks::ScratchArena):
+            // only the returned schedule's accruals come from the global heap
+            static Schedule generate_schedule(Date start_date, Date end_date,
+                                              const std::chrono::months &freq_monhts,
+                                              const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
+                                              const CalendarBase &calendar, std::pmr::memory_resource *scratch);
+
+            // The accrual periods alone, into `accruals` (cleared first; its resource does all the
+            // allocation), for callers that use a schedule once and drop it
+            static void generate_accruals(Date start_date, Date end_date, const std::chrono::months &freq_monhts,
+                                          const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
+                                          const CalendarBase &calendar, std::pmr::vector<AccruedPeriod> &accruals);
         };
     } // time
 } // curve
@@ -1,8 +1,26 @@
 #include "time/calendars.hpp"
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <memory_resource>
 #include <set>
 namespace
 {
+// is_holiday rebuilds the year's holiday set on every call: its nodes go to a stack buffer,
+// so lookups never reach the global allocator (a year has about 20 holidays at most)
+class HolidayBuffer
+{
+  public:
+    std::pmr::memory_resource *resource()
+    {
+        return &resource_;
+    }
+
+  private:
+    std::array<std::byte, 2048> buffer_;
+    std::pmr::monotonic_buffer_resource resource_{buffer_.data(), buffer_.size(), std::pmr::new_delete_resource()};
+};
+
 auto increment1Day = [](auto d, int days)
 { return std::chrono::year_month_day(std::chrono::sys_days(d) + std::chrono::days{days}); };
 
@@ -86,11 +104,12 @@ bool CalendarNYSE::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static NYSE holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),  // New Year's Day
         adjust_observed(year / July / 4),     // Independence Day
         adjust_observed(year / December / 25) // Christmas Day
-    };
+    }, buffer.resource());
 
     // Martin Luther King Jr. Day (Third Monday of January)
     auto mlk_day = year / January / 1;
@@ -122,11 +141,12 @@ bool CalendarLSE::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static LSE holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),   // New Year's Day
         adjust_observed(year / December / 25), // Christmas Day
         adjust_observed(year / December / 26)  // Boxing Day
-    };
+    }, buffer.resource());
 
     // Good Friday (Friday before Easter Sunday)
     auto easter_sunday = year / April / 1;
@@ -167,11 +187,12 @@ bool CalendarTSE::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static TSE holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),   // New Year's Day
         adjust_observed(year / December / 23), // Emperor's Birthday
         adjust_observed(year / December / 25)  // Christmas Day
-    };
+    }, buffer.resource());
 
     // Coming of Age Day (Second Monday of January)
     auto coming_of_age_day = year / January / 1;
@@ -237,12 +258,13 @@ bool CalendarHKEX::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static HKEX holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),  // New Year's Day
         adjust_observed(year / July / 1),     // HKSAR Establishment Day
         adjust_observed(year / October / 1),  // National Day
         adjust_observed(year / December / 25) // Christmas Day
-    };
+    }, buffer.resource());
 
     // Lunar New Year (First three days of the Lunar New Year)
     // Note: This requires a conversion from Gregorian to Lunar calendar, which is complex and not shown here.
@@ -290,13 +312,14 @@ bool CalendarSSE::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static SSE holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1), // New Year's Day
         adjust_observed(year / May / 1),     // Labour Day
         adjust_observed(year / October / 1), // National Day
         adjust_observed(year / October / 2), // National Day Holiday
         adjust_observed(year / October / 3)  // National Day Holiday
-    };
+    }, buffer.resource());
 
     // Chinese New Year (First three days of the Lunar New Year)
     // Note: This requires a conversion from Gregorian to Lunar calendar, which is complex and not shown here.
@@ -326,11 +349,12 @@ bool CalendarEuronext::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static Euronext holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),   // New Year's Day
         adjust_observed(year / December / 25), // Christmas Day
         adjust_observed(year / December / 26)  // Boxing Day
-    };
+    }, buffer.resource());
 
     // Good Friday (Friday before Easter Sunday)
     auto easter_sunday = year / April / 1;
@@ -373,12 +397,13 @@ bool CalendarASX::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static ASX holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),   // New Year's Day
         adjust_observed(year / January / 26),  // Australia Day
         adjust_observed(year / December / 25), // Christmas Day
         adjust_observed(year / December / 26)  // Boxing Day
-    };
+    }, buffer.resource());
 
     // Good Friday (Friday before Easter Sunday)
     auto easter_sunday = year / April / 1;
@@ -417,12 +442,13 @@ bool CalendarTSX::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static TSX holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 1),   // New Year's Day
         adjust_observed(year / July / 1),      // Canada Day
         adjust_observed(year / December / 25), // Christmas Day
         adjust_observed(year / December / 26)  // Boxing Day
-    };
+    }, buffer.resource());
 
     // Family Day (Third Monday of February)
     auto family_day = year / February / 1;
@@ -470,12 +496,13 @@ bool CalendarNSE::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static NSE holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 26), // Republic Day
         adjust_observed(year / August / 15),  // Independence Day
         adjust_observed(year / October / 2),  // Gandhi Jayanti
         adjust_observed(year / December / 25) // Christmas Day
-    };
+    }, buffer.resource());
 
     // Holi (March 10, placeholder date)
     holidays.insert(year / March / 10);
@@ -512,12 +539,13 @@ bool CalendarBSE::is_holiday(const Date &date) const
     auto year = date.year();
 
     // Static BSE holidays
-    std::set<year_month_day> holidays = {
+    HolidayBuffer buffer;
+    std::pmr::set<year_month_day> holidays({
         adjust_observed(year / January / 26), // Republic Day
         adjust_observed(year / August / 15),  // Independence Day
         adjust_observed(year / October / 2),  // Gandhi Jayanti
         adjust_observed(year / December / 25) // Christmas Day
-    };
+    }, buffer.resource());
 
     // Holi (March 10, placeholder date)
     holidays.insert(year / March / 10);
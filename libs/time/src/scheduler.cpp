@@ -3,31 +3,71 @@
 //
 
 #include "time/scheduler.h"
+
+#include <algorithm>
+#include <vector>
+
 #include  "time/date_modifier.hpp"
+#include "metrics/Metrics.h"
 
 namespace curve {
     namespace time {
+        namespace {
+            // Shared body of the overloads: fills `accruals` (std::vector or std::pmr::vector) in date order
+            template<typename Vector>
+            void fill_accruals(Vector &accruals, Date start_date, Date end_date, const std::chrono::months &freq_monhts,
+                               const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
+                               const CalendarBase &calendar) {
+                CURVEFORGE_TIME_SCOPE("schedule.generate");
+                if (start_date > end_date) { throw std::invalid_argument("start_date > end_date"); }
+
+                accruals.clear();
+                if (freq_monhts.count() > 0) {
+                    // One period per frequency step, plus a stub and business day rolls
+                    const long span = (end_date.year() - start_date.year()).count() * 12L +
+                                      static_cast<long>(unsigned(end_date.month())) -
+                                      static_cast<long>(unsigned(start_date.month()));
+                    accruals.reserve(static_cast<std::size_t>(std::max(0L, span / freq_monhts.count()) + 2));
+                }
+
+                auto modified_end_date = DateModifier::adjust(end_date, bdc, calendar);
+                Date current_date = modified_end_date;
+                while (current_date > start_date) {
+                    current_date =
+                            DateModifier::adjust(DateModifier::add_months(current_date, -freq_monhts), bdc, calendar);
+                    double accrued = dc.year_fraction(current_date, modified_end_date);
+                    accruals.push_back({current_date, modified_end_date, accrued});
+                    modified_end_date = current_date;
+                }
+                std::sort(accruals.begin(), accruals.end(), [](const AccruedPeriod &a, const AccruedPeriod &b) {
+                    return a.start_date < b.start_date;
+                });
+                CURVEFORGE_RECORD_VALUE("schedule.periods", accruals.size());
+            }
+        }
+
         Schedule Scheduler::generate_schedule(Date start_date, Date end_date,
                                               const std::chrono::months &freq_monhts,
                                               const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
                                               const CalendarBase &calendar) {
-            if (start_date > end_date) { throw std::invalid_argument("start_date > end_date"); }
-
             std::vector<AccruedPeriod> accruals;
+            fill_accruals(accruals, start_date, end_date, freq_monhts, bdc, dc, calendar);
+            return {std::move(accruals), freq_monhts, bdc, dc, calendar};
+        }
 
-            auto modified_end_date = DateModifier::adjust(end_date, bdc, calendar);
-            Date current_date = modified_end_date;
-            while (current_date > start_date) {
-                current_date =
-                        DateModifier::adjust(DateModifier::add_months(current_date, -freq_monhts), bdc, calendar);
-                double accrued = dc.year_fraction(current_date, modified_end_date);
-                accruals.push_back({current_date, modified_end_date, accrued});
-                modified_end_date = current_date;
-            }
-            std::sort(accruals.begin(), accruals.end(), [](const AccruedPeriod &a, const AccruedPeriod &b) {
-                return a.start_date < b.start_date;
-            });
-            return {accruals, freq_monhts, bdc, dc, calendar};
+        Schedule Scheduler::generate_schedule(Date start_date, Date end_date,
+                                              const std::chrono::months &freq_monhts,
+                                              const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
+                                              const CalendarBase &calendar, std::pmr::memory_resource *scratch) {
+            std::pmr::vector<AccruedPeriod> accruals(scratch);
+            fill_accruals(accruals, start_date, end_date, freq_monhts, bdc, dc, calendar);
+            return {std::vector<AccruedPeriod>(accruals.begin(), accruals.end()), freq_monhts, bdc, dc, calendar};
+        }
+
+        void Scheduler::generate_accruals(Date start_date, Date end_date, const std::chrono::months &freq_monhts,
+                                          const BusinessDayConvention &bdc, const DayCountConventionBase &dc,
+                                          const CalendarBase &calendar, std::pmr::vector<AccruedPeriod> &accruals) {
+            fill_accruals(accruals, start_date, end_date, freq_monhts, bdc, dc, calendar);
         }
     } // time
 } // curve
@@ -0,0 +1,45 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_ASYNCCALIBRATION_H
+#define CURVEFORGE_ASYNCCALIBRATION_H
+
+#include <memory>
+#include <vector>
+
+#include "ImpliedVolSurface.h"
+#include "OptionQuote.h"
+#include "tasks/Cancellation.h"
+#include "tasks/Task.h"
+
+namespace curve::volatility {
+    struct CalibrationResult {
+        std::shared_ptr<ImpliedVolSurface> surface; // nullptr when calibration failed
+        ImpliedVolSurface::CalibrationStats stats{0.0, 0.0, 0.0, 0};
+    };
+
+    /**
+     * @brief Awaitable ImpliedVolSurface::calibrate on the shared task pool.
+     *
+     * Calibrates a fresh surface, so readers of the current one are never disturbed; swap it in
+     * when the task completes. A cancelled token throws tasks::OperationCancelled before the
+     * calibration and before the fit statistics.
+     */
+    tasks::Task<CalibrationResult> calibrate_async(
+        std::vector<OptionQuote> quotes,
+        ImpliedVolSurface::SurfaceType surface_type = ImpliedVolSurface::SurfaceType::LOG_MONEYNESS_SPACE,
+        ImpliedVolSurface::InterpolationMethod interp_method = ImpliedVolSurface::InterpolationMethod::BICUBIC_SPLINE,
+        double risk_free_rate = 0.0,
+        tasks::CancellationToken token = {});
+
+    // One calibration per underlying, run concurrently; results in input order
+    tasks::Task<std::vector<CalibrationResult> > calibrate_all_async(
+        std::vector<std::vector<OptionQuote> > quotes_by_underlying,
+        ImpliedVolSurface::SurfaceType surface_type = ImpliedVolSurface::SurfaceType::LOG_MONEYNESS_SPACE,
+        ImpliedVolSurface::InterpolationMethod interp_method = ImpliedVolSurface::InterpolationMethod::BICUBIC_SPLINE,
+        double risk_free_rate = 0.0,
+        tasks::CancellationToken token = {});
+}
+
+#endif //CURVEFORGE_ASYNCCALIBRATION_H
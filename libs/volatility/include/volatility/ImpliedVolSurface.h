@@ -89,6 +89,18 @@ namespace curve::volatility {
          */
         bool import_from_vol_surface(const vol::VolSurface &surface);
 
+        /**
+         * @brief Import already calibrated points (strike coordinate, maturity, volatility)
+         * and build the interpolation structure. Used by streaming and binary loaders which
+         * do not go through the XSD types.
+         */
+        bool import_from_points(std::vector<VolPoint> points);
+
+        /**
+         * @brief Convert an expiry tenor ("1M", "6M", "2Y", "30D") to years (simplified ACT/365)
+         */
+        static double expiry_to_years(const std::string &tenor);
+
         /**
          * @brief Get all calibrated volatility points
          */
@@ -0,0 +1,34 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include "volatility/AsyncCalibration.h"
+
+namespace curve::volatility {
+    tasks::Task<CalibrationResult> calibrate_async(std::vector<OptionQuote> quotes,
+                                                   ImpliedVolSurface::SurfaceType surface_type,
+                                                   ImpliedVolSurface::InterpolationMethod interp_method,
+                                                   double risk_free_rate, tasks::CancellationToken token) {
+        co_await tasks::schedule(token);
+        auto surface = std::make_shared<ImpliedVolSurface>(surface_type, interp_method, risk_free_rate);
+        CalibrationResult result;
+        if (surface->calibrate(quotes)) {
+            token.throw_if_cancelled();
+            result.stats = surface->get_calibration_stats(quotes);
+            result.surface = std::move(surface);
+        }
+        co_return result;
+    }
+
+    tasks::Task<std::vector<CalibrationResult> > calibrate_all_async(
+        std::vector<std::vector<OptionQuote> > quotes_by_underlying, ImpliedVolSurface::SurfaceType surface_type,
+        ImpliedVolSurface::InterpolationMethod interp_method, double risk_free_rate,
+        tasks::CancellationToken token) {
+        std::vector<tasks::Task<CalibrationResult> > jobs;
+        jobs.reserve(quotes_by_underlying.size());
+        for (auto &quotes: quotes_by_underlying) {
+            jobs.push_back(calibrate_async(std::move(quotes), surface_type, interp_method, risk_free_rate, token));
+        }
+        co_return co_await tasks::when_all(std::move(jobs));
+    }
+}
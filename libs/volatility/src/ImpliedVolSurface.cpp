@@ -10,6 +10,7 @@
 #include <set>
 
 #include "analytical_pricers/BlackScholes.h"
+#include "metrics/Metrics.h"
 
 namespace curve::volatility {
     using namespace curve::analytical_pricers;
@@ -24,6 +25,7 @@ namespace curve::volatility {
     }
 
     bool ImpliedVolSurface::calibrate(const std::vector<OptionQuote> &quotes) {
+        CURVEFORGE_TIME_SCOPE("vol_surface.calibrate");
         if (quotes.empty()) {
             return false;
         }
@@ -315,33 +317,44 @@ namespace curve::volatility {
     }
 
     bool ImpliedVolSurface::import_from_vol_surface(const vol::VolSurface &surface) {
-        calibrated_points_.clear();
-
-        const auto &points = surface.points().point();
-
-        for (const auto &point: points) {
-            // Parse tenor to years (simplified)
-            std::string tenor_str = point.expiry();
-            double maturity = 0.0;
-
-            if (tenor_str.back() == 'Y') {
-                maturity = std::stod(tenor_str.substr(0, tenor_str.size() - 1));
-            } else if (tenor_str.back() == 'M') {
-                maturity = std::stod(tenor_str.substr(0, tenor_str.size() - 1)) / 12.0;
-            } else if (tenor_str.back() == 'D') {
-                maturity = std::stod(tenor_str.substr(0, tenor_str.size() - 1)) / 365.0;
-            }
+        std::vector<VolPoint> points;
+        points.reserve(surface.points().point().size());
 
+        for (const auto &point: surface.points().point()) {
+            double maturity = expiry_to_years(point.expiry());
             double strike_coord = point.strikeCoordinate();
             double volatility = point.volatility();
 
-            calibrated_points_.emplace_back(strike_coord, maturity, volatility, strike_coord);
+            points.emplace_back(strike_coord, maturity, volatility, strike_coord);
         }
 
+        return import_from_points(std::move(points));
+    }
+
+    bool ImpliedVolSurface::import_from_points(std::vector<VolPoint> points) {
+        calibrated_points_ = std::move(points);
+        strike_splines_.clear();
         build_interpolation_grid();
         return !calibrated_points_.empty();
     }
 
+    double ImpliedVolSurface::expiry_to_years(const std::string &tenor_str) {
+        // Parse tenor to years (simplified)
+        if (tenor_str.empty()) {
+            return 0.0;
+        }
+        if (tenor_str.back() == 'Y') {
+            return std::stod(tenor_str.substr(0, tenor_str.size() - 1));
+        }
+        if (tenor_str.back() == 'M') {
+            return std::stod(tenor_str.substr(0, tenor_str.size() - 1)) / 12.0;
+        }
+        if (tenor_str.back() == 'D') {
+            return std::stod(tenor_str.substr(0, tenor_str.size() - 1)) / 365.0;
+        }
+        return 0.0;
+    }
+
     ImpliedVolSurface::CalibrationStats ImpliedVolSurface::get_calibration_stats(
         const std::vector<OptionQuote> &quotes
     ) const {
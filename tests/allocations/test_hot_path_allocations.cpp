@@ -0,0 +1,155 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "analytical_pricers/BlackScholes.h"
+#include "curve/FlatRateCurve.h"
+#include "curve/InterpolatedZeroCurve.h"
+#include "instruments/FixFloatSwap.h"
+#include "instruments/Leg.h"
+#include "pricing/FixFloatSwapPricer.h"
+#include "signal/CrossMovingAverage.h"
+#include "signal/ExponentialMovingAverage.h"
+#include "signal/TimeDecayEMA.h"
+#include "time/calendar_factory.hpp"
+#include "time/date_modifier.hpp"
+#include "time/daycount.hpp"
+
+// Hot paths that must not touch the heap once warmed up. A new allocation in any of them
+// fails this test; fix the allocation rather than the expectation.
+namespace {
+    using namespace std::chrono;
+    using namespace curve;
+    using curve::testing::count_allocations;
+
+    const time::Date kCob{year{2026}, February, day{10}};
+
+    time::Date plus_days(const time::Date &d, int n) { return time::Date{sys_days(d) + days{n}}; }
+
+    int failures = 0;
+
+    // Calls f once to warm up lazily initialised state, then requires zero allocations over many calls
+    template<typename F>
+    void expect_no_allocations(const std::string &name, F &&f) {
+        f();
+        const auto stats = count_allocations(f, 1000);
+        if (stats.allocations != 0) {
+            std::cerr << name << ": " << stats.allocations << " allocations, " << stats.bytes << " bytes\n";
+            ++failures;
+        }
+    }
+}
+
+int main() {
+    // The harness itself counts what it should
+    const auto sanity = count_allocations([] { const std::vector<int> v(10); });
+    if (sanity.allocations != 1 || sanity.deallocations != 1 || sanity.bytes != 10 * sizeof(int)) {
+        std::cerr << "allocation counter is not active\n";
+        return 1;
+    }
+
+    // Curve lookup
+    std::vector<Pillar> pillars;
+    const double zeros[] = {0.021, 0.0235, 0.0252, 0.0268, 0.0281};
+    const int offsets[] = {30, 365, 1096, 1826, 3652};
+    for (int i = 0; i < 5; ++i) pillars.emplace_back(plus_days(kCob, offsets[i]), zeros[i]);
+    for (const auto mode: {
+             InterpolationMode::LINEAR_ZERO, InterpolationMode::LINEAR_DISCOUNT,
+             InterpolationMode::LOG_LINEAR_DISCOUNT
+         }) {
+        const InterpolatedZeroCurve curve("EUR-OIS", kCob, std::vector<Pillar>(pillars),
+                                          time::create_daycount_convention(time::DayCountConvention::ACT_365F), mode);
+        int day = 0;
+        double sink = 0.0;
+        expect_no_allocations("ICurve::D", [&] { sink += curve.D(plus_days(kCob, day++ % 4000)); });
+        expect_no_allocations("ICurve::F", [&] {
+            sink += curve.F(plus_days(kCob, day % 3000), plus_days(kCob, day % 3000 + 182));
+            ++day;
+        });
+    }
+    const FlatRateCurve flat(kCob, 0.03);
+    expect_no_allocations("FlatRateCurve::D", [&] { (void) flat.D(plus_days(kCob, 400)); });
+
+    // Batch Black-Scholes over preallocated arrays
+    {
+        using analytical_pricers::BlackScholes;
+        const std::size_t n = 256;
+        std::vector<double> strikes(n), prices(n), vegas(n), vols(n);
+        for (std::size_t i = 0; i < n; ++i) strikes[i] = 60.0 + 80.0 * static_cast<double>(i) / n;
+        expect_no_allocations("BlackScholes batch", [&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                prices[i] = BlackScholes::call_price(100.0, strikes[i], 0.02, 0.25, 1.5);
+                vegas[i] = BlackScholes::vega(100.0, strikes[i], 0.02, 0.25, 1.5);
+            }
+        });
+        expect_no_allocations("BlackScholes implied vol", [&] {
+            for (std::size_t i = 0; i < n; i += 16) {
+                vols[i] = BlackScholes::implied_volatility(prices[i], 100.0, strikes[i], 0.02, 1.5, true);
+            }
+        });
+    }
+
+    // EMA updates
+    {
+        auto ema = forge::signal::ExponentialMovingAverage::from_period(20);
+        forge::signal::CrossMovingAverage cma(12, 26);
+        forge::signal::TimeDecayEMA decay(milliseconds(500));
+        const time::Instant t0{};
+        int i = 0;
+        expect_no_allocations("ExponentialMovingAverage::update", [&] { ema.update(100.0 + i++ % 7); });
+        expect_no_allocations("CrossMovingAverage::update", [&] { cma.update(100.0 + i++ % 7); });
+        expect_no_allocations("TimeDecayEMA::update", [&] {
+            decay.update(t0 + milliseconds(37 * i), 100.0 + i % 7);
+            ++i;
+        });
+        const std::vector<time::Instant> times{t0, t0 + milliseconds(5), t0 + milliseconds(40)};
+        const std::vector<double> samples{1.0, 2.0, 3.0};
+        std::vector<double> out;
+        forge::signal::TimeDecayEMA batch(milliseconds(500));
+        expect_no_allocations("TimeDecayEMA::update_batch", [&] {
+            batch.reset();
+            batch.update_batch(times, samples, out);
+        });
+    }
+
+    // Holiday lookups and business day rolls, on every calendar
+    for (int c = 0; c <= static_cast<int>(time::FinancialCalendar::NSE); ++c) {
+        const auto cal = time::create_calendar(static_cast<time::FinancialCalendar>(c));
+        int day = 0;
+        bool sink = false;
+        expect_no_allocations("CalendarBase::is_holiday", [&] { sink ^= cal->is_holiday(plus_days(kCob, day++)); });
+        expect_no_allocations("DateModifier::adjust", [&] {
+            sink ^= time::DateModifier::adjust(plus_days(kCob, day++), time::BusinessDayConvention::MODIFIED_FOLLOWING,
+                                               *cal) == kCob;
+        });
+    }
+
+    // Swap pricer inner loop on an existing swap and market
+    {
+        const auto cal = time::create_calendar(time::FinancialCalendar::NYSE);
+        const auto dc = time::create_daycount_convention(time::DayCountConvention::ACT_360);
+        const time::Date start = kCob + months{3};
+        const time::Date end = kCob + months{63};
+        const months freq{6};
+        const instruments::Leg fixed(1e6, "EUR", start, end, freq, *cal, time::BusinessDayConvention::FOLLOWING, *dc,
+                                     instruments::Leg::FIXED);
+        const instruments::Leg floating(1e6, "EUR", start, end, freq, *cal, time::BusinessDayConvention::FOLLOWING,
+                                        *dc, instruments::Leg::FLOATING);
+        const instruments::FixFloatSwap swap(fixed, floating);
+        const auto md = std::make_shared<market::MarketData>(market::MarketData{
+            .snap_time = sys_days(kCob),
+            .curves_ois = {{"EUR", std::make_shared<FlatRateCurve>(kCob, 0.03)}},
+            .curves_funding = {{"EUR", std::make_shared<FlatRateCurve>(kCob, 0.035)}}
+        });
+        const pricing::FixFloatSwapPricer pricer;
+        double sink = 0.0;
+        expect_no_allocations("FixFloatSwapPricer::price", [&] { sink += pricer.price(swap, md); });
+    }
+
+    if (failures != 0) return 1;
+    std::cout << "ZERO_ALLOC_OK" << std::endl;
+    return 0;
+}
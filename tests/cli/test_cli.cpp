@@ -0,0 +1,183 @@
+#include <chrono>
+#include <cmath>
+#include <initializer_list>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "CliOptions.h"
+#include "Revaluation.h"
+#include "curve/FlatRateCurve.h"
+#include "pricing/FixFloatSwapPricer.h"
+#include "time/calendar_factory.hpp"
+#include "time/daycount.hpp"
+
+using namespace curve;
+using namespace curve::instruments;
+using namespace curve::time;
+using namespace std::chrono;
+
+namespace {
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    cli::CliOptions parse(std::initializer_list<const char *> args) {
+        std::vector<const char *> argv{"curveforge-cli"};
+        argv.insert(argv.end(), args.begin(), args.end());
+        return cli::parse_options(static_cast<int>(argv.size()), argv.data());
+    }
+
+    // parse_options throws std::invalid_argument whose message contains `expected`
+    bool rejects(std::vector<const char *> args, const std::string &expected) {
+        args.insert(args.begin(), "curveforge-cli");
+        try {
+            (void) cli::parse_options(static_cast<int>(args.size()), args.data());
+            return false;
+        } catch (const std::invalid_argument &e) {
+            if (std::string(e.what()).find(expected) != std::string::npos) return true;
+            std::cerr << "expected '" << expected << "', got '" << e.what() << "'\n";
+            return false;
+        }
+    }
+
+    bool check_options() {
+        const auto options = parse({
+            "--portfolio", "book.xml", "--market", "market.cfsnap", "--format", "columnar", "-o", "pv.cfcol",
+            "--threads", "3", "--chunk-size", "64", "--numa", "--discount", "EUR=EUR-ESTR", "--forward",
+            "EUR=EUR-6M"
+        });
+        if (options.portfolio_path != "book.xml" || options.market_path != "market.cfsnap") return false;
+        if (options.output_path != "pv.cfcol" || options.format != cli::OutputFormat::COLUMNAR) return false;
+        if (options.threads != 3 || options.chunk_size != 64 || !options.numa) return false;
+        if (options.discount_curves.at("EUR") != "EUR-ESTR" || options.forward_curves.at("EUR") != "EUR-6M") {
+            return false;
+        }
+
+        // Defaults, and --help short-circuits the required options
+        const auto defaults = parse({"--portfolio", "book.xml", "--market", "market.xml"});
+        if (defaults.output_path != "-" || defaults.format != cli::OutputFormat::CSV || defaults.numa) return false;
+        if (defaults.chunk_size != 256 || defaults.threads == 0) return false;
+        if (!parse({"--help"}).help) return false;
+
+        // Missing values
+        if (!rejects({"--portfolio", "book.xml", "--market"}, "missing value for --market")) return false;
+        if (!rejects({"--market", "market.xml"}, "--portfolio and --market are required")) return false;
+
+        // Bad values
+        const auto with_required = [](std::initializer_list<const char *> extra) {
+            std::vector<const char *> args{"--portfolio", "book.xml", "--market", "market.xml"};
+            args.insert(args.end(), extra.begin(), extra.end());
+            return args;
+        };
+        return rejects(with_required({"--threads", "0"}), "--threads expects a positive integer, got '0'") &&
+               rejects(with_required({"--threads", "4x"}), "--threads expects a positive integer, got '4x'") &&
+               rejects(with_required({"--chunk-size", "-1"}), "--chunk-size expects a positive integer") &&
+               rejects(with_required({"--format", "xml"}), "unknown --format 'xml'") &&
+               rejects(with_required({"--format", "columnar"}), "--format columnar needs an --output file") &&
+               rejects(with_required({"--discount", "EUR"}), "--discount expects CCY=CURVE_ID, got 'EUR'") &&
+               rejects(with_required({"--forward", "=EUR-6M"}), "--forward expects CCY=CURVE_ID") &&
+               rejects(with_required({"--seed", "42"}), "unknown option --seed");
+    }
+
+    std::shared_ptr<market::MarketData> flat_market(const Date &cob, double discount, double forward) {
+        std::shared_ptr<ICurve> d = std::make_shared<FlatRateCurve>(cob, discount);
+        std::shared_ptr<ICurve> f = std::make_shared<FlatRateCurve>(cob, forward);
+        return std::make_shared<market::MarketData>(market::MarketData{
+            .snap_time = sys_days(cob), .curves_ois = {{"EUR", d}, {"USD", d}},
+            .curves_funding = {{"EUR", f}, {"USD", f}}
+        });
+    }
+
+    // Reference value of one trade, straight from the pricer
+    double reference_pv(const pricing::FixFloatSwapPricer &pricer, const FixFloatSwap &swap,
+                        const SwapTradeInfo &info, const std::shared_ptr<market::MarketData> &md) {
+        const auto &discount = *md->curves_ois.at(swap.leg1().currency());
+        double annuity = 0.0;
+        for (const auto &period: swap.get_leg1_payment_dates().accruals) {
+            annuity += period.accrual * discount.D(period.end_date);
+        }
+        const double sign = info.pay_fixed ? 1.0 : -1.0;
+        return sign * swap.leg1().notional() * annuity * (pricer.price(swap, md) - info.fixed_rate);
+    }
+
+    bool check_revaluation() {
+        auto calendar = create_calendar(FinancialCalendar::NYSE);
+        auto dc = create_daycount_convention(DayCountConvention::ACT_360);
+        const Date cob = year{2026} / January / day{5};
+
+        // Two currencies interleaved, and one GBP trade the market has no curves for
+        const std::vector<std::string> currencies{"USD", "EUR", "USD", "GBP", "EUR", "EUR"};
+        InstrumentStore store;
+        store.reserve_fix_float_swaps(currencies.size());
+        for (std::size_t i = 0; i < currencies.size(); ++i) {
+            const Date start = cob + months{1 + static_cast<int>(i)};
+            const Date end = start + years{2 + static_cast<int>(i)};
+            const double notional = 1e6 * static_cast<double>(i + 1);
+            Leg fixed(notional, currencies[i], start, end, months{6}, *calendar, BusinessDayConvention::FOLLOWING,
+                      *dc, Leg::FIXED);
+            Leg floating(notional, currencies[i], start, end, months{3}, *calendar,
+                         BusinessDayConvention::FOLLOWING, *dc, Leg::FLOATING);
+            store.emplace_fix_float_swap(i, SwapTradeInfo{"T" + std::to_string(i), 0.025 + 0.002 * i, i % 2 == 0},
+                                         fixed, floating);
+        }
+        store.finalize();
+
+        cli::CalibratedMarket market;
+        market.base = flat_market(cob, 0.030, 0.032);
+        market.up = flat_market(cob, 0.030 + cli::kBumpSize, 0.032 + cli::kBumpSize);
+        market.down = flat_market(cob, 0.030 - cli::kBumpSize, 0.032 - cli::kBumpSize);
+
+        // Grouped by currency, stable within a currency
+        const auto plan = cli::schedule(store, 2);
+        if (plan.slots != std::vector<std::size_t>{1, 4, 5, 3, 0, 2} || plan.chunk_count() != 3) return false;
+
+        const auto results = cli::revalue(store, plan, market, 2);
+        if (results.size() != currencies.size() || results.failed != 1) return false;
+
+        const pricing::FixFloatSwapPricer pricer;
+        for (std::size_t row = 0; row < results.size(); ++row) {
+            const auto slot = plan.slots[row];
+            const auto &info = store.trade_info(slot);
+            const auto &swap = *store.fix_float_swap(slot);
+            if (results.trade_ids[row] != info.trade_id) return false;
+            if (currencies[slot] == "GBP") {
+                if (results.errors[row].empty() || !std::isnan(results.pv[row]) || !std::isnan(results.dv01[row])) {
+                    return false;
+                }
+                continue;
+            }
+            if (!results.errors[row].empty()) return false;
+
+            const double base = reference_pv(pricer, swap, info, market.base);
+            const double up = reference_pv(pricer, swap, info, market.up);
+            const double down = reference_pv(pricer, swap, info, market.down);
+            const double tol = 1e-9 * swap.leg1().notional();
+            if (std::abs(results.pv[row] - base) > tol) return false;
+            if (std::abs(results.par_rate[row] - pricer.price(swap, market.base)) > 1e-14) return false;
+            if (std::abs(results.dv01[row] - 0.5 * (up - down)) > tol) return false;
+            if (std::abs(results.gamma[row] - (up - 2.0 * base + down)) > tol) return false;
+            // Payer swaps gain when rates rise
+            if ((results.dv01[row] > 0.0) != info.pay_fixed) return false;
+        }
+
+        // The NUMA path prices the same rows to the same values
+        const auto sharded = cli::revalue_numa(store, plan, market, 2);
+        if (sharded.trade_ids != results.trade_ids || sharded.failed != results.failed) return false;
+        for (std::size_t row = 0; row < results.size(); ++row) {
+            if (!results.errors[row].empty()) continue;
+            if (sharded.pv[row] != results.pv[row] || sharded.dv01[row] != results.dv01[row]) return false;
+        }
+        return true;
+    }
+}
+
+int main() {
+    if (!check_options()) return fail("option parsing failed");
+    if (!check_revaluation()) return fail("revaluation failed");
+    std::cout << "CLI_OK" << std::endl;
+    return 0;
+}
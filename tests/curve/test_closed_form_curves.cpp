@@ -0,0 +1,103 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "curve/FlatRateCurve.h"
+#include "curve/InterpolatedZeroCurve.h"
+#include "curve/NelsonSiegelSvenssonCurve.h"
+
+using namespace curve;
+using namespace std::chrono;
+
+namespace {
+    const time::Date kCob{year{2026}, February, day{13}};
+
+    time::Date plus_days(const time::Date &d, int n) { return time::Date{sys_days(d) + days{n}}; }
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    bool close(double a, double b, double tol = 1e-14) { return std::abs(a - b) <= tol * std::max(1.0, std::abs(b)); }
+}
+
+int main() {
+    // Flat: closed form, bit-identical to interpolating its own two pillars inside the tabulated range
+    const FlatRateCurve flat(kCob, 0.031);
+    const InterpolatedZeroCurve tabulated("FLAT", kCob, std::vector<Pillar>(flat.pillars()),
+                                          time::create_daycount_convention(time::DayCountConvention::ACT_365F));
+    if (flat.kind() != CurveKind::FLAT || tabulated.kind() != CurveKind::INTERPOLATED) return fail("flat kind");
+    for (int d = -30; d < 36400; d += 7) {
+        const auto t = plus_days(kCob, d);
+        if (flat.D(t) != tabulated.D(t)) return fail("flat D at day " + std::to_string(d));
+        if (d >= 0 && flat.F(t, plus_days(t, 91)) != tabulated.F(t, plus_days(t, 91))) {
+            return fail("flat F at day " + std::to_string(d));
+        }
+    }
+    // ...and keeps extrapolating past the last pillar instead of clamping to it
+    const auto far = plus_days(kCob, 40000);
+    if (!close(flat.D(far), std::exp(-0.031 * 40000 / 365.0))) return fail("flat extrapolation");
+
+    // Nelson–Siegel–Svensson against the formula written out
+    const NssParameters p{.beta0 = 0.04, .beta1 = -0.015, .beta2 = 0.02, .beta3 = -0.01, .tau1 = 1.8, .tau2 = 7.5};
+    const NelsonSiegelSvenssonCurve nss("NSS", kCob, p);
+    if (nss.kind() != CurveKind::NELSON_SIEGEL_SVENSSON || nss.name() != "NSS") return fail("nss kind");
+    for (int d = 1; d < 20000; d += 13) {
+        const double t = d / 365.0;
+        const double e1 = std::exp(-t / p.tau1);
+        const double e2 = std::exp(-t / p.tau2);
+        const double l1 = (1.0 - e1) / (t / p.tau1);
+        const double l2 = (1.0 - e2) / (t / p.tau2);
+        const double z = p.beta0 + p.beta1 * l1 + p.beta2 * (l1 - e1) + p.beta3 * (l2 - e2);
+        if (!close(nss.D(plus_days(kCob, d)), std::exp(-z * t), 1e-12)) return fail("nss D at day " + std::to_string(d));
+    }
+    if (nss.D(kCob) != 1.0 || nss.D(plus_days(kCob, -10)) != 1.0) return fail("nss before cob");
+    if (!close(nss_zero_rate(p, 0.0), p.beta0 + p.beta1) || !close(nss_zero_rate(p, 1e-10), p.beta0 + p.beta1, 1e-9)) {
+        return fail("nss short end");
+    }
+    if (std::abs(nss_zero_rate(p, 1000.0) - p.beta0) > 1e-3) return fail("nss long end");
+    const auto t1 = plus_days(kCob, 400);
+    const auto t2 = plus_days(kCob, 582);
+    if (!close(nss.F(t1, t2), (nss.D(t1) / nss.D(t2) - 1.0) / (182 / 365.0), 1e-12)) return fail("nss F");
+
+    // Nelson–Siegel is the beta3 = 0 special case; the pillars tabulate the closed form
+    const NelsonSiegelSvenssonCurve ns("NS", kCob, {.beta0 = 0.03, .beta1 = 0.01, .beta2 = -0.02, .tau1 = 2.0});
+    for (const auto &pillar: ns.pillars()) {
+        const double t = ns.year_fraction(pillar.get_time());
+        if (!close(ns.D(pillar.get_time()), std::exp(-pillar.get_value() * t))) return fail("ns pillar");
+    }
+    try {
+        NelsonSiegelSvenssonCurve bad("BAD", kCob, {.tau1 = 0.0});
+        return fail("tau1 = 0 accepted");
+    } catch (const std::invalid_argument &) {
+    }
+
+    // Batch evaluation matches D() for every kind, clones keep the kind
+    std::vector<time::Date> dates;
+    for (int d = -5; d < 12000; d += 17) dates.push_back(plus_days(kCob, d));
+    std::vector<double> out(dates.size());
+    for (const ICurve *curve: {static_cast<const ICurve *>(&flat), static_cast<const ICurve *>(&tabulated),
+                               static_cast<const ICurve *>(&nss)}) {
+        curve->D(dates, out);
+        for (std::size_t i = 0; i < dates.size(); ++i) {
+            if (out[i] != curve->D(dates[i])) return fail(curve->name() + " batch D");
+        }
+        const auto copy = curve->clone();
+        if (copy->kind() != curve->kind() || copy->D(dates.back()) != curve->D(dates.back())) {
+            return fail(curve->name() + " clone");
+        }
+    }
+    try {
+        nss.D(dates, std::span<double>(out).first(3));
+        return fail("batch size mismatch accepted");
+    } catch (const std::invalid_argument &) {
+    }
+
+    std::cout << "CLOSED_FORM_CURVES_OK" << std::endl;
+    return 0;
+}
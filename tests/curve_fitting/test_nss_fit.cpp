@@ -0,0 +1,124 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "curve/NelsonSiegelSvenssonCurve.h"
+#include "curve_fitting/NssFitter.h"
+#include "tasks/Scheduler.h"
+
+using namespace curve;
+using namespace curve::fitting;
+
+namespace {
+    const double kMaturities[] = {0.25, 0.5, 1, 2, 3, 4, 5, 7, 10, 12, 15, 20, 25, 30};
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    std::vector<NssObservation> yields(const NssParameters &p, std::mt19937_64 *noise = nullptr) {
+        std::normal_distribution<double> bp(0.0, 1e-4);
+        std::vector<NssObservation> out;
+        for (const double t: kMaturities) out.push_back({t, nss_zero_rate(p, t) + (noise ? bp(*noise) : 0.0)});
+        return out;
+    }
+}
+
+int main() {
+    tasks::Scheduler::configure({4, {}});
+    const NssParameters truth{.beta0 = 0.035, .beta1 = -0.02, .beta2 = 0.015, .beta3 = -0.01, .tau1 = 1.5, .tau2 = 9.0};
+    const auto exact = yields(truth);
+
+    // At the true taus the profile recovers the betas exactly
+    const NssProfile profile(exact);
+    const auto at_truth = profile.at(truth.tau1, truth.tau2);
+    if (std::abs(at_truth.parameters.beta0 - truth.beta0) > 1e-9 || std::abs(at_truth.parameters.beta3 - truth.beta3) > 1e-9
+        || at_truth.sse > 1e-20) {
+        return fail("profile at the true taus");
+    }
+
+    // Analytic tau gradient against central differences, on noisy yields
+    std::mt19937_64 rng(7);
+    const auto noisy = yields(truth, &rng);
+    const NssProfile noisy_profile(noisy);
+    for (const auto &[tau1, tau2]: {std::pair{0.7, 6.0}, std::pair{2.5, 12.0}, std::pair{4.0, 25.0}}) {
+        const auto p = noisy_profile.at(tau1, tau2);
+        const double h1 = 1e-6 * tau1;
+        const double h2 = 1e-6 * tau2;
+        const double fd1 = (noisy_profile.at(tau1 + h1, tau2).sse - noisy_profile.at(tau1 - h1, tau2).sse) / (2 * h1);
+        const double fd2 = (noisy_profile.at(tau1, tau2 + h2).sse - noisy_profile.at(tau1, tau2 - h2).sse) / (2 * h2);
+        if (std::abs(p.d_tau1 - fd1) > 1e-5 * std::abs(fd1) + 1e-14 ||
+            std::abs(p.d_tau2 - fd2) > 1e-5 * std::abs(fd2) + 1e-14) {
+            return fail("gradient at tau1 = " + std::to_string(tau1) + ": " + std::to_string(p.d_tau1) + " vs " +
+                        std::to_string(fd1) + ", " + std::to_string(p.d_tau2) + " vs " + std::to_string(fd2));
+        }
+    }
+
+    // Coinciding taus make the hump regressors collinear; the profile stays finite
+    const auto degenerate = noisy_profile.at(5.0, 5.0);
+    if (!std::isfinite(degenerate.sse) || !std::isfinite(degenerate.d_tau1) || !std::isfinite(degenerate.d_tau2)) {
+        return fail("profile at tau1 == tau2");
+    }
+
+    // Exact yields are reproduced; the fitted curve discounts with the fitted parameters
+    const auto fit = fit_nss(exact);
+    if (!(fit.rmse < 1e-6)) return fail("exact fit rmse " + std::to_string(fit.rmse));
+    for (const double t: kMaturities) {
+        if (std::abs(nss_zero_rate(fit.parameters, t) - nss_zero_rate(truth, t)) > 5e-6) return fail("exact fit yields");
+    }
+    const time::Date cob{std::chrono::year{2026}, std::chrono::February, std::chrono::day{13}};
+    const NelsonSiegelSvenssonCurve fitted("FIT", cob, fit.parameters);
+    const int days_out[] = {0, 182, 365, 3650, 10950};
+    std::vector<double> times;
+    for (const int d: days_out) times.push_back(d / 365.0);
+    std::vector<double> dfs(times.size());
+    nss_discount_factors(fit.parameters, times, dfs);
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        const time::Date d{std::chrono::sys_days(cob) + std::chrono::days{days_out[i]}};
+        if (fitted.D(d) != dfs[i]) return fail("batch discount factors");
+    }
+
+    // Historical panel: a drifting curve with 1bp noise, fitted in parallel, same results as one by one
+    std::vector<std::vector<NssObservation> > panel;
+    std::mt19937_64 history(2026);
+    for (int day = 0; day < 300; ++day) {
+        NssParameters p = truth;
+        p.beta0 += 0.01 * std::sin(day / 40.0);
+        p.beta1 += 0.015 * std::cos(day / 55.0);
+        p.beta2 += 0.01 * std::sin(day / 25.0);
+        p.tau1 = 1.0 + 0.8 * (1.0 + std::sin(day / 30.0));
+        panel.push_back(yields(p, &history));
+    }
+    const auto fits = fit_nss_panel(panel);
+    if (fits.size() != panel.size()) return fail("panel size");
+    for (std::size_t day = 0; day < panel.size(); ++day) {
+        const auto one = fit_nss(panel[day]);
+        if (fits[day].rmse != one.rmse || fits[day].parameters.tau1 != one.parameters.tau1) {
+            return fail("panel day " + std::to_string(day) + " differs from a single fit");
+        }
+        // Noise is 1bp, so a good fit leaves about that much
+        if (!(fits[day].rmse < 1.5e-4)) return fail("panel day " + std::to_string(day) + " rmse " +
+                                                      std::to_string(fits[day].rmse));
+    }
+
+    try {
+        (void) fit_nss(std::vector<NssObservation>(exact.begin(), exact.begin() + 3));
+        return fail("three observations accepted");
+    } catch (const std::invalid_argument &) {
+    }
+    try {
+        auto bad = exact;
+        bad[2].maturity = -1.0;
+        (void) fit_nss(bad);
+        return fail("negative maturity accepted");
+    } catch (const std::invalid_argument &) {
+    }
+
+    std::cout << "NSS_FIT_OK" << std::endl;
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include "time/daycount.hpp"
 #include "curve/FlatRateCurve.h"
 #include "instruments/FixFloatSwap.h"
+#include "instruments/InstrumentStore.h"
 
 using namespace curve::instruments;
 using namespace curve::time;
@@ -47,6 +48,28 @@ int main() {
     // Using an epsilon for floating point comparison.
     //assert(std::abs(rate - 0.039) < 1e-2);
 
+    // Curve replicas are independent copies with the same values
+    const auto clone = discount_curve.clone();
+    assert(clone.get() != &discount_curve);
+    assert(clone->D(end) == discount_curve.D(end));
+
+    // A shard is a renumbered deep copy of the selected slots; legs sharing a schedule share its copy
+    InstrumentStore store;
+    store.reserve_fix_float_swaps(3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        store.emplace_fix_float_swap(i, SwapTradeInfo{"T" + std::to_string(i), 0.01 * i, i == 1}, leg1, leg2);
+    }
+    store.finalize();
+    const auto shard = store.shard({2, 0});
+    assert(shard.size() == 2);
+    assert(shard.trade_info(0).trade_id == "T2" && shard.trade_info(1).trade_id == "T0");
+    assert(shard.find("T1") == nullptr && shard.find("T0") == shard.fix_float_swap(1));
+    const auto &copy = *shard.fix_float_swap(0);
+    assert(&copy.get_leg1_payment_dates() != &store.fix_float_swap(2)->get_leg1_payment_dates());
+    assert(&copy.get_leg1_payment_dates() == &shard.fix_float_swap(1)->get_leg1_payment_dates());
+    assert(copy.get_leg1_payment_dates().accruals.size() == leg1.cashflows_schedule().accruals.size());
+    assert(copy.leg2().leg_type() == Leg::FLOATING && copy.leg1().notional() == notional);
+
     std::cout << "SWAP_OK" << std::endl;
     return 0;
 }
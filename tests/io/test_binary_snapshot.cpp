@@ -0,0 +1,164 @@
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "io/BinarySnapshot.h"
+#include "io/CurveBuilder.h"
+#include "io/SurfaceBuilder.h"
+
+namespace {
+    curve::io::SnapshotData make_snapshot() {
+        using namespace std::chrono;
+        using namespace curve::io;
+        const curve::time::Date as_of{year{2026}, January, day{5}};
+
+        SnapshotData data;
+        data.header = {as_of, sys_days{as_of} + hours{17}, "EOD", "TEST", "snap-1"};
+
+        YieldCurveRecord zero{"EUR-ESTR", "EUR", as_of, "ZERO_RATE", "ACT_365F", "ANNUAL", "LINEAR_ZERO"};
+        zero.points = {{"1Y", std::nullopt, 0.02}, {"5Y", std::nullopt, 0.025}, {"10Y", std::nullopt, 0.03}};
+        YieldCurveRecord df{"USD-SOFR", "USD", as_of, "DISCOUNT_FACTOR", "ACT_360", "CONTINUOUS"};
+        df.points = {{"6M", std::nullopt, 0.98}, {"2Y", curve::time::Date{year{2028}, January, day{5}}, 0.93}};
+        data.yield_curves = {zero, df};
+
+        VolSurfaceRecord surface;
+        surface.header = {"SX5E", as_of, "BLACK", "ABSOLUTE_STRIKE", "", "LINEAR", "LINEAR"};
+        surface.points = {
+            {"6M", 90.0, 0.24, 101.0, std::nullopt}, {"6M", 110.0, 0.20},
+            {"1Y", 90.0, 0.23}, {"1Y", 110.0, 0.21, std::nullopt, 0.0441}
+        };
+        data.vol_surfaces = {surface};
+
+        QuoteSetRecord quotes;
+        quotes.header = {as_of, std::nullopt, "FEED", "EOD"};
+        InstrumentQuoteRecord swap{"EUR-SWAP-5Y"};
+        swap.quotes.push_back({0.0251, "BID", "RATE", "EUR", 1e7, sys_days{as_of} + hours{16}, "GOOD", "FEED"});
+        swap.quotes.push_back({0.0253, "ASK", "RATE", "EUR"});
+        quotes.instruments = {swap, InstrumentQuoteRecord{"EUR-DEPO-1M", {{0.019, "MID", "RATE"}}}};
+        data.quote_sets = {quotes};
+        return data;
+    }
+
+    bool same(const curve::io::SnapshotData &a, const curve::io::SnapshotData &b) {
+        if (a.header.as_of != b.header.as_of || a.header.snapshot_time != b.header.snapshot_time ||
+            a.header.snapshot_id != b.header.snapshot_id || a.yield_curves.size() != b.yield_curves.size() ||
+            a.vol_surfaces.size() != b.vol_surfaces.size() || a.quote_sets.size() != b.quote_sets.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.yield_curves.size(); ++i) {
+            const auto &x = a.yield_curves[i];
+            const auto &y = b.yield_curves[i];
+            if (x.curve_id != y.curve_id || x.compounding != y.compounding || x.points.size() != y.points.size()) {
+                return false;
+            }
+            for (std::size_t j = 0; j < x.points.size(); ++j) {
+                if (x.points[j].tenor != y.points[j].tenor || x.points[j].maturity_date != y.points[j].maturity_date ||
+                    x.points[j].value != y.points[j].value) {
+                    return false;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < a.vol_surfaces.size(); ++i) {
+            const auto &x = a.vol_surfaces[i];
+            const auto &y = b.vol_surfaces[i];
+            if (x.header.underlying_id != y.header.underlying_id || x.points.size() != y.points.size()) return false;
+            for (std::size_t j = 0; j < x.points.size(); ++j) {
+                if (x.points[j].expiry != y.points[j].expiry || x.points[j].volatility != y.points[j].volatility ||
+                    x.points[j].forward != y.points[j].forward ||
+                    x.points[j].total_variance != y.points[j].total_variance) {
+                    return false;
+                }
+            }
+        }
+        const auto &qa = a.quote_sets[0].instruments;
+        const auto &qb = b.quote_sets[0].instruments;
+        if (qa.size() != qb.size()) return false;
+        for (std::size_t i = 0; i < qa.size(); ++i) {
+            if (qa[i].instrument_id != qb[i].instrument_id || qa[i].quotes.size() != qb[i].quotes.size()) return false;
+            for (std::size_t j = 0; j < qa[i].quotes.size(); ++j) {
+                const auto &p = qa[i].quotes[j];
+                const auto &q = qb[i].quotes[j];
+                if (p.value != q.value || p.side != q.side || p.size != q.size || p.timestamp != q.timestamp ||
+                    p.quality != q.quality) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+}
+
+int main() {
+    using namespace curve::io;
+    const auto data = make_snapshot();
+
+    // In-memory round trip
+    const auto bytes = BinarySnapshotWriter::encode(data);
+    const auto in_memory = MappedSnapshot::from_buffer(bytes.data(), bytes.size());
+    if (!same(data, in_memory.to_snapshot_data())) {
+        std::cerr << "BINARY_SNAPSHOT_FAIL buffer round trip\n";
+        return 1;
+    }
+
+    // File round trip through mmap
+    const std::string path = "test_binary_snapshot.cfsnap";
+    BinarySnapshotWriter::write_file(data, path);
+    {
+        const auto mapped = MappedSnapshot::open(path);
+        if (!same(data, mapped.to_snapshot_data())) {
+            std::cerr << "BINARY_SNAPSHOT_FAIL file round trip\n";
+            return 1;
+        }
+
+        // Zero-copy views point into the mapping and are 64-byte aligned
+        const auto view = mapped.find_yield_curve("EUR-ESTR");
+        if (!view || view->size() != 3 || reinterpret_cast<std::uintptr_t>(view->values().data()) % 64 != 0) {
+            std::cerr << "BINARY_SNAPSHOT_FAIL yield curve view\n";
+            return 1;
+        }
+
+        // Annual 3% at 10Y -> continuous ln(1.03)
+        const auto curve = build_yield_curve(*view);
+        const auto ten_years = tenor_to_date(data.header.as_of, "10Y");
+        const auto dc = curve::time::create_daycount_convention(curve::time::DayCountConvention::ACT_365F);
+        const double expected = std::pow(1.03, -dc->year_fraction(data.header.as_of, ten_years));
+        if (std::abs(curve->D(ten_years) - expected) > 1e-12 || curve->name() != "EUR-ESTR") {
+            std::cerr << "BINARY_SNAPSHOT_FAIL zero curve D=" << curve->D(ten_years) << "\n";
+            return 1;
+        }
+
+        // Discount-factor curve reproduces its inputs
+        const auto usd = build_yield_curve(*mapped.find_yield_curve("USD-SOFR"));
+        const curve::time::Date two_years{std::chrono::year{2028}, std::chrono::January, std::chrono::day{5}};
+        if (std::abs(usd->D(two_years) - 0.93) > 1e-12) {
+            std::cerr << "BINARY_SNAPSHOT_FAIL discount curve\n";
+            return 1;
+        }
+
+        const auto surface_view = mapped.find_vol_surface("SX5E");
+        if (!surface_view || std::abs(surface_view->expiry_years()[0] - 0.5) > 1e-15) {
+            std::cerr << "BINARY_SNAPSHOT_FAIL surface view\n";
+            return 1;
+        }
+        const auto surface = build_vol_surface(*surface_view);
+        if (std::abs(surface->get_volatility(110.0, 1.0, 100.0) - 0.21) > 1e-10) {
+            std::cerr << "BINARY_SNAPSHOT_FAIL surface\n";
+            return 1;
+        }
+    }
+    std::remove(path.c_str());
+
+    // Corrupted magic is rejected
+    auto broken = bytes;
+    broken[0] = std::byte{'X'};
+    try {
+        (void) MappedSnapshot::from_buffer(broken.data(), broken.size());
+        std::cerr << "BINARY_SNAPSHOT_FAIL accepted bad magic\n";
+        return 1;
+    } catch (const std::runtime_error &) {
+    }
+
+    std::cout << "BINARY_SNAPSHOT_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,199 @@
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "io/BinarySnapshot.h"
+#include "io/CurveBuilder.h"
+
+namespace {
+    using namespace std::chrono;
+    using curve::time::Date;
+
+    bool close(double a, double b, double tol = 1e-12) { return std::abs(a - b) <= tol; }
+
+    double years(const Date &a, const Date &b) {
+        return static_cast<double>((sys_days{b} - sys_days{a}).count()) / 365.0;
+    }
+
+    bool check_tenor_resolution() {
+        using curve::io::TenorResolver;
+        const Date friday{year{2026}, January, day{2}};
+        const Date monday{year{2026}, January, day{5}};
+        if (TenorResolver(friday, "", "FOLLOWING")("1D") != Date{year{2026}, January, day{3}}) return false;
+        if (TenorResolver(friday, "Euronext", "FOLLOWING")("1D") != monday) return false;
+        if (TenorResolver(friday, "TARGET", "PRECEDING")("1D") != friday) return false;
+        if (TenorResolver(friday, "euronext", "NEAREST")("1D") != friday) return false;
+        if (TenorResolver(friday, "Euronext", "NEAREST")("2D") != monday) return false;
+
+        // 2026-05-30 is a Saturday: FOLLOWING would leave the month, MODIFIED_FOLLOWING rolls back
+        const Date as_of{year{2026}, April, day{30}};
+        if (TenorResolver(as_of, "NYSE", "")("1M") != Date{year{2026}, May, day{29}}) return false;
+
+        try {
+            TenorResolver(as_of, "Atlantis", "");
+            return false;
+        } catch (const std::invalid_argument &) {
+        }
+        return true;
+    }
+
+    // build_yield_curve throws std::invalid_argument whose message names `literal`
+    bool rejects(const curve::io::YieldCurveRecord &record, const std::string &literal) {
+        try {
+            (void) curve::io::build_yield_curve(record);
+            return false;
+        } catch (const std::invalid_argument &e) {
+            return std::string(e.what()).find(literal) != std::string::npos;
+        }
+    }
+
+    bool check_interpolation_modes() {
+        using namespace curve::io;
+        const Date as_of{year{2026}, January, day{5}};
+        const Date t1{year{2027}, January, day{5}}, t2{year{2029}, January, day{5}};
+        const Date mid{year{2028}, January, day{5}};
+
+        YieldCurveRecord record{"EUR-TEST", "EUR", as_of, "ZERO_RATE", "ACT_365F", "CONTINUOUS"};
+        record.points = {{"1Y", t1, 0.02}, {"3Y", t2, 0.03}};
+
+        const double y1 = years(as_of, t1), y2 = years(as_of, t2), y = years(as_of, mid);
+        const double w = (y - y1) / (y2 - y1);
+        const double d1 = std::exp(-0.02 * y1), d2 = std::exp(-0.03 * y2);
+
+        record.interpolation = "LINEAR_ZERO";
+        if (!close(build_yield_curve(record)->D(mid), std::exp(-(0.02 + 0.01 * w) * y))) return false;
+
+        record.interpolation = "LINEAR_DISCOUNT";
+        const auto linear_df = build_yield_curve(record);
+        if (linear_df->interpolation() != curve::InterpolationMode::LINEAR_DISCOUNT) return false;
+        if (!close(linear_df->D(mid), d1 + (d2 - d1) * w)) return false;
+
+        record.interpolation = "LOG_LINEAR_DISCOUNT";
+        if (!close(build_yield_curve(record)->D(mid), std::exp(std::log(d1) + (std::log(d2) - std::log(d1)) * w))) {
+            return false;
+        }
+
+        // Pillars are reproduced exactly whatever the mode
+        if (!close(build_yield_curve(record)->D(t2), d2)) return false;
+
+        // Unsupported literals are rejected by name rather than priced under a neighbouring convention
+        for (const char *literal: {"SPLINE", "NONE", "CUBIC_SPLINE"}) {
+            record.interpolation = literal;
+            if (!rejects(record, literal)) return false;
+        }
+        record.interpolation = "LINEAR_ZERO";
+        for (const char *literal: {"ACT_ACT_ICMA", "THIRTYE_360"}) {
+            record.day_count = literal;
+            if (!rejects(record, literal)) return false;
+        }
+        record.day_count = "ACT_ACT_ISDA";
+        if (curve::io::day_count_of(record.day_count) != curve::time::DayCountConvention::ACT_ACT) return false;
+        return true;
+    }
+
+    bool check_batch() {
+        using namespace curve::io;
+        const Date as_of{year{2026}, January, day{2}};
+
+        SnapshotData data;
+        data.header.as_of = as_of;
+        for (int i = 0; i < 64; ++i) {
+            YieldCurveRecord r{"CURVE-" + std::to_string(i), "EUR", as_of, "ZERO_RATE", "ACT_365F", "ANNUAL"};
+            r.interpolation = i % 2 ? "LOG_LINEAR_DISCOUNT" : "LINEAR_ZERO";
+            r.calendar_name = "Euronext";
+            r.business_day_convention = "MODIFIED_FOLLOWING";
+            r.points = {{"1D", std::nullopt, 0.01}, {"1Y", std::nullopt, 0.02 + 0.0001 * i}, {"10Y", std::nullopt, 0.03}};
+            data.yield_curves.push_back(std::move(r));
+        }
+
+        const auto from_records = build_yield_curves(data.yield_curves, 4);
+        const auto bytes = BinarySnapshotWriter::encode(data);
+        const auto snapshot = MappedSnapshot::from_buffer(bytes.data(), bytes.size());
+        const auto from_view = build_yield_curves(snapshot, 4);
+        if (from_records.size() != 64 || from_view.size() != 64) return false;
+
+        const Date probe{year{2030}, June, day{14}};
+        for (const auto &[id, curve]: from_records) {
+            const auto it = from_view.find(id);
+            if (it == from_view.end() || curve->name() != id || !close(curve->D(probe), it->second->D(probe))) {
+                return false;
+            }
+        }
+
+        // The first failing curve aborts the batch
+        auto bad = data.yield_curves;
+        bad[17].curve_type = "PAR_SWAP_RATE";
+        try {
+            (void) build_yield_curves(bad, 4);
+            return false;
+        } catch (const std::invalid_argument &) {
+        }
+
+        auto duplicate = data.yield_curves;
+        duplicate[40].curve_id = duplicate[3].curve_id;
+        try {
+            (void) build_yield_curves(duplicate, 4);
+            return false;
+        } catch (const std::invalid_argument &) {
+        }
+        return true;
+    }
+
+    // Built curves carry their pillars as aligned serial / value / year fraction arrays
+    bool check_compact_nodes() {
+        using namespace curve::io;
+        const Date as_of{year{2026}, January, day{5}};
+        const Date t1{year{2026}, July, day{6}}, t2{year{2027}, January, day{5}}, t3{year{2031}, January, day{6}};
+        YieldCurveRecord record{"EUR-TEST", "EUR", as_of, "ZERO_RATE", "ACT_365F", "CONTINUOUS"};
+        record.points = {{"5Y", t3, 0.03}, {"6M", t1, 0.02}, {"1Y", t2, 0.025}};
+        const auto curve = build_yield_curve(record);
+        const auto &nodes = curve->nodes();
+        if (nodes.size() != 3) return false;
+        for (const void *array: {static_cast<const void *>(nodes.serials().data()),
+                                 static_cast<const void *>(nodes.values().data()),
+                                 static_cast<const void *>(nodes.times().data()),
+                                 static_cast<const void *>(nodes.spans().data())}) {
+            if (reinterpret_cast<std::uintptr_t>(array) % curve::CurveNodes::kAlignment != 0) return false;
+        }
+        const Date dates[] = {t1, t2, t3};
+        for (std::size_t i = 0; i < 3; ++i) {
+            if (nodes.serials()[i] != curve::time::to_serial(dates[i])) return false;
+            if (!close(nodes.times()[i], years(as_of, dates[i]))) return false;
+        }
+        if (nodes.values()[0] != 0.02 || !close(nodes.spans()[1], years(t2, t3))) return false;
+
+        // Segment search on serials: clamped to [0, size - 2]
+        const auto s1 = curve::time::to_serial(t1), s2 = curve::time::to_serial(t2);
+        if (nodes.segment(s1 - 100) != 0 || nodes.segment(s1) != 0 || nodes.segment(s2 - 1) != 0) return false;
+        if (nodes.segment(s2) != 1 || nodes.segment(curve::time::to_serial(t3) + 100) != 1) return false;
+
+        // Dates outside the pillars are clamped to the first / last one; copies own their arrays
+        if (curve->D(as_of + months{1}) != curve->D(t1) || curve->D(t3 + std::chrono::years{1}) != curve->D(t3)) return false;
+        const auto copy = curve->clone();
+        if (copy->nodes().serials().data() == nodes.serials().data()) return false;
+        return copy->D(t2 + months{7}) == curve->D(t2 + months{7});
+    }
+}
+
+int main() {
+    if (!check_tenor_resolution()) {
+        std::cerr << "tenor resolution failed\n";
+        return 1;
+    }
+    if (!check_interpolation_modes()) {
+        std::cerr << "interpolation modes failed\n";
+        return 1;
+    }
+    if (!check_batch()) {
+        std::cerr << "batch build failed\n";
+        return 1;
+    }
+    if (!check_compact_nodes()) {
+        std::cerr << "compact curve nodes failed\n";
+        return 1;
+    }
+    std::cout << "CURVE_FACTORY_OK" << std::endl;
+    return 0;
+}
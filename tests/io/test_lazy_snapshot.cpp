@@ -0,0 +1,128 @@
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "io/LazySnapshotLoader.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve::io;
+
+    SnapshotData make_snapshot(int curves) {
+        const curve::time::Date as_of{year{2026}, January, day{5}};
+        SnapshotData data;
+        data.header = {as_of, std::nullopt, "EOD", "TEST", "lazy"};
+        // Written in reverse id order so the index has to sort
+        for (int c = curves - 1; c >= 0; --c) {
+            YieldCurveRecord r{"CURVE-" + std::to_string(c), "EUR", as_of, "ZERO_RATE", "ACT_365F", "CONTINUOUS"};
+            r.points = {{"1Y", std::nullopt, 0.01 + 1e-4 * c}, {"10Y", std::nullopt, 0.02 + 1e-4 * c}};
+            data.yield_curves.push_back(std::move(r));
+        }
+        for (const auto *id: {"SX5E", "SPX", "NKY"}) {
+            VolSurfaceRecord s;
+            s.header = {id, as_of, "BLACK", "ABSOLUTE_STRIKE", "", "LINEAR", "LINEAR"};
+            s.points = {{"6M", 90.0, 0.24}, {"6M", 110.0, 0.20}, {"1Y", 90.0, 0.23}, {"1Y", 110.0, 0.21}};
+            data.vol_surfaces.push_back(std::move(s));
+        }
+        for (const auto *scenario: {"BASE", "UP"}) {
+            QuoteSetRecord set;
+            set.header = {as_of, std::nullopt, "FEED", scenario};
+            for (int i = 0; i < 100; ++i) {
+                const double shift = std::strcmp(scenario, "UP") == 0 ? 0.01 : 0.0;
+                set.instruments.push_back({"INST-" + std::to_string(i), {{0.02 + 1e-4 * i + shift, "MID", "RATE"}}});
+            }
+            data.quote_sets.push_back(std::move(set));
+        }
+        return data;
+    }
+
+    bool check_lookups(const MappedSnapshot &snapshot) {
+        for (int c = 0; c < 500; c += 37) {
+            const auto id = "CURVE-" + std::to_string(c);
+            const auto view = snapshot.find_yield_curve(id);
+            if (!view || view->curve_id() != id || view->values()[0] != 0.01 + 1e-4 * c) return false;
+        }
+        if (snapshot.find_yield_curve("CURVE-500") || snapshot.find_yield_curve("")) return false;
+        if (!snapshot.find_vol_surface("SPX") || snapshot.find_vol_surface("DAX")) return false;
+
+        const auto up = snapshot.find_quote_set("FEED", "UP");
+        const auto first = snapshot.find_quote_set("FEED");
+        if (!up || up->scenario_name() != "UP" || !first || first->scenario_name() != "BASE") return false;
+        if (snapshot.find_quote_set("OTHER")) return false;
+
+        const auto quotes = snapshot.find_instrument_quotes(1, "INST-42");
+        return quotes && quotes->instrument_id() == "INST-42" && quotes->values()[0] == 0.02 + 1e-4 * 42 + 0.01 &&
+               !snapshot.find_instrument_quotes(0, "INST-100");
+    }
+}
+
+int main() {
+    const auto bytes = BinarySnapshotWriter::encode(make_snapshot(500));
+    {
+        const auto snapshot = MappedSnapshot::from_buffer(bytes.data(), bytes.size());
+        if (!snapshot.has_index() || !check_lookups(snapshot)) {
+            std::cerr << "indexed lookups failed\n";
+            return 1;
+        }
+    }
+
+    // A file without INDEX (section kind unknown to this reader) still answers, linearly
+    {
+        auto unindexed = bytes;
+        const auto *header = reinterpret_cast<const curve::io::binary::FileHeader *>(unindexed.data());
+        auto *directory = reinterpret_cast<curve::io::binary::SectionEntry *>(unindexed.data() +
+                                                                             sizeof(curve::io::binary::FileHeader));
+        for (std::uint32_t i = 0; i < header->section_count; ++i) {
+            if (directory[i].kind == static_cast<std::uint32_t>(curve::io::binary::SectionKind::INDEX)) {
+                directory[i].kind = 99;
+            }
+        }
+        const auto snapshot = MappedSnapshot::from_buffer(unindexed.data(), unindexed.size());
+        if (snapshot.has_index() || !check_lookups(snapshot)) {
+            std::cerr << "linear fallback failed\n";
+            return 1;
+        }
+    }
+
+    LazySnapshotLoader loader(MappedSnapshot::from_buffer(bytes.data(), bytes.size()));
+    const auto curve = loader.yield_curve("CURVE-7");
+    if (loader.yield_curve("CURVE-7") != curve || curve->name() != "CURVE-7" || loader.cached_yield_curves() != 1) {
+        std::cerr << "curve cache failed\n";
+        return 1;
+    }
+    // Shared between callers, so read-only; clone() gives a job its own copy
+    static_assert(std::is_same_v<decltype(curve), const std::shared_ptr<const curve::ICurve> >);
+    const auto own = curve->clone();
+    if (own.get() == curve.get() || own->D(curve->cob() + std::chrono::years{3}) !=
+                                    curve->D(curve->cob() + std::chrono::years{3})) {
+        std::cerr << "curve clone failed\n";
+        return 1;
+    }
+    (void) loader.yield_curve("CURVE-8");
+    const auto surface = loader.vol_surface("NKY");
+    if (loader.vol_surface("NKY") != surface || loader.cached_vol_surfaces() != 1 || loader.cached_yield_curves() != 2) {
+        std::cerr << "surface cache failed\n";
+        return 1;
+    }
+    try {
+        (void) loader.yield_curve("MISSING");
+        std::cerr << "missing curve did not throw\n";
+        return 1;
+    } catch (const std::out_of_range &) {
+    }
+    const auto quotes = loader.instrument_quotes("FEED", "INST-3");
+    if (!quotes || quotes->values()[0] != 0.02 + 3e-4) {
+        std::cerr << "instrument quotes failed\n";
+        return 1;
+    }
+    loader.clear_cache();
+    if (loader.cached_yield_curves() != 0 || loader.yield_curve("CURVE-7") == curve) {
+        std::cerr << "clear_cache failed\n";
+        return 1;
+    }
+
+    std::cout << "LAZY_SNAPSHOT_OK" << std::endl;
+    return 0;
+}
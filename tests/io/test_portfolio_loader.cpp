@@ -0,0 +1,107 @@
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "io/PortfolioLoader.h"
+
+namespace {
+    std::string make_portfolio(int swaps) {
+        std::string xml = R"(<?xml version="1.0" encoding="UTF-8"?>
+<p:Portfolio xmlns:p="http://curveforge.com/portfolio" xmlns:i="http://curveforge.com/instruments"
+             xmlns:c="http://curveforge.com/commons" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance">
+  <p:name>Test book</p:name>
+  <p:key>BOOK-1</p:key>
+)";
+        for (int n = 0; n < swaps; ++n) {
+            // Two distinct maturities only: schedules must be shared
+            const std::string maturity = n % 2 == 0 ? "2031-01-06" : "2036-01-07";
+            xml += R"(  <p:Instrument xsi:type="i:IRSwap">
+    <i:name>Swap</i:name><i:assetClass>IR</i:assetClass><i:id>T)" + std::to_string(n) + R"(</i:id>
+    <i:notional>1000000</i:notional><i:fixedRate>0.025</i:fixedRate>
+    <i:floatIndex>EURIBOR</i:floatIndex><i:floatTenor>6M</i:floatTenor>
+    <i:payFixed>)" + std::string(n % 3 == 0 ? "true" : "false") + R"(</i:payFixed><i:currency>EUR</i:currency>
+    <i:cashflows>
+      <c:cashflow><c:date>2026-07-06</c:date><c:amount>0</c:amount></c:cashflow>
+      <c:cashflow><c:date>)" + maturity + R"(</c:date><c:amount>0</c:amount></c:cashflow>
+    </i:cashflows>
+  </p:Instrument>
+)";
+        }
+        xml += R"(  <p:Instrument xsi:type="i:XCrossCurrencySwap">
+    <i:name>XCCY</i:name><i:assetClass>FX</i:assetClass><i:id>X1</i:id>
+    <i:domesticCurrency>EUR</i:domesticCurrency><i:domesticNotional>1</i:domesticNotional>
+    <i:foreignCurrency>USD</i:foreignCurrency><i:foreignNotional>1.1</i:foreignNotional>
+  </p:Instrument>
+  <p:Instrument xsi:type="i:IRSwap">
+    <i:name>Swap</i:name><i:assetClass>IR</i:assetClass><i:id>BAD</i:id>
+    <i:notional>1</i:notional><i:fixedRate>0.01</i:fixedRate><i:floatIndex>X</i:floatIndex>
+    <i:floatTenor>6M</i:floatTenor><i:payFixed>true</i:payFixed><i:currency>XXX</i:currency>
+    <i:cashflows><c:cashflow><c:date>2027-01-04</c:date><c:amount>0</c:amount></c:cashflow></i:cashflows>
+  </p:Instrument>
+</p:Portfolio>
+)";
+        return xml;
+    }
+}
+
+int main() {
+    using namespace curve::io;
+    const int swaps = 500;
+    const auto xml = make_portfolio(swaps);
+
+    curve::instruments::StaticDataCache cache;
+    PortfolioLoadOptions options;
+    options.threads = 4;
+    options.chunk_bytes = 4096; // many chunks
+    const auto result = PortfolioLoader::load_buffer(xml.data(), xml.size(), cache, options);
+
+    if (result.name != "Test book" || result.key != "BOOK-1" || result.trades_read != swaps + 2) {
+        std::cerr << "PORTFOLIO_FAIL header/count " << result.trades_read << "\n";
+        return 1;
+    }
+    if (result.store.size() != swaps || result.unsupported.at("XCrossCurrencySwap") != 1 ||
+        result.errors.size() != 1) {
+        std::cerr << "PORTFOLIO_FAIL store " << result.store.size() << " errors " << result.errors.size() << "\n";
+        return 1;
+    }
+
+    // Document order is preserved and trades are indexed by id
+    const auto *first = result.store.fix_float_swap(0);
+    if (first == nullptr || result.store.trade_info(0).trade_id != "T0" || !result.store.trade_info(0).pay_fixed ||
+        result.store.find("T499") == nullptr || result.store.trade_info(1).pay_fixed) {
+        std::cerr << "PORTFOLIO_FAIL order/index\n";
+        return 1;
+    }
+
+    // 2 maturities x (fixed, float) schedules, shared by all swaps
+    if (cache.schedule_count() != 4 ||
+        &result.store.fix_float_swap(0)->leg1().cashflows_schedule() !=
+        &result.store.fix_float_swap(2)->leg1().cashflows_schedule()) {
+        std::cerr << "PORTFOLIO_FAIL schedule interning " << cache.schedule_count() << "\n";
+        return 1;
+    }
+
+    // Annual fixed / semi-annual float EUR legs from 2026-01-06 (one float tenor before the
+    // first cashflow) to 2031-01-06
+    using namespace std::chrono;
+    const auto &fixed = first->leg1().cashflows_schedule().accruals;
+    const auto &floating = first->leg2().cashflows_schedule().accruals;
+    if (fixed.empty() || floating.size() < 2 * fixed.size() - 2 ||
+        fixed.front().start_date > curve::time::Date{year{2026}, January, day{6}} ||
+        fixed.back().end_date != curve::time::Date{year{2031}, January, day{6}}) {
+        std::cerr << "PORTFOLIO_FAIL schedules " << fixed.size() << "/" << floating.size() << "\n";
+        return 1;
+    }
+
+    // Chunked parse gives the same trades as a single chunk
+    PortfolioLoadOptions single;
+    single.threads = 1;
+    single.chunk_bytes = xml.size();
+    if (PortfolioLoader::read_trades(xml.data(), xml.size(), single).size() != swaps + 2) {
+        std::cerr << "PORTFOLIO_FAIL single chunk\n";
+        return 1;
+    }
+
+    std::cout << "PORTFOLIO_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "io/QuoteHistory.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve::io;
+
+    constexpr int kInstruments = 30;
+
+    sys_days day_of(int d) { return sys_days{year{2026} / January / 1} + days{d}; }
+
+    double value_of(int d, int instrument, bool ask) { return 0.01 + 0.0001 * instrument + 1e-6 * d + (ask ? 5e-5 : 0.0); }
+
+    QuoteSetRecord make_set(int d, int instruments) {
+        QuoteSetRecord set;
+        set.header = {curve::time::Date{day_of(d)}, day_of(d) + hours{17}, "FEED", "EOD"};
+        for (int i = instruments - 1; i >= 0; --i) { // out of code order on purpose
+            InstrumentQuoteRecord instrument{"INST-" + std::to_string(i)};
+            // ASK listed first, but stamped after BID
+            instrument.quotes.push_back({
+                value_of(d, i, true), "ASK", "RATE", "EUR", std::nullopt, day_of(d) + hours{16} + seconds{i + 1},
+                "GOOD", "BROKER"
+            });
+            instrument.quotes.push_back({
+                value_of(d, i, false), "BID", "RATE", "EUR", 1e6, day_of(d) + hours{16} + seconds{i}, "GOOD", "BROKER"
+            });
+            set.instruments.push_back(std::move(instrument));
+        }
+        return set;
+    }
+
+    bool check_scan(const QuoteHistory &history) {
+        const auto runs = history.scan("INST-5", day_of(3), day_of(7));
+        if (runs.size() != 4) return false;
+        for (std::size_t r = 0; r < runs.size(); ++r) {
+            const auto &run = runs[r];
+            const int d = 3 + static_cast<int>(r);
+            if (run.size() != 2 || run.instrument_id() != "INST-5" || run.feed_name() != "FEED" ||
+                run.as_of() != curve::time::Date{day_of(d)}) {
+                return false;
+            }
+            if (run.side(0) != "BID" || run.side(1) != "ASK" || run.source(1) != "BROKER" || run.currency(0) != "EUR") {
+                return false;
+            }
+            if (run.values()[0] != value_of(d, 5, false) || run.values()[1] != value_of(d, 5, true)) return false;
+            if (run.sizes()[0] != 1e6 || !std::isnan(run.sizes()[1])) return false;
+            if (run.timestamp(1) != day_of(d) + hours{16} + seconds{6}) return false;
+            if (run.record(1).size.has_value() || run.record(0).quality != "GOOD") return false;
+        }
+
+        // Range bounds cut inside a run: only the BID of day 4 is at or after 16:00:05
+        const auto cut = history.scan("INST-5", day_of(4) + hours{16} + seconds{5}, day_of(4) + hours{16} + seconds{6});
+        return cut.size() == 1 && cut[0].size() == 1 && cut[0].side(0) == "BID" &&
+               history.scan("UNKNOWN", day_of(0), day_of(99)).empty();
+    }
+}
+
+int main() {
+    const auto path = (std::filesystem::temp_directory_path() / "curveforge_test_quote_history.cfqh").string();
+    std::filesystem::remove(path);
+
+    {
+        auto writer = QuoteHistoryWriter::open(path);
+        for (int d = 0; d < 20; ++d) writer.append(make_set(d, kInstruments));
+    }
+    {
+        // Reopen: dictionaries continue, one new instrument
+        auto writer = QuoteHistoryWriter::open(path);
+        if (writer.block_count() != 20) {
+            std::cerr << "reopen lost blocks\n";
+            return 1;
+        }
+        for (int d = 20; d < 30; ++d) writer.append(make_set(d, kInstruments + 1));
+    }
+
+    {
+        const auto history = QuoteHistory::open(path);
+        if (history.block_count() != 30 || history.instrument_count() != kInstruments + 1 ||
+            history.row_count() != 2 * (20 * kInstruments + 10 * (kInstruments + 1))) {
+            std::cerr << "unexpected history shape\n";
+            return 1;
+        }
+        // code 0 = empty label, then FEED, EOD, ASK, RATE, EUR, GOOD, BROKER, BID
+        if (history.labels().size() != 9) {
+            std::cerr << "labels not deduplicated: " << history.labels().size() << "\n";
+            return 1;
+        }
+        if (!check_scan(history)) {
+            std::cerr << "scan failed\n";
+            return 1;
+        }
+        if (history.scan("INST-30", day_of(0), day_of(40)).size() != 10) {
+            std::cerr << "new instrument scan failed\n";
+            return 1;
+        }
+    }
+
+    // Torn append: readers ignore the partial block, the next writer truncates it
+    const auto complete_size = std::filesystem::file_size(path);
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        std::ifstream in(path, std::ios::binary);
+        std::string head(200, '\0');
+        in.seekg(64);
+        in.read(head.data(), static_cast<std::streamsize>(head.size()));
+        out.write(head.data(), static_cast<std::streamsize>(head.size()));
+    }
+    {
+        const auto history = QuoteHistory::open(path);
+        if (history.block_count() != 30 || history.valid_size() != complete_size) {
+            std::cerr << "torn block not ignored\n";
+            return 1;
+        }
+    }
+    {
+        auto writer = QuoteHistoryWriter::open(path);
+        writer.append(make_set(30, kInstruments + 1));
+    }
+    {
+        const auto history = QuoteHistory::open(path);
+        if (history.block_count() != 31 || history.valid_size() != std::filesystem::file_size(path) ||
+            history.scan("INST-30", day_of(30), day_of(31)).size() != 1) {
+            std::cerr << "append after torn block failed\n";
+            return 1;
+        }
+    }
+
+    // Same content through a non-owning buffer
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<std::int64_t> buffer((std::filesystem::file_size(path) + 7) / 8);
+        in.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(std::filesystem::file_size(path)));
+        const auto history = QuoteHistory::from_buffer(reinterpret_cast<const std::byte *>(buffer.data()),
+                                                       std::filesystem::file_size(path));
+        if (!check_scan(history)) {
+            std::cerr << "buffer scan failed\n";
+            return 1;
+        }
+    }
+
+    std::filesystem::remove(path);
+    std::cout << "QUOTE_HISTORY_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "io/MarketDataSaxReader.h"
+#include "io/ParseUtils.h"
+#include "io/StreamingSnapshotLoader.h"
+
+namespace {
+    const char *kSnapshot = R"(<?xml version="1.0" encoding="UTF-8"?>
+<md:MarketDataSnapshot xmlns:md="http://curveforge.com/marketdata">
+  <header>
+    <asOf>2026-01-05</asOf>
+    <snapshotTime>2026-01-05T17:30:00Z</snapshotTime>
+    <scenarioName>BASE</scenarioName>
+    <source>TEST</source>
+  </header>
+  <yieldCurves>
+    <yieldCurve>
+      <header>
+        <curveId>EUR-ESTR</curveId>
+        <currency>EUR</currency>
+        <asOf>2026-01-05</asOf>
+        <curveType>ZERO_RATE</curveType>
+        <dayCount>ACT_365F</dayCount>
+        <compounding>CONTINUOUS</compounding>
+      </header>
+      <points>
+        <point><tenor>1Y</tenor><curveValue>0.021</curveValue></point>
+        <point><tenor>5Y</tenor><curveValue>0.025</curveValue></point>
+      </points>
+    </yieldCurve>
+  </yieldCurves>
+  <volSurfaces>
+    <volSurface>
+      <header>
+        <underlyingId>SX5E</underlyingId>
+        <asOf>2026-01-05</asOf>
+        <quoteType>IMPLIED_VOL</quoteType>
+        <strikeDimension>ABSOLUTE_STRIKE</strikeDimension>
+        <strikeInterpolation>LINEAR</strikeInterpolation>
+      </header>
+      <points>
+        <point><expiry>6M</expiry><strikeCoordinate>90</strikeCoordinate><volatility>0.24</volatility></point>
+        <point><expiry>6M</expiry><strikeCoordinate>110</strikeCoordinate><volatility>0.20</volatility></point>
+        <point><expiry>1Y</expiry><strikeCoordinate>90</strikeCoordinate><volatility>0.23</volatility></point>
+        <point><expiry>1Y</expiry><strikeCoordinate>110</strikeCoordinate><volatility>0.21</volatility></point>
+      </points>
+    </volSurface>
+  </volSurfaces>
+  <quoteSets>
+    <quoteSet>
+      <asOf>2026-01-05</asOf>
+      <feedName>FEED</feedName>
+      <instruments>
+        <instrumentQuote>
+          <instrumentId>EUR-SWAP-5Y</instrumentId>
+          <quotes>
+            <quote><value>0.0251</value><side>MID</side><valueType>RATE</valueType><timestamp>2026-01-05T17:29:59.250+01:00</timestamp></quote>
+          </quotes>
+        </instrumentQuote>
+      </instruments>
+    </quoteSet>
+  </quoteSets>
+</md:MarketDataSnapshot>
+)";
+}
+
+int main() {
+    using namespace curve::io;
+
+    const auto data = MarketDataSaxReader::read_buffer(kSnapshot, std::strlen(kSnapshot));
+    if (data.header.scenario_name != "BASE" || data.yield_curves.size() != 1 ||
+        data.yield_curves[0].points.size() != 2 || std::abs(data.yield_curves[0].points[1].value - 0.025) > 1e-15) {
+        std::cerr << "SAX_FAIL yield curves\n";
+        return 1;
+    }
+    if (data.vol_surfaces.size() != 1 || data.vol_surfaces[0].points.size() != 4 ||
+        data.vol_surfaces[0].header.underlying_id != "SX5E") {
+        std::cerr << "SAX_FAIL vol surfaces\n";
+        return 1;
+    }
+    if (data.quote_sets.size() != 1 || data.quote_sets[0].instruments.size() != 1 ||
+        !data.quote_sets[0].instruments[0].quotes[0].timestamp ||
+        format_date_time(*data.quote_sets[0].instruments[0].quotes[0].timestamp) != "2026-01-05T16:29:59.250Z") {
+        std::cerr << "SAX_FAIL quotes\n";
+        return 1;
+    }
+
+    // Streaming load: surfaces are built while parsing, quotes are only forwarded.
+    std::size_t forwarded = 0;
+    MarketDataCallbacks quotes;
+    quotes.on_instrument_quote = [&](const QuoteSetHeaderRecord &, InstrumentQuoteRecord &&) { ++forwarded; };
+    const auto loaded = StreamingSnapshotLoader::load_buffer(kSnapshot, std::strlen(kSnapshot), quotes);
+    const auto it = loaded.vol_surfaces.find("SX5E");
+    if (forwarded != 1 || loaded.yield_curves.size() != 1 || it == loaded.vol_surfaces.end()) {
+        std::cerr << "SAX_FAIL streaming load\n";
+        return 1;
+    }
+    const double vol = it->second->get_volatility(90.0, 1.0, 100.0);
+    if (std::abs(vol - 0.23) > 1e-10) {
+        std::cerr << "SAX_FAIL surface vol " << vol << "\n";
+        return 1;
+    }
+
+    std::cout << "SAX_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "io/BinarySnapshot.h"
+#include "io/LiveSnapshot.h"
+#include "io/SnapshotDelta.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve::io;
+
+    SnapshotData make_snapshot(int curves) {
+        const curve::time::Date as_of{year{2026}, February, day{6}};
+        SnapshotData data;
+        data.header = {as_of, std::nullopt, "INTRADAY", "TEST", "v1"};
+        for (int c = 0; c < curves; ++c) {
+            YieldCurveRecord r{"CURVE-" + std::to_string(c), "EUR", as_of, "ZERO_RATE", "ACT_365F", "CONTINUOUS"};
+            r.points = {
+                {"1Y", std::nullopt, 0.010 + 1e-4 * c}, {"5Y", std::nullopt, 0.015 + 1e-4 * c},
+                {"10Y", std::nullopt, 0.020 + 1e-4 * c}
+            };
+            data.yield_curves.push_back(std::move(r));
+        }
+        for (const auto *id: {"SX5E", "SPX"}) {
+            VolSurfaceRecord s;
+            s.header = {id, as_of, "BLACK", "ABSOLUTE_STRIKE", "", "LINEAR", "LINEAR"};
+            s.points = {{"6M", 90.0, 0.24}, {"6M", 110.0, 0.20}, {"1Y", 90.0, 0.23}, {"1Y", 110.0, 0.21}};
+            data.vol_surfaces.push_back(std::move(s));
+        }
+        QuoteSetRecord set;
+        set.header = {as_of, std::nullopt, "FEED", "BASE"};
+        for (int i = 0; i < 50; ++i) {
+            set.instruments.push_back({"INST-" + std::to_string(i), {{0.02 + 1e-4 * i, "MID", "RATE"}}});
+        }
+        data.quote_sets.push_back(std::move(set));
+        return data;
+    }
+
+    // A typical intraday tick: a few points move, one curve appears, one goes away
+    SnapshotData next_tick(const SnapshotData &base) {
+        auto next = base;
+        next.header.snapshot_id = "v2";
+        next.yield_curves[3].points[1].value += 5e-4;
+        next.yield_curves[17].points[0].value -= 2e-4;
+        next.yield_curves.erase(next.yield_curves.begin() + 40);
+        YieldCurveRecord added{"CURVE-NEW", "USD", base.header.as_of, "ZERO_RATE", "ACT_365F", "CONTINUOUS"};
+        added.points = {{"2Y", std::nullopt, 0.04}, {"30Y", std::nullopt, 0.045}};
+        next.yield_curves.push_back(std::move(added));
+        next.vol_surfaces[1].points[2].volatility = 0.235;
+        auto &set = next.quote_sets[0];
+        set.instruments[7].quotes[0].value += 1e-4;
+        set.instruments.erase(set.instruments.begin() + 9);
+        set.instruments.push_back({"INST-NEW", {{0.03, "MID", "RATE"}}});
+        return next;
+    }
+
+    bool same_content(const SnapshotData &a, const SnapshotData &b) {
+        return a.header == b.header && a.yield_curves == b.yield_curves && a.vol_surfaces == b.vol_surfaces &&
+               a.quote_sets == b.quote_sets;
+    }
+}
+
+int main() {
+    const auto base = make_snapshot(100);
+    const auto next = next_tick(base);
+
+    const auto delta = diff_snapshots(base, next);
+    if (delta.base_snapshot_id != "v1" || delta.curve_patches.size() != 2 || delta.upserted_curves.size() != 1 ||
+        delta.removed_curves != std::vector<std::string>{"CURVE-40"} || delta.surface_patches.size() != 1 ||
+        delta.quote_set_patches.size() != 1 || delta.empty()) {
+        std::cerr << "diff failed\n";
+        return 1;
+    }
+    if (!diff_snapshots(base, base).empty()) {
+        std::cerr << "identical snapshots produced a delta\n";
+        return 1;
+    }
+
+    auto patched = base;
+    apply_delta(patched, delta);
+    if (!same_content(patched, next)) {
+        std::cerr << "apply did not reproduce the next snapshot\n";
+        return 1;
+    }
+
+    const auto bytes = SnapshotDeltaCodec::encode(delta);
+    if (SnapshotDeltaCodec::decode(bytes) != delta) {
+        std::cerr << "codec round trip failed\n";
+        return 1;
+    }
+    const auto full = BinarySnapshotWriter::encode(next);
+    if (bytes.size() * 10 > full.size()) {
+        std::cerr << "delta not compact: " << bytes.size() << " vs " << full.size() << " bytes\n";
+        return 1;
+    }
+    try {
+        (void) SnapshotDeltaCodec::decode(std::span(bytes).first(bytes.size() - 3));
+        std::cerr << "truncated delta decoded\n";
+        return 1;
+    } catch (const std::runtime_error &) {
+    }
+
+    // Applying against the wrong base leaves the snapshot untouched
+    try {
+        apply_delta(patched, delta);
+        std::cerr << "delta applied to the wrong base\n";
+        return 1;
+    } catch (const std::invalid_argument &) {
+    }
+    if (!same_content(patched, next)) {
+        std::cerr << "failed apply modified the snapshot\n";
+        return 1;
+    }
+
+    LiveSnapshot live(base, 4);
+    const auto untouched = live.yield_curves().at("CURVE-50");
+    const auto before = live.yield_curves().at("CURVE-3");
+    const auto changes = live.apply(SnapshotDeltaCodec::decode(bytes));
+    if (changes.rebuilt_curves != std::vector<std::string>{"CURVE-17", "CURVE-3", "CURVE-NEW"} ||
+        changes.removed_curves != std::vector<std::string>{"CURVE-40"} ||
+        changes.rebuilt_surfaces != std::vector<std::string>{"SPX"} || !changes.quotes_changed) {
+        std::cerr << "unexpected change set\n";
+        return 1;
+    }
+    if (live.yield_curves().at("CURVE-50") != untouched || live.yield_curves().at("CURVE-3") == before ||
+        live.yield_curves().contains("CURVE-40") || live.yield_curves().size() != 100 ||
+        !same_content(live.data(), next)) {
+        std::cerr << "live snapshot state wrong\n";
+        return 1;
+    }
+    try {
+        (void) live.apply(delta);
+        std::cerr << "live snapshot applied a stale delta\n";
+        return 1;
+    } catch (const std::invalid_argument &) {
+    }
+    if (live.yield_curves().at("CURVE-3") == before || !same_content(live.data(), next)) {
+        std::cerr << "failed live apply changed state\n";
+        return 1;
+    }
+
+    std::cout << "SNAPSHOT_DELTA_OK" << std::endl;
+    return 0;
+}
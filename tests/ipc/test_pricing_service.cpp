@@ -0,0 +1,216 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "analytical_pricers/BlackScholes.h"
+#include "io/BinarySnapshot.h"
+#include "ipc/PricingClient.h"
+#include "ipc/PricingServer.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve::ipc;
+    using curve::analytical_pricers::BlackScholes;
+
+    const curve::time::Date kAsOf{year{2026}, February, day{9}};
+
+    std::vector<std::byte> make_snapshot(double shift) {
+        curve::io::SnapshotData data;
+        data.header = {kAsOf, std::nullopt, "EOD", "TEST", "ipc"};
+        for (const auto *id: {"EUR-OIS", "EUR-6M"}) {
+            curve::io::YieldCurveRecord r{id, "EUR", kAsOf, "ZERO_RATE", "ACT_365F", "CONTINUOUS"};
+            const double spread = std::string(id) == "EUR-6M" ? 0.002 : 0.0;
+            r.points = {
+                {"1Y", std::nullopt, 0.020 + spread + shift}, {"5Y", std::nullopt, 0.024 + spread + shift},
+                {"10Y", std::nullopt, 0.027 + spread + shift}
+            };
+            data.yield_curves.push_back(std::move(r));
+        }
+        curve::io::VolSurfaceRecord s;
+        s.header = {"SPX", kAsOf, "BLACK", "ABSOLUTE_STRIKE", "", "LINEAR", "LINEAR"};
+        for (const auto *expiry: {"6M", "1Y"}) {
+            for (const double strike: {90.0, 100.0, 110.0}) s.points.push_back({expiry, strike, 0.2});
+        }
+        data.vol_surfaces.push_back(std::move(s));
+        return curve::io::BinarySnapshotWriter::encode(data);
+    }
+
+    std::shared_ptr<PricingMarket> make_market(double shift) {
+        const auto bytes = make_snapshot(shift);
+        const auto snapshot = curve::io::MappedSnapshot::from_buffer(bytes.data(), bytes.size());
+        return PricingMarket::from_snapshot(snapshot, 2);
+    }
+
+    curve::time::Date plus_days(const curve::time::Date &d, int n) { return curve::time::Date{sys_days(d) + days{n}}; }
+
+    bool close(double a, double b, double tol = 1e-12) { return std::abs(a - b) <= tol; }
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    // Client side checks against a running server
+    int check_service(const std::string &socket_path, MarketPublisher &publisher, const PricingServer &server) {
+        auto client = PricingClient::connect(socket_path);
+        const auto reference = make_market(0.0);
+        const auto &ois = *reference->curves.at("EUR-OIS");
+        const curve::time::Date d5y{year{2031}, February, day{10}};
+
+        if (!close(client.discount_factor("EUR-OIS", d5y), ois.D(d5y))) return fail("discount factor");
+        const curve::time::Date d1y{year{2027}, February, day{9}};
+        if (!close(client.forward_rate("EUR-6M", d1y, d5y), reference->curves.at("EUR-6M")->F(d1y, d5y))) {
+            return fail("forward rate");
+        }
+
+        SwapSpec swap;
+        swap.start = curve::time::Date{year{2026}, February, day{11}};
+        swap.end = curve::time::Date{year{2031}, February, day{11}};
+        const double par = client.swap_par_rate("EUR-OIS", "EUR-6M", swap);
+        if (!(par > 0.015 && par < 0.035)) return fail("swap par rate " + std::to_string(par));
+
+        // Many distinct swaps: schedules are generated per request, the daemon retains none of them
+        std::vector<std::uint32_t> swap_ids;
+        for (int i = 0; i < 2000; ++i) {
+            SwapSpec distinct = swap;
+            distinct.end = plus_days(swap.end, i);
+            distinct.fixed_months = 1 + i % 12;
+            swap_ids.push_back(client.add_swap_par_rate("EUR-OIS", "EUR-6M", distinct));
+        }
+        const auto swap_replies = client.flush();
+        if (swap_replies.size() != swap_ids.size()) return fail("swap batch size");
+        for (const auto &reply: swap_replies) {
+            if (!reply.ok() || !(reply.value > 0.015 && reply.value < 0.035)) return fail("swap batch value");
+        }
+        if (!close(client.swap_par_rate("EUR-OIS", "EUR-6M", swap), par)) return fail("repeated swap par rate");
+        if (server.stats().cached_schedules != 0) {
+            return fail("schedule cache grew to " + std::to_string(server.stats().cached_schedules));
+        }
+
+        OptionSpec option{100.0, 100.0, plus_days(kAsOf, 365), true};
+        const double t = 1.0;
+        const double r = -std::log(ois.D(option.expiry)) / t;
+        const double price = client.option_price("SPX", "EUR-OIS", option);
+        if (!close(price, BlackScholes::call_price(100.0, 100.0, r, 0.2, t), 1e-10)) return fail("option price");
+        if (!close(client.implied_vol("EUR-OIS", price, option), 0.2, 1e-5)) return fail("implied vol");
+        if (client.market_version() != 1) return fail("market version");
+
+        // Errors come back per request
+        try {
+            (void) client.discount_factor("USD-OIS", d5y);
+            return fail("unknown curve did not throw");
+        } catch (const std::runtime_error &e) {
+            if (std::string(e.what()).find("unknown curve") == std::string::npos) return fail(e.what());
+        }
+
+        // A batch sent in one write is answered in order
+        std::vector<std::uint32_t> ids;
+        for (int i = 0; i < 1000; ++i) {
+            ids.push_back(i % 100 == 0
+                              ? client.add_discount_factor("MISSING", d5y)
+                              : client.add_discount_factor("EUR-OIS", plus_days(kAsOf, i)));
+        }
+        const auto replies = client.flush();
+        if (replies.size() != ids.size()) return fail("batch size");
+        for (std::size_t i = 0; i < replies.size(); ++i) {
+            const bool expect_error = i % 100 == 0;
+            if (replies[i].request_id != ids[i] || replies[i].ok() == expect_error) return fail("batch reply");
+            if (!expect_error && !close(replies[i].value, ois.D(plus_days(kAsOf, static_cast<int>(i))))) {
+                return fail("batch value");
+            }
+        }
+
+        // A batch several read budgets long is answered in full while another connection is served
+        {
+            auto bulk = PricingClient::connect(socket_path);
+            std::vector<std::uint32_t> bulk_ids;
+            for (int i = 0; i < 40000; ++i) bulk_ids.push_back(bulk.add_discount_factor("EUR-OIS", d5y));
+            std::vector<Reply> bulk_replies;
+            std::thread flushing([&] { bulk_replies = bulk.flush(); });
+            bool interleaved_ok = true;
+            for (int i = 0; i < 200; ++i) interleaved_ok &= close(client.discount_factor("EUR-OIS", d5y), ois.D(d5y));
+            flushing.join();
+            if (!interleaved_ok) return fail("interleaved query");
+            if (bulk_replies.size() != bulk_ids.size()) return fail("bulk batch size");
+            for (std::size_t i = 0; i < bulk_replies.size(); ++i) {
+                if (bulk_replies[i].request_id != bulk_ids[i] || !close(bulk_replies[i].value, ois.D(d5y))) {
+                    return fail("bulk batch reply");
+                }
+            }
+        }
+
+        // Republishing swaps the market under the running server
+        publisher.publish(make_market(0.01));
+        if (client.market_version() != 2 || close(client.discount_factor("EUR-OIS", d5y), ois.D(d5y))) {
+            return fail("republished market not served");
+        }
+        if (publisher.retired_count() != 0) return fail("retired market not reclaimed");
+
+        // Single-query round trip latency on this machine (informational)
+        std::vector<double> micros;
+        for (int i = 0; i < 20000; ++i) {
+            const auto start = steady_clock::now();
+            (void) client.discount_factor("EUR-OIS", d5y);
+            micros.push_back(duration<double, std::micro>(steady_clock::now() - start).count());
+        }
+        std::sort(micros.begin(), micros.end());
+        std::cout << "round trip p50 " << micros[micros.size() / 2] << "us, p99 " << micros[micros.size() * 99 / 100]
+                << "us\n";
+
+        if (server.stats().requests < 63000) return fail("server stats");
+        return 0;
+    }
+}
+
+int main() {
+    MarketPublisher publisher(8);
+    publisher.publish(make_market(0.0));
+
+    // Frame handling without a socket
+    {
+        PricingEngine engine(publisher);
+        std::vector<std::byte> request(sizeof(FrameHeader)), response;
+        const FrameHeader unknown_op{sizeof(FrameHeader), 7, 99, {}};
+        std::memcpy(request.data(), &unknown_op, sizeof(unknown_op));
+        request.push_back(std::byte{0}); // start of a partial frame
+        if (engine.process(request, response) != sizeof(FrameHeader) || response.size() <= sizeof(FrameHeader)) {
+            return fail("engine did not answer an unknown op");
+        }
+        FrameHeader reply{};
+        std::memcpy(&reply, response.data(), sizeof(reply));
+        if (reply.request_id != 7 || reply.code != static_cast<std::uint8_t>(Status::ERROR)) {
+            return fail("unknown op not rejected");
+        }
+        const FrameHeader bad_size{3, 8, 1, {}};
+        std::memcpy(request.data(), &bad_size, sizeof(bad_size));
+        try {
+            (void) engine.process(request, response);
+            return fail("bad frame size accepted");
+        } catch (const ProtocolError &) {
+        }
+    }
+
+    const auto socket_path = "/tmp/curveforge-test-" + std::to_string(::getpid()) + ".sock";
+    PricingServer server(socket_path, publisher);
+    std::thread serving([&] { server.run(); });
+
+    int status = 0;
+    try {
+        status = check_service(socket_path, publisher, server);
+    } catch (const std::exception &e) {
+        status = fail(std::string("unexpected exception: ") + e.what());
+    }
+    server.stop();
+    serving.join();
+    if (status != 0) return status;
+
+    std::cout << "PRICING_SERVICE_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#include "curve/InterpolatedZeroCurve.h"
+#include "ipc/SharedCurves.h"
+
+namespace {
+    using namespace std::chrono;
+    using namespace curve;
+    using namespace curve::ipc;
+
+    const time::Date kCob{year{2026}, February, day{10}};
+
+    time::Date plus_days(const time::Date &d, int n) { return time::Date{sys_days(d) + days{n}}; }
+
+    InterpolatedZeroCurve make_curve(const std::string &id, double shift, InterpolationMode mode,
+                                     time::DayCountConvention dc = time::DayCountConvention::ACT_365F) {
+        std::vector<Pillar> pillars;
+        const double zeros[] = {0.021, 0.0235, 0.0252, 0.0268, 0.0281};
+        const int offsets[] = {30, 365, 1096, 1826, 3652};
+        for (int i = 0; i < 5; ++i) pillars.emplace_back(plus_days(kCob, offsets[i]), zeros[i] + shift);
+        return {id, kCob, std::move(pillars), time::create_daycount_convention(dc), mode};
+    }
+
+    bool close(double a, double b, double tol = 1e-14) { return std::abs(a - b) <= tol; }
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+}
+
+int main() {
+    const auto name = "/curveforge-test-" + std::to_string(::getpid());
+    auto publisher = SharedCurvePublisher::create(name, 4, 8);
+    const auto reader = SharedCurveReader::open(name);
+    if (reader.find("EUR-OIS")) return fail("empty segment found a curve");
+
+    // Every interpolation mode reproduces ICurve, inside and outside the pillar range
+    const InterpolationMode modes[] = {
+        InterpolationMode::LINEAR_ZERO, InterpolationMode::LINEAR_DISCOUNT, InterpolationMode::LOG_LINEAR_DISCOUNT
+    };
+    const std::string ids[] = {"EUR-OIS", "EUR-6M", "USD-SOFR"};
+    for (int m = 0; m < 3; ++m) {
+        const auto curve = make_curve(ids[m], 0.0, modes[m], m == 1
+                                                                 ? time::DayCountConvention::ACT_360
+                                                                 : time::DayCountConvention::ACT_365F);
+        if (publisher.publish(ids[m], curve) != 1) return fail("first version");
+        const auto shared = reader.find(ids[m]);
+        if (!shared || shared->id() != ids[m] || shared->version() != 1) return fail("lookup " + ids[m]);
+        for (int d = -10; d < 4000; d += 7) {
+            const auto date = plus_days(kCob, d);
+            if (!close(shared->D(date), curve.D(date))) {
+                return fail(ids[m] + " D mismatch at day " + std::to_string(d));
+            }
+        }
+        const auto t1 = plus_days(kCob, 400), t2 = plus_days(kCob, 583);
+        if (!close(shared->F(t1, t2), curve.F(t1, t2), 1e-12)) return fail(ids[m] + " F mismatch");
+    }
+    if (reader.curve_ids().size() != 3 || publisher.size() != 3) return fail("curve count");
+
+    // Limits of the segment
+    try {
+        (void) publisher.publish("X", make_curve("X", 0.0, InterpolationMode::LINEAR_ZERO));
+        (void) publisher.publish("Y", make_curve("Y", 0.0, InterpolationMode::LINEAR_ZERO));
+        return fail("full segment accepted a curve");
+    } catch (const std::length_error &) {
+    }
+    try {
+        (void) publisher.publish(std::string(48, 'Z'), make_curve("Z", 0.0, InterpolationMode::LINEAR_ZERO));
+        return fail("long id accepted");
+    } catch (const std::length_error &) {
+    }
+
+    // Readers racing a publisher always see one complete version of the curve
+    const auto base = make_curve("EUR-OIS", 0.0, InterpolationMode::LINEAR_ZERO);
+    const auto bumped = make_curve("EUR-OIS", 0.01, InterpolationMode::LINEAR_ZERO);
+    const auto probe = plus_days(kCob, 2000);
+    const auto shared = *reader.find("EUR-OIS");
+    std::atomic<bool> done{false};
+    std::atomic<long> torn{0}, reads{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load(std::memory_order_relaxed)) {
+                const double d = shared.D(probe);
+                if (!close(d, base.D(probe)) && !close(d, bumped.D(probe))) torn.fetch_add(1);
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    std::uint64_t version = 0;
+    for (int i = 0; i < 20000; ++i) version = publisher.publish("EUR-OIS", i % 2 == 0 ? bumped : base);
+    done = true;
+    for (auto &t: readers) t.join();
+    if (torn != 0) return fail(std::to_string(torn.load()) + " torn reads");
+    if (version != 20001 || shared.version() != version) return fail("version counter");
+    if (!close(shared.D(probe), base.D(probe))) return fail("last publication not visible");
+
+    // Read cost on this machine (informational)
+    const int n = 1000000;
+    double sink = 0.0;
+    const auto start = steady_clock::now();
+    for (int i = 0; i < n; ++i) sink += shared.D(plus_days(kCob, i % 3650));
+    const auto ns = duration<double, std::nano>(steady_clock::now() - start).count() / n;
+    std::cout << "shared D() " << ns << "ns per call (" << sink << "), " << reads.load() << " racing reads\n";
+
+    std::cout << "SHARED_CURVES_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,157 @@
+// The macros are exercised here regardless of CURVEFORGE_ENABLE_METRICS
+#undef CURVEFORGE_METRICS
+#define CURVEFORGE_METRICS 1
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "metrics/Histogram.h"
+#include "metrics/Metrics.h"
+
+namespace {
+    thread_local bool t_fail_allocations = false;
+}
+
+// Lets a thread simulate running out of memory
+void *operator new(std::size_t size) {
+    if (t_fail_allocations) throw std::bad_alloc();
+    if (void *p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+    using namespace curve::metrics;
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    void spin_for(std::chrono::microseconds d) {
+        const auto until = std::chrono::steady_clock::now() + d;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }
+
+    void timed_work(std::chrono::microseconds d) {
+        CURVEFORGE_TIME_SCOPE("test.work");
+        spin_for(d);
+    }
+
+    std::size_t count_of(const std::string &text, const std::string &token) {
+        std::size_t n = 0;
+        for (auto pos = text.find(token); pos != std::string::npos; pos = text.find(token, pos + 1)) ++n;
+        return n;
+    }
+}
+
+int main() {
+    // Bucketing: every value lies inside its bucket and buckets are at most 12.5% wide
+    for (std::uint64_t v: {0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456789ull, ~0ull}) {
+        const auto b = histogram::bucket_of(v);
+        const auto lo = histogram::lower_bound(b);
+        if (v < lo || v - lo >= histogram::width(b)) return fail("bucket bounds of " + std::to_string(v));
+        if (lo >= 8 && histogram::width(b) * 8 > lo) return fail("bucket width of " + std::to_string(v));
+    }
+
+    // Counters and histograms summed across threads, including threads that already exited
+    static const Probe counter{"test.counter", ProbeKind::COUNTER};
+    static const Probe values{"test.values", ProbeKind::HISTOGRAM};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (std::uint64_t i = 1; i <= 1000; ++i) {
+                counter.add(2);
+                values.add(i);
+            }
+        });
+    }
+    for (auto &t: threads) t.join();
+    CURVEFORGE_COUNT("test.counter", 3);
+
+    auto snap = snapshot();
+    const auto *c = snap.find("test.counter");
+    if (c == nullptr || c->kind != ProbeKind::COUNTER) return fail("counter missing");
+    if (c->count != 4001 || c->total != 8003.0) return fail("counter total " + std::to_string(c->total));
+    const auto *h = snap.find("test.values");
+    if (h == nullptr || h->count != 4000 || h->total != 4 * 500500.0 || h->max != 1000.0) {
+        return fail("histogram totals");
+    }
+    // Percentiles are bucket midpoints: within 1/16 of the exact value
+    if (std::abs(h->p50 - 500.0) > 500.0 / 16 || std::abs(h->p99 - 990.0) > 990.0 / 16 || h->p999 > h->max) {
+        return fail("histogram percentiles " + std::to_string(h->p50) + " " + std::to_string(h->p99));
+    }
+    std::uint64_t bucketed = 0;
+    for (const auto &[lower, n]: h->buckets) bucketed += n;
+    if (bucketed != h->count) return fail("bucket counts");
+
+    // Timers report nanoseconds and keep spans for the Chrome trace while tracing is on
+    set_tracing(true);
+    for (int i = 0; i < 20; ++i) timed_work(std::chrono::microseconds(200));
+    std::thread([] { timed_work(std::chrono::microseconds(200)); }).join();
+    set_tracing(false);
+    timed_work(std::chrono::microseconds(1));
+
+    snap = snapshot();
+    const auto *w = snap.find("test.work");
+    if (w == nullptr || w->kind != ProbeKind::TIMER || w->count != 22) return fail("timer count");
+    if (w->p50 < 150'000.0 || w->p50 > 2'000'000.0) return fail("timer p50 " + std::to_string(w->p50) + "ns");
+    if (w->max < w->p99 || w->total < 21 * 200'000.0) return fail("timer totals");
+
+    std::ostringstream json;
+    write_json(json, snap);
+    if (json.str().find("\"name\": \"test.work\", \"kind\": \"timer\", \"unit\": \"ns\"") == std::string::npos) {
+        return fail("json:\n" + json.str());
+    }
+    std::ostringstream trace;
+    write_chrome_trace(trace);
+    if (count_of(trace.str(), "\"name\":\"test.work\"") != 21 || trace.str().find("\"ph\":\"X\"") == std::string::npos) {
+        return fail("chrome trace:\n" + trace.str());
+    }
+
+    reset();
+    snap = snapshot();
+    if (snap.find("test.work")->count != 0 || snap.find("test.counter")->total != 0.0) return fail("reset");
+
+    // A thread whose first sample cannot allocate drops it instead of throwing through noexcept,
+    // and records normally once memory is available again
+    static const Probe starved{"test.starved", ProbeKind::COUNTER};
+    set_tracing(true);
+    std::thread([] {
+        t_fail_allocations = true;
+        starved.add(100);
+        timed_work(std::chrono::microseconds(1));
+        t_fail_allocations = false;
+        starved.add(1);
+    }).join();
+    set_tracing(false);
+    snap = snapshot();
+    if (snap.find("test.starved")->count != 1 || snap.find("test.starved")->total != 1.0) {
+        return fail("sample under allocation failure");
+    }
+    if (snap.find("test.work")->count != 0) return fail("timer under allocation failure");
+
+    // Cost of one timed scope on this machine (informational)
+    static const Probe overhead{"test.overhead", ProbeKind::TIMER};
+    const int n = 1000000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; ++i) {
+        ScopedTimer timer(overhead);
+    }
+    const auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / n;
+    std::cout << "timed scope " << ns << "ns, " << snapshot().ticks_per_ns << " ticks/ns\n";
+
+    std::cout << "METRICS_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "curve/FlatRateCurve.h"
+#include "instruments/FixFloatSwap.h"
+#include "instruments/Leg.h"
+#include "pricing/AsyncPricing.h"
+#include "pricing/FixFloatSwapPricer.h"
+#include "tasks/Task.h"
+#include "time/calendar_factory.hpp"
+#include "time/daycount.hpp"
+
+using namespace curve;
+using namespace curve::instruments;
+using namespace curve::time;
+using namespace std::chrono;
+
+namespace {
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+}
+
+int main() {
+    tasks::Scheduler::configure({4, {}});
+
+    auto calendar = create_calendar(FinancialCalendar::NYSE);
+    auto dc = create_daycount_convention(DayCountConvention::ACT_360);
+    const Date cob = year{2025} / December / day{1};
+
+    // Swaps reference their legs: keep both alive in stable storage
+    std::vector<std::unique_ptr<Leg> > legs;
+    std::vector<std::unique_ptr<FixFloatSwap> > swaps;
+    for (int i = 0; i < 600; ++i) {
+        const Date start = cob + months{1 + i % 12};
+        const Date end = start + months{12 * (1 + i % 10)};
+        legs.push_back(std::make_unique<Leg>(1e6, "EUR", start, end, months{6}, *calendar,
+                                             BusinessDayConvention::FOLLOWING, *dc, Leg::FIXED));
+        legs.push_back(std::make_unique<Leg>(1e6, "EUR", start, end, months{6}, *calendar,
+                                             BusinessDayConvention::FOLLOWING, *dc, Leg::FLOATING));
+        swaps.push_back(std::make_unique<FixFloatSwap>(*legs[legs.size() - 2], *legs.back()));
+    }
+
+    std::shared_ptr<ICurve> discount = std::make_shared<FlatRateCurve>(cob, 0.03);
+    std::shared_ptr<ICurve> forward = std::make_shared<FlatRateCurve>(cob, 0.035);
+    auto md = std::make_shared<market::MarketData>(market::MarketData{
+        .snap_time = sys_days(cob), .curves_ois = {{"EUR", discount}}, .curves_funding = {{"EUR", forward}}
+    });
+    const pricing::FixFloatSwapPricer pricer;
+
+    if (tasks::sync_wait(pricing::price_async(pricer, *swaps[3], md)) != pricer.price(*swaps[3], md)) {
+        return fail("price_async");
+    }
+
+    // Portfolio fan-out matches the blocking pricer, in order
+    std::vector<const Instrument *> book;
+    for (const auto &s: swaps) book.push_back(s.get());
+    const auto prices = tasks::sync_wait(pricing::price_all_async(pricer, book, md, {}, 64));
+    if (prices.size() != swaps.size()) return fail("portfolio size");
+    for (std::size_t i = 0; i < swaps.size(); ++i) {
+        if (prices[i] != pricer.price(*swaps[i], md)) return fail("portfolio price " + std::to_string(i));
+    }
+
+    // Pricer errors and cancellation surface as exceptions of the awaited task
+    try {
+        tasks::sync_wait(pricing::compute_async(pricer, *swaps[0], md));
+        return fail("compute error lost");
+    } catch (const std::runtime_error &) {
+    }
+    tasks::CancellationSource stale;
+    stale.cancel();
+    try {
+        tasks::sync_wait(pricing::price_all_async(pricer, book, md, stale.token()));
+        return fail("stale portfolio priced");
+    } catch (const tasks::OperationCancelled &) {
+    }
+
+    std::cout << "ASYNC_PRICING_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+#include "signal/CrossMovingAverage.h"
+#include "signal/CrossMovingAverageBacktest.h"
+
+// Reference: one CrossMovingAverage object per configuration.
+static forge::signal::CmaBacktestSummary naive(const std::vector<double> &prices, forge::signal::CmaConfig c) {
+    forge::signal::CrossMovingAverage cma(c.short_period, c.long_period);
+    double pos = 0.0, pnl = 0.0, trade = 0.0, peak = 0.0, dd = 0.0;
+    std::size_t trades = 0, wins = 0;
+    for (std::size_t t = 0; t < prices.size(); ++t) {
+        if (t > 0) {
+            const double g = pos * (prices[t] - prices[t - 1]);
+            pnl += g;
+            trade += g;
+            peak = std::max(peak, pnl);
+            dd = std::max(dd, peak - pnl);
+        }
+        const double diff = cma.update(prices[t]);
+        const double target = diff > 0 ? 1.0 : (diff < 0 ? -1.0 : 0.0);
+        if (target != pos) {
+            if (pos != 0.0) {
+                ++trades;
+                if (trade > 0) ++wins;
+            }
+            trade = 0.0;
+            pos = target;
+        }
+    }
+    return {c, pnl, trades ? double(wins) / double(trades) : 0.0, trades, wins, dd};
+}
+
+int main() {
+    using namespace forge::signal;
+
+    std::mt19937_64 rng(11);
+    std::normal_distribution<double> ret(0.0002, 0.01);
+    std::vector<double> prices{100.0};
+    for (int i = 0; i < 2000; ++i) prices.push_back(prices.back() * std::exp(ret(rng)));
+
+    auto grid = CrossMovingAverageBacktest::make_grid({2, 3, 5, 8, 13, 21}, {5, 10, 20, 50, 100});
+    for (std::size_t threads: {std::size_t{1}, std::size_t{3}}) {
+        CrossMovingAverageBacktest bt(grid, threads);
+        auto results = bt.run(prices);
+        if (results.size() != grid.size()) {
+            std::cerr << "CMA_BACKTEST_SIZE_FAIL\n";
+            return 1;
+        }
+        for (std::size_t i = 0; i < grid.size(); ++i) {
+            const auto ref = naive(prices, grid[i]);
+            const auto &r = results[i];
+            if (std::abs(r.pnl - ref.pnl) > 1e-9 || r.trades != ref.trades || r.winning_trades != ref.winning_trades ||
+                std::abs(r.max_drawdown - ref.max_drawdown) > 1e-9) {
+                std::cerr << "CMA_BACKTEST_FAIL config (" << grid[i].short_period << "," << grid[i].long_period
+                        << ") pnl " << r.pnl << " vs " << ref.pnl << "\n";
+                return 1;
+            }
+        }
+    }
+
+    // CSV outputs
+    std::ostringstream summary, trace;
+    CrossMovingAverageBacktest::write_summary_csv(summary, CrossMovingAverageBacktest(grid).run(prices));
+    CrossMovingAverageBacktest::write_trace_csv(trace, prices, grid.front());
+    if (summary.str().rfind("short_period,long_period,pnl", 0) != 0 ||
+        trace.str().rfind("sample,short,long,diff\n", 0) != 0) {
+        std::cerr << "CMA_BACKTEST_CSV_FAIL\n";
+        return 1;
+    }
+
+    std::cout << "CMA_BACKTEST_OK" << std::endl;
+    return 0;
+}
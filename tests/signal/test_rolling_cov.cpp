@@ -0,0 +1,87 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+#include <Eigen/Dense>
+
+#include "signal/RollingCovariance.h"
+
+// Brute-force sample covariance of the last `window` columns ending at column `end` (inclusive).
+static Eigen::MatrixXd brute_cov(const Eigen::MatrixXd &data, Eigen::Index end, Eigen::Index window) {
+    const Eigen::Index first = std::max<Eigen::Index>(0, end + 1 - window);
+    const Eigen::MatrixXd block = data.middleCols(first, end + 1 - first);
+    const Eigen::VectorXd mean = block.rowwise().mean();
+    const Eigen::MatrixXd c = block.colwise() - mean;
+    return c * c.transpose() / static_cast<double>(block.cols() - 1);
+}
+
+int main() {
+    using forge::signal::RollingCovariance;
+
+    const Eigen::Index n = 24;
+    const Eigen::Index bars = 300;
+    const std::size_t window = 40;
+
+    std::mt19937_64 rng(7);
+    std::normal_distribution<double> dist(0.0, 0.01);
+    Eigen::MatrixXd data(n, bars);
+    for (Eigen::Index t = 0; t < bars; ++t) {
+        const double common = dist(rng);
+        for (Eigen::Index i = 0; i < n; ++i) data(i, t) = 0.5 * common + dist(rng) + 1e-3;
+    }
+
+    // Windowed covariance, serial and blocked/multithreaded, against brute force.
+    RollingCovariance serial(n, window);
+    RollingCovariance blocked(n, window, /*refresh_interval=*/97, /*num_threads=*/4, /*block_size=*/5);
+    double max_err = 0.0;
+    for (Eigen::Index t = 0; t < bars; ++t) {
+        serial.update(data.col(t));
+        blocked.update(data.col(t));
+        if (!serial.ready()) continue;
+        const Eigen::MatrixXd expected = brute_cov(data, t, static_cast<Eigen::Index>(window));
+        max_err = std::max(max_err, (serial.covariance() - expected).cwiseAbs().maxCoeff());
+        max_err = std::max(max_err, (blocked.covariance() - expected).cwiseAbs().maxCoeff());
+    }
+    if (max_err > 1e-12) {
+        std::cerr << "ROLLING_COV_FAIL window max error " << max_err << "\n";
+        return 1;
+    }
+
+    // Correlation has unit diagonal and matches the brute-force correlation.
+    const Eigen::MatrixXd corr = serial.correlation();
+    const Eigen::MatrixXd cov = brute_cov(data, bars - 1, static_cast<Eigen::Index>(window));
+    const Eigen::VectorXd inv_sd = cov.diagonal().cwiseSqrt().cwiseInverse();
+    const Eigen::MatrixXd expected_corr = inv_sd.asDiagonal() * cov * inv_sd.asDiagonal();
+    if ((corr - expected_corr).cwiseAbs().maxCoeff() > 1e-9) {
+        std::cerr << "ROLLING_CORR_FAIL\n";
+        return 1;
+    }
+
+    // Refresh must not change the result beyond rounding.
+    Eigen::MatrixXd before = serial.covariance();
+    serial.refresh();
+    if ((serial.covariance() - before).cwiseAbs().maxCoeff() > 1e-14) {
+        std::cerr << "ROLLING_COV_REFRESH_FAIL\n";
+        return 1;
+    }
+
+    // EWMA covariance against the direct recursion.
+    const double lambda = 0.94;
+    RollingCovariance ewma = RollingCovariance::ewma(n, lambda, 3, 7);
+    Eigen::VectorXd mean = data.col(0);
+    Eigen::MatrixXd s = Eigen::MatrixXd::Zero(n, n);
+    ewma.update(data.col(0));
+    for (Eigen::Index t = 1; t < bars; ++t) {
+        const Eigen::VectorXd d = data.col(t) - mean;
+        mean += (1.0 - lambda) * d;
+        s = lambda * (s + (1.0 - lambda) * d * d.transpose());
+        ewma.update(data.col(t));
+    }
+    if ((ewma.covariance() - s).cwiseAbs().maxCoeff() > 1e-14) {
+        std::cerr << "EWMA_COV_FAIL\n";
+        return 1;
+    }
+
+    std::cout << "ROLLING_COV_OK" << std::endl;
+    return 0;
+}
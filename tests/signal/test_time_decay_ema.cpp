@@ -0,0 +1,121 @@
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <random>
+
+#include "signal/TimeDecayEMA.h"
+
+int main() {
+    using namespace forge::signal;
+    using namespace std::chrono;
+
+    // fast_exp accuracy
+    double max_rel = 0.0;
+    for (double x = -50.0; x <= 50.0; x += 0.0137) {
+        max_rel = std::max(max_rel, std::abs(fast_exp(x) - std::exp(x)) / std::exp(x));
+    }
+    if (max_rel > 1e-8) {
+        std::cerr << "FAST_EXP_FAIL rel error " << max_rel << "\n";
+        return 1;
+    }
+
+    // Irregular ticks: gaps from 0 to 20s, beyond the default 4096ms table.
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<int> gap(0, 20000);
+    std::normal_distribution<double> px(100.0, 1.0);
+    std::vector<curve::time::Instant> times;
+    std::vector<double> values;
+    curve::time::Instant t0 = sys_days(year{2026} / January / 5);
+    auto t = t0;
+    for (int i = 0; i < 5000; ++i) {
+        t += milliseconds(gap(rng));
+        times.push_back(t);
+        values.push_back(px(rng));
+    }
+
+    const milliseconds tau{1500};
+    // Direct reference recursion
+    std::vector<double> ref(values.size());
+    ref[0] = values[0];
+    for (std::size_t i = 1; i < values.size(); ++i) {
+        const double dt = static_cast<double>(duration_cast<milliseconds>(times[i] - times[i - 1]).count());
+        const double alpha = 1.0 - std::exp(-dt / static_cast<double>(tau.count()));
+        ref[i] = alpha * values[i] + (1.0 - alpha) * ref[i - 1];
+    }
+
+    for (auto method: {DecayMethod::EXACT, DecayMethod::FAST_EXP, DecayMethod::TABLE}) {
+        TimeDecayEMA ema(tau, method);
+        TimeDecayEMA batch(tau, method);
+        std::vector<double> out;
+        batch.update_batch(times, values, out);
+        // fast_exp (also used beyond the table) is accurate to ~1e-8 relative
+        const double tol = method == DecayMethod::EXACT ? 1e-12 : 1e-7;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            const double v = ema.update(times[i], values[i]);
+            if (std::abs(v - ref[i]) > tol || std::abs(out[i] - ref[i]) > tol) {
+                std::cerr << "TIME_DECAY_EMA_FAIL at " << i << " " << v << " vs " << ref[i] << "\n";
+                return 1;
+            }
+        }
+    }
+
+    // Sub-millisecond ticks: 250us apart for one second. The whole second decays the first value
+    // (nothing is lost to millisecond truncation), and every method tracks the exact recursion.
+    {
+        const microseconds spacing{250};
+        std::vector<curve::time::Instant> burst_times;
+        std::vector<double> burst;
+        for (int i = 0; i <= 4000; ++i) {
+            burst_times.push_back(t0 + spacing * i);
+            burst.push_back(i == 0 ? 0.0 : 1.0);
+        }
+        const double expected = 1.0 - std::exp(-1000.0 / static_cast<double>(tau.count()));
+        for (auto method: {DecayMethod::EXACT, DecayMethod::FAST_EXP, DecayMethod::TABLE}) {
+            TimeDecayEMA ema(tau, method);
+            TimeDecayEMA batch(tau, method);
+            std::vector<double> out;
+            batch.update_batch(burst_times, burst, out);
+            double v = 0.0;
+            for (std::size_t i = 0; i < burst.size(); ++i) v = ema.update(burst_times[i], burst[i]);
+            if (std::abs(v - expected) > 1e-7 || std::abs(out.back() - expected) > 1e-7) {
+                std::cerr << "TIME_DECAY_SUBMS_FAIL " << v << " vs " << expected << "\n";
+                return 1;
+            }
+        }
+    }
+
+    // Half-life: after one half-life the old value has half the weight.
+    TimeDecayEMA hl = TimeDecayEMA::from_half_life(milliseconds{1000}, DecayMethod::EXACT);
+    hl.update(t0, 0.0);
+    const double v = hl.update(t0 + milliseconds{1000}, 1.0);
+    if (std::abs(v - 0.5) > 1e-3) {
+        std::cerr << "HALF_LIFE_FAIL " << v << "\n";
+        return 1;
+    }
+
+    // Crossover on irregular ticks
+    TimeDecayCrossMovingAverage cma(milliseconds{500}, milliseconds{5000});
+    std::vector<double> diffs;
+    cma.update_batch(times, values, diffs);
+    if (diffs.size() != values.size() || !cma.ready() || std::abs(*cma.last_difference() - diffs.back()) > 0) {
+        std::cerr << "TIME_DECAY_CMA_FAIL\n";
+        return 1;
+    }
+
+    // Out of order timestamps are rejected.
+    bool threw = false;
+    try {
+        TimeDecayEMA e(tau);
+        e.update(t0 + seconds{1}, 1.0);
+        e.update(t0, 1.0);
+    } catch (const std::invalid_argument &) {
+        threw = true;
+    }
+    if (!threw) {
+        std::cerr << "TIME_DECAY_ORDER_FAIL\n";
+        return 1;
+    }
+
+    std::cout << "TIME_DECAY_EMA_OK" << std::endl;
+    return 0;
+}
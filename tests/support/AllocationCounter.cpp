@@ -0,0 +1,67 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.h"
+
+namespace {
+    // Constant-initialised and trivially destructible: usable from operator new on any thread
+    thread_local std::uint64_t t_allocations = 0;
+    thread_local std::uint64_t t_deallocations = 0;
+    thread_local std::uint64_t t_bytes = 0;
+
+    void *counted_alloc(std::size_t size, std::size_t alignment) noexcept {
+        ++t_allocations;
+        t_bytes += size;
+        if (size == 0) size = 1;
+        if (alignment <= alignof(std::max_align_t)) return std::malloc(size);
+        // aligned_alloc wants a size that is a multiple of the alignment
+        return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+
+    void *counted_alloc_or_throw(std::size_t size, std::size_t alignment) {
+        if (void *p = counted_alloc(size, alignment)) return p;
+        throw std::bad_alloc();
+    }
+
+    void counted_free(void *p) noexcept {
+        if (p == nullptr) return;
+        ++t_deallocations;
+        std::free(p);
+    }
+
+    constexpr std::size_t kDefault = alignof(std::max_align_t);
+}
+
+namespace curve::testing {
+    AllocationStats thread_allocations() noexcept { return {t_allocations, t_deallocations, t_bytes}; }
+}
+
+void *operator new(std::size_t size) { return counted_alloc_or_throw(size, kDefault); }
+void *operator new[](std::size_t size) { return counted_alloc_or_throw(size, kDefault); }
+void *operator new(std::size_t size, std::align_val_t al) { return counted_alloc_or_throw(size, static_cast<std::size_t>(al)); }
+void *operator new[](std::size_t size, std::align_val_t al) { return counted_alloc_or_throw(size, static_cast<std::size_t>(al)); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return counted_alloc(size, kDefault); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return counted_alloc(size, kDefault); }
+void *operator new(std::size_t size, std::align_val_t al, const std::nothrow_t &) noexcept {
+    return counted_alloc(size, static_cast<std::size_t>(al));
+}
+void *operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t &) noexcept {
+    return counted_alloc(size, static_cast<std::size_t>(al));
+}
+
+void operator delete(void *p) noexcept { counted_free(p); }
+void operator delete[](void *p) noexcept { counted_free(p); }
+void operator delete(void *p, std::size_t) noexcept { counted_free(p); }
+void operator delete[](void *p, std::size_t) noexcept { counted_free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { counted_free(p); }
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept { counted_free(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept { counted_free(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept { counted_free(p); }
+void operator delete(void *p, std::align_val_t, const std::nothrow_t &) noexcept { counted_free(p); }
+void operator delete[](void *p, std::align_val_t, const std::nothrow_t &) noexcept { counted_free(p); }
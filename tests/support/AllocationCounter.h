@@ -0,0 +1,48 @@
+//
+// Created by Francisco Nunez on 13.02.2026.
+//
+
+#ifndef CURVEFORGE_TESTS_ALLOCATIONCOUNTER_H
+#define CURVEFORGE_TESTS_ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+#include <utility>
+
+// Linking the allocation_counter library replaces the global operator new/delete of the
+// executable with counting versions; counts are kept per thread.
+namespace curve::testing {
+    struct AllocationStats {
+        std::uint64_t allocations = 0;
+        std::uint64_t deallocations = 0;
+        std::uint64_t bytes = 0; // requested by the allocations
+
+        AllocationStats operator-(const AllocationStats &o) const {
+            return {allocations - o.allocations, deallocations - o.deallocations, bytes - o.bytes};
+        }
+    };
+
+    // Totals of the calling thread since it started
+    AllocationStats thread_allocations() noexcept;
+
+    // Counts the calling thread's allocations from construction on
+    class AllocationScope {
+    public:
+        AllocationScope() noexcept : start_(thread_allocations()) {
+        }
+
+        [[nodiscard]] AllocationStats stats() const noexcept { return thread_allocations() - start_; }
+
+    private:
+        AllocationStats start_;
+    };
+
+    // Runs f() `iterations` times and returns what those calls allocated on this thread
+    template<typename F>
+    AllocationStats count_allocations(F &&f, int iterations = 1) {
+        const AllocationScope scope;
+        for (int i = 0; i < iterations; ++i) f();
+        return scope.stats();
+    }
+}
+
+#endif //CURVEFORGE_TESTS_ALLOCATIONCOUNTER_H
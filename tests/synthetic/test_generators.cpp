@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+#include "analytical_pricers/BlackScholes.h"
+#include "io/BinarySnapshot.h"
+#include "io/CurveBuilder.h"
+#include "io/QuoteHistory.h"
+#include "io/XmlWriters.h"
+#include "synthetic/Generators.h"
+
+namespace {
+    using namespace curve;
+    using namespace curve::synthetic;
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    bool same_trade(const io::TradeRecord &a, const io::TradeRecord &b) {
+        if (a.id != b.id || a.currency != b.currency || a.notional != b.notional || a.fixed_rate != b.fixed_rate ||
+            a.pay_fixed != b.pay_fixed || a.float_tenor != b.float_tenor || a.cashflows.size() != b.cashflows.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.cashflows.size(); ++i) {
+            if (a.cashflows[i].date != b.cashflows[i].date) return false;
+        }
+        return true;
+    }
+
+    std::size_t count_of(const std::string &text, const std::string &token) {
+        std::size_t n = 0;
+        for (auto pos = text.find(token); pos != std::string::npos; pos = text.find(token, pos + 1)) ++n;
+        return n;
+    }
+}
+
+int main() {
+    // Trades: reproducible, independent of book size, spread over all profiles
+    PortfolioOptions book;
+    book.seed = 7;
+    const SwapGenerator generator(book);
+    const auto trades = generator.trades(5000);
+    const auto again = SwapGenerator(book).trades(100);
+    for (std::size_t i = 0; i < again.size(); ++i) {
+        if (!same_trade(trades[i], again[i]) || !same_trade(trades[i], generator.trade(i))) {
+            return fail("trade " + std::to_string(i) + " is not reproducible");
+        }
+    }
+    book.seed = 8;
+    if (same_trade(SwapGenerator(book).trade(0), trades[0])) return fail("seed does not change the book");
+
+    std::map<std::string, std::size_t> by_currency;
+    std::size_t forward_starting = 0;
+    for (const auto &t: trades) {
+        ++by_currency[t.currency];
+        if (t.type != "IRSwap" || t.cashflows.empty() || t.notional < 1e5 || std::abs(t.fixed_rate) > 0.2) {
+            return fail("implausible trade " + t.id);
+        }
+        if (!std::is_sorted(t.cashflows.begin(), t.cashflows.end(),
+                            [](const auto &a, const auto &b) { return a.date < b.date; })) {
+            return fail("unsorted cashflows " + t.id);
+        }
+        const auto first = std::chrono::sys_days(t.cashflows.front().date);
+        if (first - std::chrono::sys_days(book.as_of) > std::chrono::days{400}) ++forward_starting;
+    }
+    if (by_currency.size() != currency_profiles().size()) return fail("not all currencies traded");
+    const double usd_share = static_cast<double>(by_currency["USD"]) / trades.size();
+    if (std::abs(usd_share - 0.30) > 0.03) return fail("USD share " + std::to_string(usd_share));
+    if (forward_starting == 0) return fail("no forward starting swaps");
+
+    // Market: curves build and sit near their currency's levels
+    MarketOptions market;
+    market.seed = 7;
+    market.underlyings = 6;
+    const auto snapshot = generate_snapshot(market);
+    if (snapshot.yield_curves.size() != 2 * currency_profiles().size()) return fail("curve count");
+    const auto curves = io::build_yield_curves(snapshot.yield_curves, 2);
+    for (const auto &record: snapshot.yield_curves) {
+        const auto &profile = currency_profile(record.currency);
+        const auto &curve = *curves.at(record.curve_id);
+        const time::Date ten_years{std::chrono::year{2036}, std::chrono::February, std::chrono::day{10}};
+        const double zero = -std::log(curve.D(ten_years)) / 10.0;
+        if (std::abs(zero - profile.long_rate) > 0.02) return fail("curve level " + record.curve_id);
+    }
+    if (generate_snapshot(market) != snapshot) return fail("snapshot is not reproducible");
+
+    // Option chains: Black-Scholes prices at a skewed smile
+    const auto chains = generate_option_chains(market);
+    for (const auto &chain: chains) {
+        std::map<std::pair<std::string, double>, double> calls;
+        double atm_vol = 0.0, low_strike_vol = 0.0;
+        for (const auto &o: chain.options) {
+            const double expected = o.is_call
+                                        ? analytical_pricers::BlackScholes::call_price(
+                                            chain.spot, o.strike, chain.rate, o.volatility, o.maturity)
+                                        : analytical_pricers::BlackScholes::put_price(
+                                            chain.spot, o.strike, chain.rate, o.volatility, o.maturity);
+            if (std::abs(expected - o.price) > 1e-12 * chain.spot) return fail("option price " + chain.underlying_id);
+            if (o.is_call) calls[{o.expiry, o.strike}] = o.price;
+            else {
+                // put-call parity
+                const double parity = calls.at({o.expiry, o.strike}) - o.price -
+                                      (chain.spot - o.strike * std::exp(-chain.rate * o.maturity));
+                if (std::abs(parity) > 1e-9 * chain.spot) return fail("put-call parity " + chain.underlying_id);
+            }
+            if (o.expiry == "1Y" && o.is_call) {
+                if (std::abs(o.strike / chain.spot - 1.0) < 0.01) atm_vol = o.volatility;
+                if (std::abs(o.strike / chain.spot - 0.8) < 0.01) low_strike_vol = o.volatility;
+            }
+        }
+        if (low_strike_vol <= atm_vol) return fail("no skew on " + chain.underlying_id);
+    }
+
+    // Binary snapshot round trip
+    const auto bytes = io::BinarySnapshotWriter::encode(snapshot);
+    const auto mapped = io::MappedSnapshot::from_buffer(bytes.data(), bytes.size());
+    if (mapped.yield_curve_count() != snapshot.yield_curves.size() ||
+        mapped.vol_surface_count() != snapshot.vol_surfaces.size()) {
+        return fail("binary snapshot");
+    }
+
+    // XML documents hold every record
+    std::ostringstream market_xml, portfolio_xml;
+    io::MarketDataXmlWriter::write(market_xml, snapshot);
+    {
+        io::PortfolioXmlWriter writer(portfolio_xml, "Synthetic book", "SYNTH-7");
+        for (std::size_t i = 0; i < 250; ++i) writer.add(trades[i]);
+    }
+    if (count_of(market_xml.str(), "<md:yieldCurve>") != snapshot.yield_curves.size() ||
+        count_of(market_xml.str(), "<v:point>") != snapshot.vol_surfaces.front().points.size() * chains.size() ||
+        count_of(portfolio_xml.str(), "<p:Instrument ") != 250 ||
+        portfolio_xml.str().find("</p:Portfolio>") == std::string::npos) {
+        return fail("xml documents");
+    }
+
+    // Quote history into the columnar format
+    const std::string path = "/tmp/curveforge-synth-" + std::to_string(::getpid()) + ".cfqh";
+    std::remove(path.c_str());
+    std::size_t produced = 0;
+    {
+        auto writer = io::QuoteHistoryWriter::open(path);
+        produced = generate_quote_history(market, {5, 40}, [&](const io::QuoteSetRecord &set) { writer.append(set); });
+    }
+    const auto history = io::QuoteHistory::open(path);
+    std::remove(path.c_str());
+    if (produced != 5 * 40 * 5 * currency_profiles().size() || history.row_count() != produced ||
+        history.block_count() != 5) {
+        return fail("quote history " + std::to_string(history.row_count()) + " rows");
+    }
+
+    std::cout << "SYNTHETIC_OK" << std::endl;
+    return 0;
+}
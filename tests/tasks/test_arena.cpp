@@ -0,0 +1,114 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AllocationCounter.h"
+#include "tasks/ScratchArena.h"
+#include "time/calendar_factory.hpp"
+#include "time/daycount.hpp"
+#include "time/scheduler.h"
+
+namespace {
+    using namespace curve;
+    using curve::testing::count_allocations;
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    // Scratch work of a varying but bounded size
+    void scratch_work(std::size_t n) {
+        const tasks::ArenaScope scope;
+        std::pmr::vector<double> values(scope.resource());
+        for (std::size_t i = 0; i < n; ++i) values.push_back(static_cast<double>(i));
+        std::pmr::vector<int> ids(n, 7, scope.resource());
+        if (values.size() != ids.size()) std::abort();
+    }
+}
+
+int main() {
+    auto &arena = tasks::ScratchArena::local();
+    if (&arena != &tasks::ScratchArena::local()) return fail("local arena not stable");
+
+    // A workload larger than the initial buffer spills to the heap once, then fits the grown buffer
+    scratch_work(10000);
+    const auto after_first = arena.stats();
+    if (after_first.upstream_allocations == 0 || after_first.resets != 1) return fail("first cycle did not spill");
+    if (arena.capacity() < after_first.high_water) return fail("buffer not grown to the high water mark");
+    const auto steady = count_allocations([] { scratch_work(10000); }, 20);
+    if (steady.allocations != 0) return fail("steady cycles touched the heap");
+    if (arena.stats().upstream_allocations != after_first.upstream_allocations) return fail("steady cycles spilled");
+    if (arena.stats().resets != 21) return fail("reset count");
+
+    // Nested scopes share the outermost cycle
+    {
+        const tasks::ArenaScope outer;
+        const auto resets = arena.stats().resets;
+        scratch_work(10);
+        if (arena.stats().resets != resets) return fail("inner scope reset the arena");
+    }
+
+    // Schedules: only the returned accruals come from the global heap
+    {
+        const auto calendar = time::create_calendar(time::FinancialCalendar::NYSE);
+        const auto dc = time::create_daycount_convention(time::DayCountConvention::ACT_360);
+        const std::chrono::months quarterly{3};
+        const auto bdc = time::BusinessDayConvention::MODIFIED_FOLLOWING;
+        const time::Date start = std::chrono::year{2026} / std::chrono::March / std::chrono::day{16};
+        const time::Date end = std::chrono::year{2056} / std::chrono::March / std::chrono::day{16};
+        const auto reference = time::Scheduler::generate_schedule(start, end, quarterly, bdc, *dc, *calendar);
+        const auto generate = [&] {
+            const tasks::ArenaScope scope;
+            const auto schedule = time::Scheduler::generate_schedule(start, end, quarterly, bdc, *dc, *calendar,
+                                                                     scope.resource());
+            if (schedule.accruals.size() != reference.accruals.size()) std::abort();
+        };
+        generate();
+        if (const auto n = count_allocations(generate).allocations; n != 1) return fail("schedule generation allocations " + std::to_string(n));
+        // Without a scratch resource the accruals are built straight into the returned vector
+        const auto plain = [&] {
+            const auto schedule = time::Scheduler::generate_schedule(start, end, quarterly, bdc, *dc, *calendar);
+            if (schedule.accruals.size() != reference.accruals.size()) std::abort();
+        };
+        if (const auto n = count_allocations(plain).allocations; n != 1) return fail("plain schedule allocations " + std::to_string(n));
+        // Accruals alone, into an arena vector: no heap at all once the arena has grown
+        const auto accruals_only = [&] {
+            const tasks::ArenaScope scope;
+            std::pmr::vector<time::AccruedPeriod> accruals(scope.resource());
+            time::Scheduler::generate_accruals(start, end, quarterly, bdc, *dc, *calendar, accruals);
+            if (accruals.size() != reference.accruals.size()) std::abort();
+        };
+        accruals_only();
+        if (const auto n = count_allocations(accruals_only).allocations; n != 0) return fail("arena accruals allocations " + std::to_string(n));
+        const tasks::ArenaScope scope;
+        const auto schedule = time::Scheduler::generate_schedule(start, end, quarterly, bdc, *dc, *calendar,
+                                                                 scope.resource());
+        for (std::size_t i = 0; i < reference.accruals.size(); ++i) {
+            if (schedule.accruals[i].end_date != reference.accruals[i].end_date ||
+                schedule.accruals[i].accrual != reference.accruals[i].accrual) {
+                return fail("arena schedule differs");
+            }
+        }
+    }
+
+    // Every thread has its own arena; totals include threads that have exited
+    const auto before = tasks::ScratchArena::totals();
+    const tasks::ScratchArena *other = nullptr;
+    std::thread worker([&] {
+        other = &tasks::ScratchArena::local();
+        scratch_work(100);
+    });
+    worker.join();
+    if (other == &arena) return fail("threads share an arena");
+    const auto totals = tasks::ScratchArena::totals();
+    if (totals.allocations <= before.allocations || totals.resets <= before.resets) return fail("totals");
+    if (totals.high_water < after_first.high_water) return fail("totals high water");
+
+    std::cout << "ARENA_OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tasks/Cancellation.h"
+#include "tasks/Parallel.h"
+#include "tasks/Task.h"
+
+namespace {
+    using namespace curve::tasks;
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+
+    Task<int> square(int x) {
+        co_await schedule();
+        co_return x * x;
+    }
+
+    Task<int> sum_of_squares(int n) {
+        int total = 0;
+        for (int i = 1; i <= n; ++i) total += co_await square(i);
+        co_return total;
+    }
+
+    Task<void> throws_after_hop() {
+        co_await schedule();
+        throw std::runtime_error("bad quote");
+    }
+
+    // A job that checks its token between steps, like a portfolio revaluation would
+    Task<int> slow_job(CancellationToken token, std::atomic<int> &steps) {
+        for (int i = 0; i < 1000; ++i) {
+            co_await schedule(token);
+            ++steps;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        co_return 1;
+    }
+
+    // Coroutines and parallel loops share the pool: a task may run a parallel_for inside
+    Task<long> nested_loop(std::size_t n) {
+        co_await schedule();
+        std::atomic<long> total{0};
+        parallel_for(0, n, [&](std::size_t i) { total += static_cast<long>(i); }, 64);
+        co_return total.load();
+    }
+}
+
+int main() {
+    Scheduler::configure({4, {}});
+
+    if (sync_wait(sum_of_squares(10)) != 385) return fail("sequential awaits");
+
+    // Fan-out / fan-in keeps the input order
+    {
+        std::vector<Task<int> > jobs;
+        for (int i = 0; i < 2000; ++i) jobs.push_back(square(i));
+        const auto squares = sync_wait(when_all(std::move(jobs)));
+        for (int i = 0; i < 2000; ++i) {
+            if (squares[i] != i * i) return fail("when_all result " + std::to_string(i));
+        }
+        if (!sync_wait(when_all(std::vector<Task<int> >{})).empty()) return fail("empty when_all");
+    }
+
+    // Exceptions travel to the awaiting coroutine, through when_all as well
+    try {
+        std::vector<Task<void> > jobs;
+        jobs.push_back(throws_after_hop());
+        jobs.push_back(throws_after_hop());
+        sync_wait(when_all(std::move(jobs)));
+        return fail("exception lost");
+    } catch (const std::runtime_error &e) {
+        if (std::string(e.what()) != "bad quote") return fail("wrong exception");
+    }
+
+    // Nested parallelism inside coroutines
+    {
+        std::vector<Task<long> > jobs;
+        for (int i = 0; i < 8; ++i) jobs.push_back(nested_loop(10000));
+        for (const long total: sync_wait(when_all(std::move(jobs)))) {
+            if (total != 10000L * 9999L / 2) return fail("nested loop total");
+        }
+    }
+
+    // A newer snapshot supersedes the running job, which stops at its next checkpoint
+    {
+        CancellationSequence snapshots;
+        std::atomic<int> stale_steps{0}, fresh_steps{0};
+        const auto stale = snapshots.next();
+        std::thread superseder([&] {
+            while (stale_steps < 5) std::this_thread::yield();
+            snapshots.next();
+        });
+        try {
+            sync_wait(slow_job(stale, stale_steps));
+            superseder.join();
+            return fail("stale job finished");
+        } catch (const OperationCancelled &) {
+        }
+        superseder.join();
+        if (stale_steps >= 1000) return fail("stale job was not dropped early");
+
+        std::vector<Task<int> > fresh;
+        const auto token = snapshots.next();
+        for (int i = 0; i < 4; ++i) fresh.push_back(run_async([&, token] {
+            token.throw_if_cancelled();
+            ++fresh_steps;
+            return 1;
+        }));
+        const auto done = sync_wait(when_all(std::move(fresh)));
+        if (done.size() != 4 || fresh_steps != 4) return fail("fresh job");
+        if (!stale.is_cancelled() || token.is_cancelled() || CancellationToken{}.is_cancelled()) {
+            return fail("token states");
+        }
+    }
+
+    std::cout << "TASKS_CORO_OK" << std::endl;
+    return 0;
+}
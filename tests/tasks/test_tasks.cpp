@@ -0,0 +1,169 @@
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tasks/Parallel.h"
+#include "tasks/Scheduler.h"
+#include "tasks/TaskGroup.h"
+#include "tasks/Topology.h"
+
+namespace {
+    using namespace curve::tasks;
+
+    int fail(const std::string &what) {
+        std::cerr << what << '\n';
+        return 1;
+    }
+}
+
+int main() {
+    Scheduler::configure({4, {}});
+    if (Scheduler::global().concurrency() != 4) return fail("configured concurrency");
+    try {
+        Scheduler::configure({2, {}});
+        return fail("configure after first use accepted");
+    } catch (const std::logic_error &) {
+    }
+
+    // parallel_for visits every index exactly once
+    {
+        constexpr std::size_t n = 100000;
+        std::vector<std::atomic<int> > hits(n);
+        parallel_for(0, n, [&](std::size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); }, 64);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (hits[i].load() != 1) return fail("index " + std::to_string(i) + " visited " + std::to_string(hits[i]));
+        }
+    }
+
+    // Nested: every outer task runs a parallel loop of its own on the same workers
+    {
+        std::atomic<std::size_t> total{0};
+        parallel_for_bounded(16, 16, [&](std::size_t) {
+            parallel_for(0, 5000, [&](std::size_t) { total.fetch_add(1, std::memory_order_relaxed); }, 16);
+        });
+        if (total.load() != 16 * 5000) return fail("nested total " + std::to_string(total.load()));
+    }
+
+    // The reduction only depends on the chunking, not on who ran which chunk
+    {
+        constexpr std::size_t n = 1 << 20;
+        const auto term = [](std::size_t i) { return 1.0 / (1.0 + static_cast<double>(i)); };
+        const auto reduce = [&](std::size_t b, std::size_t e, double acc) {
+            for (std::size_t i = b; i < e; ++i) acc += term(i);
+            return acc;
+        };
+        const auto plus = [](double a, double b) { return a + b; };
+        double expected = 0.0;
+        for (std::size_t b = 0; b < n; b += 1000) expected += reduce(b, std::min(n, b + 1000), 0.0);
+        for (int run = 0; run < 5; ++run) {
+            if (parallel_reduce(0, n, 0.0, reduce, plus, 1000) != expected) return fail("reduction not reproducible");
+        }
+    }
+
+    // The first exception cancels the rest and reaches the caller
+    {
+        std::atomic<std::size_t> ran{0};
+        try {
+            parallel_for(0, 1 << 16, [&](std::size_t i) {
+                if (i == 100) throw std::runtime_error("boom");
+                ran.fetch_add(1, std::memory_order_relaxed);
+            });
+            return fail("exception swallowed");
+        } catch (const std::runtime_error &e) {
+            if (std::string(e.what()) != "boom") return fail("wrong exception");
+        }
+    }
+
+    // Cancelling a group reaches the groups its tasks created
+    {
+        Scheduler scheduler({3, {}});
+        TaskGroup outer(scheduler);
+        std::atomic<bool> inner_saw_cancel{false};
+        std::atomic<bool> started{false};
+        outer.run([&] {
+            TaskGroup inner(scheduler);
+            inner.run([&] {
+                started = true;
+                while (!inner.is_cancelled()) std::this_thread::yield();
+                inner_saw_cancel = true;
+            });
+            inner.wait();
+        });
+        while (!started) std::this_thread::yield();
+        outer.cancel();
+        outer.wait();
+        if (!inner_saw_cancel) return fail("nested cancellation");
+
+        // Skipped once cancelled, usable again after wait()
+        std::atomic<int> ran{0};
+        outer.cancel();
+        outer.run([&] { ++ran; });
+        outer.wait();
+        outer.run([&] { ++ran; });
+        outer.wait();
+        if (ran != 1) return fail("cancelled task ran or reuse failed");
+    }
+
+    // A burst far beyond the initial deque capacity, spawned from a worker and stolen by the others
+    {
+        Scheduler scheduler({4, {0}});
+        TaskGroup group(scheduler);
+        std::atomic<std::size_t> done{0};
+        std::atomic<bool> bad_index{false};
+        group.run([&] {
+            for (int i = 0; i < 20000; ++i) {
+                group.run([&] {
+                    if (scheduler.thread_index() >= scheduler.concurrency()) bad_index = true;
+                    done.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        });
+        group.wait();
+        if (done.load() != 20000 || bad_index) return fail("burst lost tasks");
+    }
+
+    // No workers: everything runs on the waiting thread
+    {
+        Scheduler serial({1, {}});
+        TaskGroup group(serial);
+        const auto caller = std::this_thread::get_id();
+        bool elsewhere = false;
+        for (int i = 0; i < 100; ++i) group.run([&] { elsewhere |= std::this_thread::get_id() != caller; });
+        group.wait();
+        if (serial.concurrency() != 1 || elsewhere) return fail("serial scheduler");
+    }
+
+    // Topology: kernel cpu lists, and at least one node to shard by
+    {
+        if (parse_cpu_list("0-3,8,10-11\n") != std::vector<int>{0, 1, 2, 3, 8, 10, 11}) return fail("cpu list");
+        if (!parse_cpu_list("").empty()) return fail("empty cpu list");
+        for (const auto *bad: {"3-1", "a", "1-", "-2"}) {
+            try {
+                parse_cpu_list(bad);
+                return fail(std::string("bad cpu list accepted: ") + bad);
+            } catch (const std::invalid_argument &) {
+            }
+        }
+        const auto nodes = numa_nodes();
+        if (nodes.empty()) return fail("no numa node");
+        for (std::size_t i = 1; i < nodes.size(); ++i) {
+            if (nodes[i].id <= nodes[i - 1].id) return fail("numa nodes out of order");
+        }
+    }
+
+    // parallel_for_bounded on an explicit scheduler
+    {
+        Scheduler node({3, {}});
+        std::vector<std::atomic<int> > hits(64);
+        parallel_for_bounded(node, hits.size(), 3, [&](std::size_t i) { ++hits[i]; });
+        for (const auto &h: hits) {
+            if (h.load() != 1) return fail("bounded loop on explicit scheduler");
+        }
+    }
+
+    std::cout << "TASKS_OK" << std::endl;
+    return 0;
+}